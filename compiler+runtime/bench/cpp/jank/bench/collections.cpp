@@ -0,0 +1,112 @@
+#include <array>
+
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  /* These cover array maps, maps of a typical record size and large hash maps. */
+  static constexpr std::array<usize, 3> sizes{ 8, 32, 4096 };
+
+  static object_ref build_vector(usize const size)
+  {
+    object_ref ret{ obj::persistent_vector::empty() };
+    for(usize i{}; i < size; ++i)
+    {
+      ret = conj(ret, make_box(static_cast<i64>(i)));
+    }
+    return ret;
+  }
+
+  static object_ref build_map(obj::persistent_vector_ref const keys)
+  {
+    object_ref ret{ obj::persistent_array_map::empty() };
+    i64 i{};
+    for(auto const &k : keys->data)
+    {
+      ret = assoc(ret, k, make_box(i++));
+    }
+    return ret;
+  }
+
+  static obj::persistent_vector_ref keyword_keys(usize const size)
+  {
+    runtime::detail::native_transient_vector t;
+    for(usize i{}; i < size; ++i)
+    {
+      t.push_back(__rt_ctx->intern_keyword(util::format("bench-key-{}", i)).expect_ok());
+    }
+    return make_box<obj::persistent_vector>(t.persistent());
+  }
+
+  static obj::persistent_vector_ref string_keys(usize const size)
+  {
+    runtime::detail::native_transient_vector t;
+    for(usize i{}; i < size; ++i)
+    {
+      t.push_back(make_box(util::format("bench-key-{}", i)));
+    }
+    return make_box<obj::persistent_vector>(t.persistent());
+  }
+
+  void add_collections(suite &s)
+  {
+    for(auto const size : sizes)
+    {
+      s.add(util::format("collections/vector conj {}", size), size, [=] {
+        doNotOptimizeAway(build_vector(size));
+      });
+
+      auto const vec{ s.root(build_vector(size)) };
+      s.add(util::format("collections/vector nth {}", size), size, [=] {
+        for(usize i{}; i < size; ++i)
+        {
+          doNotOptimizeAway(nth(vec, make_box(static_cast<i64>(i))));
+        }
+      });
+
+      s.add(util::format("collections/transient vector conj! {}", size), size, [=] {
+        auto t{ transient(obj::persistent_vector::empty()) };
+        for(usize i{}; i < size; ++i)
+        {
+          t = conj_in_place(t, make_box(static_cast<i64>(i)));
+        }
+        doNotOptimizeAway(persistent(t));
+      });
+
+      for(auto const &[kind, keys] : { std::pair{ "keyword", s.root(keyword_keys(size)) },
+                                       std::pair{ "string", s.root(string_keys(size)) } })
+      {
+        s.add(util::format("collections/{} map assoc {}", kind, size), size, [=] {
+          doNotOptimizeAway(build_map(keys));
+        });
+
+        auto const m{ s.root(build_map(keys)) };
+        s.add(util::format("collections/{} map get {}", kind, size), size, [=] {
+          for(auto const &k : keys->data)
+          {
+            doNotOptimizeAway(get(m, k));
+          }
+        });
+
+        s.add(util::format("collections/{} transient map assoc! {}", kind, size), size, [=] {
+          auto t{ transient(obj::persistent_array_map::empty()) };
+          i64 i{};
+          for(auto const &k : keys->data)
+          {
+            t = assoc_in_place(t, k, make_box(i++));
+          }
+          doNotOptimizeAway(persistent(t));
+        });
+      }
+    }
+  }
+}
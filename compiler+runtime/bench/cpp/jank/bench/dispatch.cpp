@@ -0,0 +1,54 @@
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  /* Each function makes 1000 calls of the kind being measured. */
+  static void
+  add_jank(suite &s, jtl::immutable_string const &name, jtl::immutable_string const &code)
+  {
+    auto const fn{ s.root(__rt_ctx->eval_string(code).unwrap()) };
+    s.add(util::format("dispatch/{}", name), 1000, [=] { doNotOptimizeAway(fn.call()); });
+  }
+
+  void add_dispatch(suite &s)
+  {
+    __rt_ctx->eval_string(R"(
+      (defn bench-identity [x] x)
+      (defn bench-variadic [& xs] xs)
+      (def ^:dynamic *bench-dynamic* 1)
+
+      (defmulti bench-area :shape)
+      (defmethod bench-area :square [{:keys [side]}] (* side side))
+      (defmethod bench-area :circle [{:keys [r]}] (* 3 r r))
+      (defmethod bench-area :default [_] 0))");
+
+    add_jank(s,
+             "var call",
+             "(fn [] (loop [i 0 acc nil] (if (< i 1000) (recur (inc i) (bench-identity i)) acc)))");
+    add_jank(s,
+             "variadic call",
+             "(fn [] (loop [i 0 acc nil]"
+             "         (if (< i 1000) (recur (inc i) (bench-variadic i i i)) acc)))");
+    add_jank(s,
+             "apply",
+             "(let [args [1 2 3]]"
+             "  (fn [] (loop [i 0 acc nil] (if (< i 1000) (recur (inc i) (apply + args)) acc))))");
+    add_jank(s,
+             "dynamic var deref",
+             "(fn [] (loop [i 0 acc 0] (if (< i 1000) (recur (inc i) *bench-dynamic*) acc)))");
+    add_jank(s,
+             "multimethod",
+             "(let [shapes [{:shape :square :side 2} {:shape :circle :r 1} {:shape :hex}]]"
+             "  (fn [] (loop [i 0 acc 0]"
+             "           (if (< i 1000) (recur (inc i) (bench-area (shapes (mod i 3)))) acc))))");
+    add_jank(s,
+             "keyword lookup",
+             "(let [m {:a 1 :b 2 :c 3 :d 4 :e 5 :f 6 :g 7 :h 8 :i 9 :j 10}]"
+             "  (fn [] (loop [i 0 acc 0] (if (< i 1000) (recur (inc i) (:i m)) acc))))");
+  }
+}
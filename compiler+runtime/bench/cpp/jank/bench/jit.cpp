@@ -0,0 +1,39 @@
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  /* These measure the latency of compiling a top-level form, which is what a REPL user waits
+   * on. Each run uses a fresh name, so nothing is cached between runs. */
+  static void add_compile(suite &s, jtl::immutable_string const &name, char const * const code)
+  {
+    s.add_slow(util::format("jit/{}", name), [=] {
+      static usize next{};
+      doNotOptimizeAway(__rt_ctx->eval_string(util::format(code, next++)).unwrap());
+    });
+  }
+
+  void add_jit(suite &s)
+  {
+    add_compile(s, "constant", "(def bench-jit-constant-{} 1)");
+    add_compile(s, "small fn", "(defn bench-jit-small-{} [x] (+ x 1))");
+    add_compile(s,
+                "medium fn",
+                "(defn bench-jit-medium-{} [coll]"
+                "  (let [m (group-by :kind coll)]"
+                "    (for [[k vs] m"
+                "          :when (some? k)]"
+                "      {:kind k :count (count vs) :total (reduce + (map :n vs))})))");
+    add_compile(s,
+                "macro heavy fn",
+                "(defn bench-jit-macro-{} [x]"
+                "  (cond-> x"
+                "    (map? x) (assoc :seen true)"
+                "    (vector? x) (conj :seen)"
+                "    :always (-> (doto prn) str)))");
+  }
+}
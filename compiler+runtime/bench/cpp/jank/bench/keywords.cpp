@@ -0,0 +1,50 @@
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  void add_keywords(suite &s)
+  {
+    runtime::detail::native_transient_vector t;
+    for(usize i{}; i < 1000; ++i)
+    {
+      auto const name{ make_box(util::format("bench-keyword-{}", i)) };
+      __rt_ctx->intern_keyword(name->data).expect_ok();
+      t.push_back(name);
+    }
+    auto const names{ s.root(make_box<obj::persistent_vector>(t.persistent())) };
+
+    /* Interning a keyword which already exists is what the reader does most of the time. */
+    s.add("keywords/intern existing", names->count(), [=] {
+      for(auto const &name : names->data)
+      {
+        auto const &str{ expect_object<obj::persistent_string>(name)->data };
+        doNotOptimizeAway(__rt_ctx->intern_keyword(str).expect_ok());
+      }
+    });
+    s.add("keywords/intern existing qualified", names->count(), [=] {
+      for(auto const &name : names->data)
+      {
+        auto const &str{ expect_object<obj::persistent_string>(name)->data };
+        doNotOptimizeAway(__rt_ctx->intern_keyword("bench.ns", str).expect_ok());
+      }
+    });
+
+    /* Each run makes new keywords, which are never freed, so this is kept short. */
+    s.add_slow("keywords/intern 1000 new", [] {
+      static usize next{};
+      for(usize i{}; i < 1000; ++i)
+      {
+        doNotOptimizeAway(
+          __rt_ctx->intern_keyword(util::format("bench-new-keyword-{}", next++)).expect_ok());
+      }
+    });
+  }
+}
@@ -0,0 +1,62 @@
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/obj/big_integer.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  static void add_jank(suite &s,
+                       jtl::immutable_string const &name,
+                       u64 const batch,
+                       jtl::immutable_string const &code)
+  {
+    auto const fn{ s.root(__rt_ctx->eval_string(code).unwrap()) };
+    s.add(util::format("math/{}", name), batch, [=] { doNotOptimizeAway(fn.call()); });
+  }
+
+  void add_math(suite &s)
+  {
+    /* Boxed math through the runtime, as dynamic code does it. */
+    auto const one{ s.root(make_box(1)) };
+    auto const half{ s.root(make_box(0.5)) };
+    s.add("math/boxed integer add", 1000, [=] {
+      object_ref acc{ make_box(0) };
+      for(usize i{}; i < 1000; ++i)
+      {
+        acc = add(acc, one);
+      }
+      doNotOptimizeAway(acc);
+    });
+    s.add("math/boxed real mul", 1000, [=] {
+      object_ref acc{ make_box(1.0) };
+      for(usize i{}; i < 1000; ++i)
+      {
+        acc = mul(acc, half);
+      }
+      doNotOptimizeAway(acc);
+    });
+
+    auto const big{ s.root(make_box<obj::big_integer>(
+      jtl::immutable_string{ "123456789012345678901234567890123456789" })) };
+    s.add("math/big integer mul", [=] { doNotOptimizeAway(mul(big, big)); });
+
+    add_jank(s,
+             "loop sum 1000",
+             1000,
+             "(fn [] (loop [i 0 acc 0] (if (< i 1000) (recur (inc i) (+ acc i)) acc)))");
+    add_jank(s,
+             "loop real 1000",
+             1000,
+             "(fn [] (loop [i 0 acc 0.0] (if (< i 1000) (recur (inc i) (+ acc (* i 0.5))) acc)))");
+    add_jank(s,
+             "fib 20",
+             1,
+             "(do (defn bench-fib [n] (if (<= n 1) n (+ (bench-fib (- n 1)) (bench-fib (- n 2)))))"
+             " (fn [] (bench-fib 20)))");
+  }
+}
@@ -0,0 +1,54 @@
+#include <jank/bench/suite.hpp>
+#include <clojure/data/json_native.hpp>
+#include <jank/read/edn.hpp>
+#include <jank/runtime/core/freeze.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  /* About 100 KB of typical data: records with strings, numbers, keywords and nested
+   * collections. */
+  static jtl::immutable_string sample_edn()
+  {
+    jtl::string_builder edn;
+    edn('[');
+    for(i64 i{}; i < 1000; ++i)
+    {
+      edn("{:id ")(i)(" :name \"user-")(i)("\" :score ")(static_cast<f64>(i) / 3.0)(
+        " :tags #{:a :b} :roles [:admin :dev] :active? true}\n");
+    }
+    edn(']');
+    return edn.release();
+  }
+
+  void add_read_print(suite &s)
+  {
+    /* Strings are boxed, so they can be rooted. */
+    auto const edn{ s.root(make_box(sample_edn())) };
+    auto const bytes{ edn->data.size() };
+    auto const data{ s.root(read::edn::read(edn->data, {}).value) };
+    auto const json{ s.root(make_box(clojure::data::json_native::write_str(data, {}))) };
+
+    /* Throughput benchmarks are per byte, so they stay comparable if the sample changes. */
+    s.add("read/jank reader", bytes, [=] { doNotOptimizeAway(__rt_ctx->read_string(edn->data)); });
+    s.add("read/edn reader", bytes, [=] {
+      doNotOptimizeAway(read::edn::read(edn->data, {}).value);
+    });
+    s.add("read/json reader", json->data.size(), [=] {
+      doNotOptimizeAway(clojure::data::json_native::read_str(json->data, {}));
+    });
+    s.add("print/pr-str", bytes, [=] { doNotOptimizeAway(data.to_code_string()); });
+    s.add("print/str", bytes, [=] { doNotOptimizeAway(data.to_string()); });
+    s.add("print/json writer", json->data.size(), [=] {
+      doNotOptimizeAway(clojure::data::json_native::write_str(data, {}));
+    });
+
+    auto const frozen{ s.root(make_box(freeze(data))) };
+    s.add("print/freeze", frozen->data.size(), [=] { doNotOptimizeAway(freeze(data)); });
+    s.add("read/thaw", frozen->data.size(), [=] { doNotOptimizeAway(thaw(frozen->data).value); });
+  }
+}
@@ -0,0 +1,48 @@
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+  using ankerl::nanobench::doNotOptimizeAway;
+
+  /* Pipelines are written in jank, since that's how they're used. Each is compiled once
+   * and only the call is measured. */
+  static void add_pipeline(suite &s,
+                           jtl::immutable_string const &name,
+                           u64 const batch,
+                           jtl::immutable_string const &code)
+  {
+    auto const fn{ s.root(__rt_ctx->eval_string(code).unwrap()) };
+    s.add(util::format("seq/{}", name), batch, [=] { doNotOptimizeAway(fn.call()); });
+  }
+
+  void add_seqs(suite &s)
+  {
+    add_pipeline(s, "reduce range 1000", 1000, "(fn [] (reduce + (range 1000)))");
+    add_pipeline(s,
+                 "map filter reduce 1000",
+                 1000,
+                 "(fn [] (reduce + (map inc (filter even? (range 1000)))))");
+    add_pipeline(s,
+                 "transduce map filter 1000",
+                 1000,
+                 "(fn [] (transduce (comp (map inc) (filter even?)) + (range 1000)))");
+    add_pipeline(s, "into vector 1000", 1000, "(fn [] (into [] (range 1000)))");
+    add_pipeline(s,
+                 "lazy seq realization 1000",
+                 1000,
+                 "(fn [] (count (doall (map str (range 1000)))))");
+    add_pipeline(s,
+                 "lazy map filter take 1000",
+                 1000,
+                 "(fn [] (dorun (->> (range) (map inc) (filter even?) (take 1000))))");
+    add_pipeline(s, "sort 1000", 1000, "(let [v (shuffle (range 1000))] (fn [] (sort v)))");
+    add_pipeline(s,
+                 "frequencies 1000",
+                 1000,
+                 "(let [v (mapv #(mod % 37) (range 1000))] (fn [] (frequencies v)))");
+  }
+}
@@ -0,0 +1,171 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <jank/bench/suite.hpp>
+#include <clojure/data/json_native.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/sequence_range.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::bench
+{
+  using namespace jank::runtime;
+
+  void suite::add(jtl::immutable_string const &name, std::function<void()> &&run)
+  {
+    benchmarks.push_back({ name, 1, false, std::move(run) });
+  }
+
+  void suite::add(jtl::immutable_string const &name, u64 const batch, std::function<void()> &&run)
+  {
+    benchmarks.push_back({ name, batch, false, std::move(run) });
+  }
+
+  void suite::add_slow(jtl::immutable_string const &name, std::function<void()> &&run)
+  {
+    benchmarks.push_back({ name, 1, true, std::move(run) });
+  }
+
+  native_vector<result> run(suite const &s, options const &opts)
+  {
+    native_vector<result> results;
+    for(auto const &b : s.benchmarks)
+    {
+      if(!opts.filter.empty() && b.name.find(opts.filter) == jtl::immutable_string::npos)
+      {
+        continue;
+      }
+
+      ankerl::nanobench::Bench bench;
+      /* The human readable table goes to stderr, so stdout can be piped as JSON. */
+      bench.output(&std::cerr).batch(b.batch).warmup(1);
+      if(b.slow)
+      {
+        bench.epochs(5).epochIterations(1);
+      }
+      else
+      {
+        bench.minEpochIterations(10);
+      }
+      bench.run(b.name.c_str(), b.run);
+
+      auto const &r{ bench.results().front() };
+      using measure = ankerl::nanobench::Result::Measure;
+      results.push_back({ b.name,
+                          r.median(measure::elapsed) * 1e9 / static_cast<f64>(b.batch),
+                          r.medianAbsolutePercentError(measure::elapsed) * 100.0,
+                          static_cast<u64>(r.sum(measure::iterations)) });
+    }
+    return results;
+  }
+
+  static void write_json_string(jtl::string_builder &buff, jtl::immutable_string const &s)
+  {
+    buff('"');
+    for(auto const c : s)
+    {
+      if(c == '"' || c == '\\')
+      {
+        buff('\\');
+      }
+      buff(c);
+    }
+    buff('"');
+  }
+
+  jtl::immutable_string to_json(native_vector<result> const &results)
+  {
+    jtl::string_builder buff;
+    buff("{\"version\": ");
+    write_json_string(buff, JANK_VERSION);
+    buff(", \"results\": [");
+    for(usize i{}; i < results.size(); ++i)
+    {
+      auto const &r{ results[i] };
+      if(i != 0)
+      {
+        buff(',');
+      }
+      buff("\n  {\"name\": ");
+      write_json_string(buff, r.name);
+      buff(", \"ns_per_op\": ")(r.ns_per_op);
+      buff(", \"err_percent\": ")(r.err_percent);
+      buff(", \"iterations\": ")(static_cast<long long>(r.iterations))('}');
+    }
+    buff("\n]}\n");
+    return buff.release();
+  }
+
+  static native_unordered_map<jtl::immutable_string, result>
+  read_baseline(jtl::immutable_string const &path)
+  {
+    std::ifstream file{ path.c_str() };
+    if(!file)
+    {
+      throw std::runtime_error{ util::format("Unable to open baseline '{}'.", path) };
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+
+    auto const json{ clojure::data::json_native::read_str(contents.str(), {}) };
+    auto const name_key{ make_box("name") };
+    auto const ns_key{ make_box("ns_per_op") };
+    auto const err_key{ make_box("err_percent") };
+
+    native_unordered_map<jtl::immutable_string, result> ret;
+    for(auto const entry : make_sequence_range(get(json, make_box("results"))))
+    {
+      auto const name{ get(entry, name_key).to_string() };
+      ret[name] = { name, get(entry, ns_key).to_real(), get(entry, err_key).to_real(), 0 };
+    }
+    return ret;
+  }
+
+  usize compare(native_vector<result> const &results, options const &opts)
+  {
+    auto const baseline{ read_baseline(opts.baseline) };
+    usize regressions{};
+
+    std::fprintf(stderr, "\n| %10s | %10s | %8s | benchmark\n", "baseline", "current", "change");
+    std::fprintf(stderr, "|-----------:|-----------:|---------:|:----------\n");
+    for(auto const &r : results)
+    {
+      auto const found{ baseline.find(r.name) };
+      if(found == baseline.end())
+      {
+        std::fprintf(stderr,
+                     "| %10s | %10.2f | %8s | %s\n",
+                     "-",
+                     r.ns_per_op,
+                     "new",
+                     r.name.c_str());
+        continue;
+      }
+
+      auto const &old{ found->second };
+      auto const change{ (r.ns_per_op - old.ns_per_op) / old.ns_per_op };
+      /* Noisy benchmarks need to move past their own error to count. */
+      auto const noise{ std::max(r.err_percent, old.err_percent) / 100.0 };
+      auto const regressed{ change > opts.threshold && change > noise };
+      if(regressed)
+      {
+        ++regressions;
+      }
+      std::fprintf(stderr,
+                   "| %10.2f | %10.2f | %+7.1f%% | %s%s\n",
+                   old.ns_per_op,
+                   r.ns_per_op,
+                   change * 100.0,
+                   r.name.c_str(),
+                   regressed ? " (regression)" : "");
+    }
+    std::fprintf(stderr,
+                 "\n%zu regression(s) past the %.0f%% threshold.\n",
+                 regressions,
+                 opts.threshold * 100.0);
+    return regressions;
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <functional>
+
+#include <nanobench.h>
+
+#include <jtl/immutable_string.hpp>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::bench
+{
+  /* A single benchmark in the suite. Names are `group/case`, such as `collections/vector conj 64`,
+   * and they're what baselines are matched on, so renaming a case drops its history. */
+  struct benchmark
+  {
+    jtl::immutable_string name;
+    /* How many operations one call to `run` does, so that results are reported per operation. */
+    u64 batch{ 1 };
+    /* Slow benchmarks, such as JIT compilation, run a fixed handful of times rather than
+     * until nanobench is confident in the timing. */
+    bool slow{};
+    std::function<void()> run;
+  };
+
+  struct result
+  {
+    jtl::immutable_string name;
+    f64 ns_per_op{};
+    f64 err_percent{};
+    u64 iterations{};
+  };
+
+  struct suite
+  {
+    void add(jtl::immutable_string const &name, std::function<void()> &&run);
+    void add(jtl::immutable_string const &name, u64 const batch, std::function<void()> &&run);
+    void add_slow(jtl::immutable_string const &name, std::function<void()> &&run);
+
+    /* The GC doesn't scan what a `std::function` captures, so any objects a benchmark holds
+     * onto need to be rooted here first. */
+    template <typename T>
+    T root(T const o)
+    {
+      roots.push_back(o);
+      return o;
+    }
+
+    native_vector<benchmark> benchmarks;
+    native_vector<runtime::object_ref> roots;
+  };
+
+  struct options
+  {
+    /* Only benchmarks with this in their name are run. */
+    jtl::immutable_string filter;
+    /* Where to write the JSON results. Empty means stdout. */
+    jtl::immutable_string output;
+    /* A previous JSON output to compare against. */
+    jtl::immutable_string baseline;
+    /* How much slower, as a fraction, a benchmark can be before it's a regression. */
+    f64 threshold{ 0.1 };
+    bool list{};
+  };
+
+  native_vector<result> run(suite const &s, options const &opts);
+
+  jtl::immutable_string to_json(native_vector<result> const &results);
+
+  /* Prints a comparison of each result to the same benchmark in the baseline and returns
+   * the number of regressions. */
+  usize compare(native_vector<result> const &results, options const &opts);
+
+  /* Each group of benchmarks adds itself to the suite. */
+  void add_collections(suite &s);
+  void add_seqs(suite &s);
+  void add_math(suite &s);
+  void add_dispatch(suite &s);
+  void add_read_print(suite &s);
+  void add_keywords(suite &s);
+  void add_jit(suite &s);
+}
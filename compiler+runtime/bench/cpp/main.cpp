@@ -0,0 +1,154 @@
+#include <cstdlib>
+#include <fstream>
+#include <string_view>
+
+#include <jank/c_api.h>
+#include <jank/bench/suite.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/util/fmt/print.hpp>
+#include <clojure/core_native.hpp>
+
+#ifdef JANK_PHASE_2
+extern "C" void jank_load_clojure_core();
+#endif
+
+static constexpr char const *usage{ R"(Usage: jank-bench [options]
+
+Runs jank's benchmark suite. A table of results is printed to stderr and the
+results are written as JSON.
+
+Options:
+  --filter <text>      Only run benchmarks with <text> in their name.
+  --output <file>      Write the JSON results to <file>, rather than stdout.
+  --baseline <file>    Compare against the JSON results in <file>. Exits with 1
+                       if any benchmark regressed.
+  --threshold <pct>    How much slower a benchmark can get before it counts as a
+                       regression. Defaults to 10.
+  --list               List the benchmarks, without running them.
+  --help               Show this message.)" };
+
+static jtl::option<jank::bench::options> parse_opts(int const argc, char const **argv)
+{
+  jank::bench::options opts;
+  for(int i{ 1 }; i < argc; ++i)
+  {
+    std::string_view const arg{ argv[i] };
+    auto const value{ [&]() -> char const * {
+      if(i + 1 == argc)
+      {
+        throw std::runtime_error{ jank::util::format("Missing value for {}.", argv[i]) };
+      }
+      return argv[++i];
+    } };
+
+    if(arg == "--filter")
+    {
+      opts.filter = value();
+    }
+    else if(arg == "--output")
+    {
+      opts.output = value();
+    }
+    else if(arg == "--baseline")
+    {
+      opts.baseline = value();
+    }
+    else if(arg == "--threshold")
+    {
+      opts.threshold = std::strtod(value(), nullptr) / 100.0;
+    }
+    else if(arg == "--list")
+    {
+      opts.list = true;
+    }
+    else
+    {
+      if(arg != "--help")
+      {
+        jank::util::println(stderr, "Unknown option: {}\n", argv[i]);
+      }
+      jank::util::println(stderr, usage);
+      return jtl::none;
+    }
+  }
+  return opts;
+}
+
+/* NOLINTNEXTLINE(bugprone-exception-escape): println can throw. */
+int main(int const argc, char const **argv)
+try
+{
+  /* Generating debug info drastically slows down JIT compilation. */
+  jank::util::cli::opts.debug = false;
+
+  return jank_init_dynamic(argc, argv, true, nullptr, 0, [](int const argc, char const **argv) {
+    auto const parsed{ parse_opts(argc, argv) };
+    if(parsed.is_none())
+    {
+      return 1;
+    }
+    auto const &opts{ parsed.unwrap() };
+
+    jank_load_clojure_core_native();
+#ifdef JANK_PHASE_2
+    jank_load_clojure_core();
+#else
+    jank::runtime::__rt_ctx->load_module("clojure.core", jank::runtime::module::origin::latest)
+      .expect_ok();
+#endif
+    jank::runtime::__rt_ctx->in_ns_var->deref().call(
+      jank::runtime::make_box<jank::runtime::obj::symbol>("user"));
+    jank::runtime::__rt_ctx->intern_var("clojure.core", "refer")
+      .expect_ok()
+      .call(jank::runtime::make_box<jank::runtime::obj::symbol>("clojure.core"));
+
+    jank::bench::suite s;
+    jank::bench::add_collections(s);
+    jank::bench::add_seqs(s);
+    jank::bench::add_math(s);
+    jank::bench::add_dispatch(s);
+    jank::bench::add_read_print(s);
+    jank::bench::add_keywords(s);
+    jank::bench::add_jit(s);
+
+    if(opts.list)
+    {
+      for(auto const &b : s.benchmarks)
+      {
+        jank::util::println("{}", b.name);
+      }
+      return 0;
+    }
+
+    auto const results{ jank::bench::run(s, opts) };
+    auto const json{ jank::bench::to_json(results) };
+    if(opts.output.empty())
+    {
+      jank::util::print("{}", json);
+    }
+    else
+    {
+      std::ofstream out{ opts.output.c_str() };
+      out << json;
+    }
+
+    if(!opts.baseline.empty() && jank::bench::compare(results, opts) != 0)
+    {
+      return 1;
+    }
+    return 0;
+  });
+}
+catch(std::exception const &e)
+{
+  jank::util::println(stderr, "{}", e.what());
+  return 1;
+}
+/* Most exceptions are being caught in `jank_init_dynamic`.
+ * This piece here catches rest of them. */
+catch(...)
+{
+  jank::util::println("Unknown exception thrown");
+  return 1;
+}
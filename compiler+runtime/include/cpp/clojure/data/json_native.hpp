@@ -15,6 +15,8 @@ namespace clojure::data::json_native
     object_ref eof_value{};
     object_ref key_fn{};
     object_ref value_fn{};
+    /* Set when `key_fn` is `keyword`, so that keys can be interned without calling it. */
+    bool keyword_keys{ false };
   };
 
   object_ref read_str(jtl::immutable_string const &string, read_options const &opts);
@@ -30,4 +32,6 @@ namespace clojure::data::json_native
   };
 
   jtl::immutable_string write_str(object_ref const x, write_options const &opts);
+  /* Writes to a writer object, such as `*out*`, as the JSON is generated. */
+  object_ref write(object_ref const x, object_ref const out, write_options const &opts);
 }
@@ -27,6 +27,8 @@ namespace jank::analyze::expr
     /* Is there any named recrusion within this function (tail or otherwise)?
      * This counts any named recursion reference, not just calls. */
     bool is_named_recursive{};
+    /* Does this function contain any cpp/raw? If so, we can't know which locals it uses. */
+    bool has_cpp_raw{};
     /* TODO: is_pure */
   };
 
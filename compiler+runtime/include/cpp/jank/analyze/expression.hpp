@@ -3,6 +3,7 @@
 #include <jtl/ptr.hpp>
 
 #include <jank/runtime/object.hpp>
+#include <jank/util/arena.hpp>
 
 namespace jank::analyze
 {
@@ -171,7 +172,7 @@ namespace jank::analyze
   }
 
   /* Common base class for every expression. */
-  struct expression
+  struct expression : util::arena_allocated
   {
     static constexpr bool pointer_free{ false };
 
@@ -4,6 +4,7 @@
 #include <jtl/option.hpp>
 
 #include <jank/runtime/obj/symbol.hpp>
+#include <jank/util/arena.hpp>
 
 namespace jank::runtime
 {
@@ -58,7 +59,7 @@ namespace jank::analyze
 
   using local_capture_ref = jtl::ref<local_capture>;
 
-  struct local_frame
+  struct local_frame : util::arena_allocated
   {
     enum class frame_type : u8
     {
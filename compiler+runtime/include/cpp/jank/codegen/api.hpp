@@ -16,6 +16,28 @@
 jank::runtime::var_ref _jank_var(char const *sym);
 jank::runtime::var_ref _jank_var_owned(char const *sym);
 
+/* When loading a module, we need to initialize every lifted var and every lifted keyword.
+ * Rather than generating one call per global, which each need to lock and look up the
+ * namespace, codegen describes them in a constant table. These tables require no
+ * initialization code of their own, so they end up in the read-only data of the module.
+ * Each slot is initialized in place, since these globals start out as `_jank_null`. */
+struct _jank_lifted_var
+{
+  char const *qualified_name{};
+  jank::runtime::var_ref *slot{};
+  bool owned{};
+};
+
+void _jank_vars(_jank_lifted_var const * const vars, jank::u64 const count);
+
+struct _jank_lifted_keyword
+{
+  char const *qualified_name{};
+  jank::runtime::obj::keyword_ref *slot{};
+};
+
+void _jank_keywords(_jank_lifted_keyword const * const keywords, jank::u64 const count);
+
 jank::runtime::obj::keyword_ref _jank_keyword(char const * const ns, char const * const name);
 
 jank::runtime::obj::symbol_ref _jank_symbol(char const * const ns, char const * const name);
@@ -51,6 +73,37 @@ jank::runtime::obj::persistent_hash_map_ref _jank_hmap(jank::u64 const pairs, ..
 jank::runtime::obj::persistent_hash_map_ref
 _jank_hmap(char const * const meta, jank::u64 const pairs, ...);
 
+/* Non-constant collection literals hand over their elements as one contiguous array on the
+ * stack, rather than as varargs, so the collection can be built in bulk. Maps take their
+ * keys and values interleaved. */
+jank::runtime::obj::persistent_vector_ref
+_jank_vec_array(jank::runtime::object_ref const * const elems, jank::u64 const count);
+jank::runtime::obj::persistent_vector_ref
+_jank_vec_array(char const * const meta,
+                jank::runtime::object_ref const * const elems,
+                jank::u64 const count);
+
+jank::runtime::obj::persistent_hash_set_ref
+_jank_hset_array(jank::runtime::object_ref const * const elems, jank::u64 const count);
+jank::runtime::obj::persistent_hash_set_ref
+_jank_hset_array(char const * const meta,
+                 jank::runtime::object_ref const * const elems,
+                 jank::u64 const count);
+
+jank::runtime::obj::persistent_array_map_ref
+_jank_amap_array(jank::runtime::object_ref const * const kvs, jank::u64 const pairs);
+jank::runtime::obj::persistent_array_map_ref
+_jank_amap_array(char const * const meta,
+                 jank::runtime::object_ref const * const kvs,
+                 jank::u64 const pairs);
+
+jank::runtime::obj::persistent_hash_map_ref
+_jank_hmap_array(jank::runtime::object_ref const * const kvs, jank::u64 const pairs);
+jank::runtime::obj::persistent_hash_map_ref
+_jank_hmap_array(char const * const meta,
+                 jank::runtime::object_ref const * const kvs,
+                 jank::u64 const pairs);
+
 jank::runtime::obj::jit_function_ref _jank_fn(jank::runtime::callable_arity_flags const flags);
 jank::runtime::obj::jit_variadic_function_ref
 _jank_vfn(jank::runtime::callable_arity_flags const flags);
@@ -5,6 +5,7 @@
 
 #include <jank/read/source.hpp>
 #include <jank/runtime/object.hpp>
+#include <jank/util/arena.hpp>
 
 namespace jank::analyze
 {
@@ -53,6 +54,7 @@ namespace jank::ir
     var_ref,
     type_erase,
     dynamic_call,
+    fused_reduce,
     named_recursion,
     recursion_reference,
     truthy,
@@ -86,7 +88,7 @@ namespace jank::ir
     cpp_delete,
   };
 
-  struct instruction
+  struct instruction : util::arena_allocated
   {
     instruction(instruction_kind const kind, identifier const &name, jtl::ptr<void> const type);
     instruction(instruction_kind const kind,
@@ -391,6 +393,45 @@ namespace jank::ir
 
     using dynamic_call_ref = jtl::ref<dynamic_call>;
 
+    /* A `reduce` over a chain of `map`, `filter`, `remove` and `take` calls, which has been
+     * fused into a single reducing step by the `fuse_seq_chains` pass. None of the
+     * intermediate lazy sequences are built. The stages are in the order in which each
+     * element goes through them, starting from the source. */
+    struct fused_reduce : instruction
+    {
+      enum class stage_kind : u8
+      {
+        map,
+        filter,
+        remove,
+        take
+      };
+
+      struct stage
+      {
+        stage_kind kind{};
+        /* The fn for `map`, `filter` and `remove`. The count for `take`. */
+        identifier value;
+      };
+
+      fused_reduce(identifier const &name,
+                   jtl::ptr<void> const type,
+                   read::source const &location,
+                   identifier const &fn,
+                   jtl::option<identifier> const &init,
+                   identifier const &source,
+                   native_vector<stage> &&stages);
+
+      void print(jtl::string_builder &sb, usize indent) const override;
+
+      identifier fn;
+      jtl::option<identifier> init;
+      identifier source;
+      native_vector<stage> stages;
+    };
+
+    using fused_reduce_ref = jtl::ref<fused_reduce>;
+
     struct named_recursion : instruction
     {
       named_recursion(identifier const &name,
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace jank::ir
+{
+  struct function;
+
+  void fuse_seq_chains(function &fn);
+}
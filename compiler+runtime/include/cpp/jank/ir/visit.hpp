@@ -47,6 +47,8 @@ namespace jank::ir
         return f(jtl::static_ref_cast<inst::type_erase>(i), std::forward<Args>(args)...);
       case instruction_kind::dynamic_call:
         return f(jtl::static_ref_cast<inst::dynamic_call>(i), std::forward<Args>(args)...);
+      case instruction_kind::fused_reduce:
+        return f(jtl::static_ref_cast<inst::fused_reduce>(i), std::forward<Args>(args)...);
       case instruction_kind::named_recursion:
         return f(jtl::static_ref_cast<inst::named_recursion>(i), std::forward<Args>(args)...);
       case instruction_kind::recursion_reference:
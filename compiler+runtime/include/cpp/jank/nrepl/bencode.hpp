@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+
+#include <jtl/option.hpp>
+#include <jtl/immutable_string_view.hpp>
+#include <jtl/string_builder.hpp>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::nrepl::bencode
+{
+  /* An incremental bencode decoder. Bytes are fed in as they arrive off the socket and
+   * whole values are pulled back out once they're complete. Values are decoded straight
+   * from the buffered bytes, so a byte string is a single copy into a persistent string.
+   *
+   * Byte strings become strings, integers become integers, lists become vectors and
+   * dictionaries become maps. Malformed input throws. */
+  struct decoder
+  {
+    void feed(jtl::immutable_string_view const &bytes);
+
+    /* Decodes the next whole value, if one has been buffered. */
+    jtl::option<runtime::object_ref> next();
+
+    /* How many bytes have been fed, but not yet decoded. */
+    usize buffered() const;
+
+    std::string buffer;
+    usize offset{};
+    /* When the last attempt ran out of input, we know how much we'll need before it
+     * could succeed. Until then, there's no point trying again. This keeps large byte
+     * strings, which arrive over many reads, from being rescanned on every read. */
+    usize required{};
+  };
+
+  void encode(runtime::object_ref const o, jtl::string_builder &sb);
+
+  /* These are for jank code. `decode` returns `[value remaining]`, where remaining is nil
+   * if everything was consumed, or nil if there isn't a whole value in the string. */
+  runtime::object_ref encode(runtime::object_ref const o);
+  runtime::object_ref decode(runtime::object_ref const s);
+}
@@ -5,6 +5,8 @@
 
 #include <jtl/immutable_string.hpp>
 
+#include <jank/runtime/object.hpp>
+
 namespace jank::nrepl::server
 {
   struct native_client
@@ -36,6 +38,15 @@ namespace jank::nrepl::server
     /* Block until a client connects. */
     native_client *accept() const;
 
+    /* Serve every client from an event loop, blocking until `stop` is called. Sockets are
+     * serviced on the calling thread, without blocking, and requests are decoded from
+     * bencode natively. Each request is passed to `handler`, on one of `worker_count`
+     * worker threads, and the responses it returns are encoded and written back. A
+     * connection's requests are handled in order, but different connections are handled
+     * concurrently, so a long eval doesn't hold up anyone else. */
+    void serve(runtime::object_ref const handler, usize const worker_count) const;
+    void stop() const;
+
     std::shared_ptr<impl> impl_;
   };
 }
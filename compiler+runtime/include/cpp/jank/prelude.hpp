@@ -10,6 +10,11 @@
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/meta.hpp>
 #include <jank/runtime/core/call.hpp>
+#include <jank/runtime/core/call_site.hpp>
+#include <jank/runtime/core/io.hpp>
+#include <jank/runtime/core/async.hpp>
+#include <jank/runtime/core/agent.hpp>
+#include <jank/runtime/core/stm.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/codegen/api.hpp>
 #include <jank/util/scope_exit.hpp>
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+/* A data-only reader for EDN. It shares the lexer with the code reader, but it doesn't
+ * attach source positions as meta and it doesn't know about syntax quoting, reader
+ * conditionals, anonymous fn shorthand, and the rest of the code-only syntax. This makes it
+ * much cheaper for reading large amounts of data. It never evaluates anything, either, and
+ * it limits how deeply forms can nest, so it's safe to use on untrusted input.
+ *
+ * Input is read in place, so reading from a mapped file never copies the file. */
+namespace jank::read::edn
+{
+  struct options
+  {
+    /* Built from a `clojure.edn` style opts map, which supports `:eof`, `:readers`, and
+     * `:default`. */
+    static options from_map(runtime::object_ref const opts);
+
+    /* When there's nothing left to read, we return `eof` unless `eof_throw` is set. */
+    runtime::object_ref eof{};
+    bool eof_throw{ true };
+    /* A map of tag symbols to reader fns. These are checked before `#inst` and `#uuid`. */
+    runtime::object_ref readers{};
+    /* Called with the tag and the value when no reader matches the tag. */
+    runtime::object_ref default_fn{};
+  };
+
+  struct read_result
+  {
+    runtime::object_ref value;
+    /* The number of bytes of the input which were used to read `value`. */
+    usize consumed{};
+  };
+
+  /* Reads the first form in `input`. */
+  read_result read(jtl::immutable_string_view const &input, options const &opts);
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace jank::runtime::behavior
+{
+  /* Associative collections which can walk their own storage, handing each key/value
+   * pair to the reducing fn directly. This avoids allocating a seq, plus a map entry
+   * vector per element, which is what the generic seq-based `reduce-kv` needs. */
+  template <typename T>
+  concept kv_reducible = requires(T * const t) {
+    { t->kv_reduce(object_ref{}, object_ref{}) } -> std::convertible_to<object_ref>;
+  };
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace jank::runtime::behavior
+{
+  /* Collections which can walk their own storage, handing each element to the reducing fn
+   * directly. This avoids allocating a seq node per element, which is what the generic
+   * seq-based `reduce` needs. This is Clojure's IReduceInit. */
+  template <typename T>
+  concept reducible = requires(T * const t) {
+    { t->reduce(object_ref{}, object_ref{}) } -> std::convertible_to<object_ref>;
+  };
+}
@@ -68,7 +68,8 @@ namespace jank::runtime
     jtl::result<var_ref, jtl::immutable_string>
     intern_owned_var(jtl::immutable_string const &ns, jtl::immutable_string const &name);
     var_ref find_var(obj::symbol_ref const);
-    var_ref find_var(jtl::immutable_string const &ns, jtl::immutable_string const &name);
+    /* Doesn't allocate, so this is suitable for resolving vars by name at run time. */
+    var_ref find_var(jtl::immutable_string_view const &ns, jtl::immutable_string_view const &name);
 
     jtl::result<obj::keyword_ref, jtl::immutable_string>
     intern_keyword(jtl::immutable_string const &ns,
@@ -142,6 +143,11 @@ namespace jank::runtime
     jtl::string_result<void> push_thread_bindings(obj::persistent_hash_map_ref const bindings);
     void pop_thread_bindings();
     obj::persistent_hash_map_ref get_thread_bindings() const;
+    /* Moves the current thread's binding frames out, leaving it with none. Along with
+     * `restore_thread_bindings`, this is how a fiber takes its bindings from one thread to
+     * another. */
+    native_list<thread_binding_frame> take_thread_bindings();
+    void restore_thread_bindings(native_list<thread_binding_frame> &&frames);
 
     /*** XXX: Everything here is immutable after initialization. ***/
     jtl::immutable_string binary_version;
@@ -167,7 +173,8 @@ namespace jank::runtime
     var_ref stream_var;
 
     /*** XXX: Everything here is thread-safe. ***/
-    folly::Synchronized<native_unordered_map<obj::symbol_ref, ns_ref>> namespaces;
+    /* Maps ns symbols to namespaces. Reads don't lock. See `detail::snapshot`. */
+    runtime::detail::snapshot<obj::persistent_hash_map> namespaces;
     folly::Synchronized<native_unordered_map<jtl::immutable_string, obj::keyword_ref>> keywords;
     folly::Synchronized<native_unordered_map<std::thread::id, native_list<thread_binding_frame>>>
       thread_binding_frames;
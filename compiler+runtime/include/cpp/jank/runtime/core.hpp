@@ -15,6 +15,7 @@ namespace jank::runtime
   namespace obj
   {
     using atom_ref = oref<struct atom>;
+    using buffered_writer_ref = oref<struct buffered_writer>;
     using future_ref = oref<struct future>;
     using keyword_ref = oref<struct keyword>;
     using native_vector_sequence_ref = oref<struct native_vector_sequence>;
@@ -24,6 +25,7 @@ namespace jank::runtime
     using tagged_literal_ref = oref<struct tagged_literal>;
     using uuid_ref = oref<struct uuid>;
     using volatile_ref = oref<struct volatile_>;
+    using striped_counter_ref = oref<struct striped_counter>;
     using exception_info_ref = oref<struct exception_info>;
   }
 
@@ -42,11 +44,16 @@ namespace jank::runtime
   obj::symbol_ref to_unqualified_symbol(object_ref const o);
   obj::symbol_ref to_qualified_symbol(object_ref const ns, object_ref const name);
 
+  /* Writes the string to a writer, which is anything `*out*` can be bound to. */
+  void write_to(object_ref const out, jtl::immutable_string_view const &s);
   object_ref print(object_ref const args);
   object_ref print1(object_ref const o);
   object_ref println(object_ref const args);
   object_ref pr(object_ref const args);
   object_ref prn(object_ref const args);
+  object_ref newline();
+  object_ref flush();
+  obj::buffered_writer_ref make_buffered_writer(object_ref const out);
   jtl::immutable_string format(jtl::immutable_string const &format, object_ref const args);
 
   obj::persistent_string_ref subs(object_ref const s, object_ref const start);
@@ -109,6 +116,13 @@ namespace jank::runtime
   object_ref vswap(obj::volatile_ref const v, object_ref const fn, object_ref const args);
   object_ref vreset(obj::volatile_ref const v, object_ref const new_val);
 
+  obj::striped_counter_ref striped_counter();
+  bool is_striped_counter(object_ref const o);
+  object_ref striped_counter_add(object_ref const c, object_ref const n);
+  i64 striped_counter_sum(object_ref const c);
+  object_ref striped_counter_reset(object_ref const c);
+  i64 striped_counter_sum_then_reset(object_ref const c);
+
   void push_thread_bindings(object_ref const o);
   void pop_thread_bindings();
   object_ref get_thread_bindings();
@@ -145,6 +159,9 @@ namespace jank::runtime
 
   object_ref read_string(object_ref const form_string, object_ref const opts);
   object_ref read_file(object_ref const file_path, object_ref const opts);
+  /* Data-only EDN reading, for clojure.edn. */
+  object_ref edn_read_string(object_ref const s, object_ref const opts);
+  object_ref edn_read(object_ref const rdr, object_ref const opts);
 
   obj::character_ref to_char(object_ref const x);
 
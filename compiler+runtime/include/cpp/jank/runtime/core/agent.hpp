@@ -0,0 +1,34 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime
+{
+  namespace obj
+  {
+    using agent_ref = oref<struct agent>;
+  }
+
+  obj::agent_ref agent(object_ref const state);
+  bool is_agent(object_ref const o);
+
+  /* The args are a seq of what to pass the fn after the agent's state, or nil. `send` runs
+   * the action on the fixed task pool, while `send-off` runs it on the elastic one. */
+  object_ref agent_send(object_ref const a, object_ref const fn, object_ref const args);
+  object_ref agent_send_off(object_ref const a, object_ref const fn, object_ref const args);
+  i64 release_pending_sends();
+
+  object_ref agent_error(object_ref const a);
+  object_ref restart_agent(object_ref const a, object_ref const new_state, bool const clear);
+  object_ref set_agent_error_handler(object_ref const a, object_ref const handler);
+  object_ref get_agent_error_handler(object_ref const a);
+  /* The mode is either :fail or :continue. */
+  object_ref set_agent_error_mode(object_ref const a, object_ref const mode);
+  object_ref get_agent_error_mode(object_ref const a);
+
+  /* These block until every action sent so far to each of the agents has run. The timed
+   * version returns false if the time ran out first. */
+  object_ref await_agents(object_ref const agents);
+  bool await_agents_for(object_ref const ms, object_ref const agents);
+  object_ref shutdown_agents();
+}
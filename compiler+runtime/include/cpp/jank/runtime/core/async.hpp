@@ -0,0 +1,45 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime
+{
+  namespace obj
+  {
+    using channel_ref = oref<struct channel>;
+  }
+
+  /* The kind is nil for an unbuffered channel, otherwise one of :fixed, :dropping or
+   * :sliding. A :fixed buffer of size 0 is the same as no buffer. */
+  obj::channel_ref chan(object_ref const kind, object_ref const n);
+  bool is_chan(object_ref const o);
+
+  /* These never block. The callback, which may be nil, is called on the task pool. */
+  bool chan_put(object_ref const ch, object_ref const val, object_ref const callback);
+  object_ref chan_take(object_ref const ch, object_ref const callback);
+  bool chan_offer(object_ref const ch, object_ref const val);
+  object_ref chan_poll(object_ref const ch);
+  object_ref chan_close(object_ref const ch);
+
+  /* These wait until they complete. Within a go block, the go block parks and its worker
+   * is free to run something else. Otherwise, the current thread blocks. When that's a task
+   * on the task pool, a spare worker stands in while we wait. */
+  bool chan_put_blocking(object_ref const ch, object_ref const val);
+  object_ref chan_take_blocking(object_ref const ch);
+  /* Each port is either a channel, to take from, or a [channel val] vector, to put to.
+   * Exactly one of them completes and the result is [val port]. Unless priority is truthy,
+   * the ports are tried in a random order. If has_default is truthy and no port can
+   * complete right away, the result is [default :default] instead. */
+  object_ref alts(object_ref const ports,
+                  object_ref const priority,
+                  object_ref const has_default,
+                  object_ref const default_val);
+
+  /* A channel which closes itself after the given number of milliseconds. */
+  obj::channel_ref timeout(object_ref const ms);
+
+  /* Runs a fn of no args on the task pool. */
+  object_ref dispatch(object_ref const fn);
+  /* Runs a fn of no args on a fiber, on the task pool, so it can park. */
+  object_ref go_dispatch(object_ref const fn);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <initializer_list>
+
 #include <jtl/option.hpp>
 
 #include <jank/runtime/object.hpp>
@@ -19,6 +21,21 @@ namespace jank::runtime
 
   object_ref apply_to(object_ref const source, object_ref const args);
   object_ref apply_to(object_ref const source, object_ref const args, bool const already_packed);
+  /* These are `(apply f a args)` and friends, without consing the leading args onto `args`. */
+  object_ref apply_to(object_ref const source, object_ref const a1, object_ref const args);
+  object_ref apply_to(object_ref const source,
+                      object_ref const a1,
+                      object_ref const a2,
+                      object_ref const args);
+  object_ref apply_to(object_ref const source,
+                      object_ref const a1,
+                      object_ref const a2,
+                      object_ref const a3,
+                      object_ref const args);
+
+  /* A variadic arity which never refers to its rest param gets this flag. Callers then pass
+   * nil for the rest param, rather than packing the extra args into a seq no one will read. */
+  constexpr callable_arity_flags const variadic_rest_unused_flag{ 0b00100000 };
 
   static constexpr callable_arity_flags mask_variadic_arity(u8 const pos)
   {
@@ -41,10 +58,27 @@ namespace jank::runtime
     return (arity_flags & 0b01000000);
   }
 
+  static constexpr bool is_variadic_rest_unused(callable_arity_flags const arity_flags)
+  {
+    return (arity_flags & variadic_rest_unused_flag);
+  }
+
   static constexpr callable_arity_flags build_arity_flags(u8 const highest_fixed_arity,
                                                           bool const is_variadic,
-                                                          bool const is_variadic_ambiguous)
+                                                          bool const is_variadic_ambiguous,
+                                                          bool const is_variadic_rest_unused
+                                                          = false)
   {
-    return (is_variadic << 7) | (is_variadic_ambiguous << 6) | highest_fixed_arity;
+    return (is_variadic << 7) | (is_variadic_ambiguous << 6) | (is_variadic_rest_unused << 5)
+      | highest_fixed_arity;
   }
+
+  /* Packs the extra args of a call to a variadic arity into the seq for its rest param. The
+   * args are only copied out of the caller's frame when the callee will actually read them.
+   * `more` holds any args beyond `max_params`, as packed by the caller or by `apply`. */
+  object_ref pack_rest(callable_arity_flags const arity_flags,
+                       std::initializer_list<object_ref> const args);
+  object_ref pack_rest(callable_arity_flags const arity_flags,
+                       std::initializer_list<object_ref> const args,
+                       object_ref const more);
 }
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <atomic>
+
+#include <jank/runtime/core/call.hpp>
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/runtime/obj/jit_closure.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+
+namespace jank::runtime
+{
+  namespace detail
+  {
+    /* Type feedback for a single dynamic call site in generated code. The first callee seen
+     * at the site is remembered and, while later calls see that same callee, they skip the
+     * virtual `call` and go straight to the callee's arity. The same goes for the type of
+     * the callee, when it's a map being called to look up a key.
+     *
+     * When a guard fails, the call takes the generic path and the site learns the new
+     * callee. After `max_misses` failed guards, the site is considered megamorphic and only
+     * ever takes the generic path from then on.
+     *
+     * The cache holds onto its callee, so it must be created with `create`, which allocates
+     * it where the GC will see it. Generated code can't hold GC roots in its own statics. */
+    struct call_site_cache
+    {
+      static constexpr u32 max_misses{ 8 };
+
+      static call_site_cache &create();
+
+      /* Returns true if the site has become megamorphic. */
+      bool miss();
+      void observe_callee(object_ref const fn);
+      void observe_type(object_type const type);
+
+      std::atomic<object *> callee{};
+      std::atomic<object_type> callee_type{ object_type::nil };
+      std::atomic<u32> misses{};
+      std::atomic_bool megamorphic{};
+    };
+
+    template <usize N, typename F>
+    auto jit_arity(F const * const f)
+    {
+      if constexpr(N == 0)
+      {
+        return f->arity_0;
+      }
+      else if constexpr(N == 1)
+      {
+        return f->arity_1;
+      }
+      else if constexpr(N == 2)
+      {
+        return f->arity_2;
+      }
+      else if constexpr(N == 3)
+      {
+        return f->arity_3;
+      }
+      else if constexpr(N == 4)
+      {
+        return f->arity_4;
+      }
+      else if constexpr(N == 5)
+      {
+        return f->arity_5;
+      }
+      else if constexpr(N == 6)
+      {
+        return f->arity_6;
+      }
+      else if constexpr(N == 7)
+      {
+        return f->arity_7;
+      }
+      else if constexpr(N == 8)
+      {
+        return f->arity_8;
+      }
+      else if constexpr(N == 9)
+      {
+        return f->arity_9;
+      }
+      else
+      {
+        static_assert(N == 10);
+        return f->arity_10;
+      }
+    }
+
+    template <typename... Args>
+    [[gnu::noinline]]
+    object_ref call_site_miss(call_site_cache &cache, object_ref const fn, Args const... args)
+    {
+      if(!cache.miss())
+      {
+        switch(fn.get_type())
+        {
+          case object_type::jit_function:
+            if(jit_arity<sizeof...(Args)>(expect_object<obj::jit_function>(fn).data))
+            {
+              cache.observe_callee(fn);
+            }
+            break;
+          case object_type::jit_closure:
+            if(jit_arity<sizeof...(Args)>(expect_object<obj::jit_closure>(fn).data))
+            {
+              cache.observe_callee(fn);
+            }
+            break;
+          case object_type::persistent_array_map:
+            cache.observe_type(object_type::persistent_array_map);
+            break;
+          default:
+            break;
+        }
+      }
+      return fn.call(args...);
+    }
+  }
+
+  /* This is what a `dynamic_call` instruction compiles to, when call site caches are
+   * enabled. Semantically, it's the same as `fn.call(args...)`. */
+  template <typename... Args>
+  [[gnu::always_inline]]
+  inline object_ref
+  dynamic_call(detail::call_site_cache &cache, object_ref const fn, Args const... args)
+  {
+    if constexpr(sizeof...(Args) > max_params)
+    {
+      return fn.call(args...);
+    }
+    else
+    {
+      /* Only jit functions and closures which have this arity are ever cached. */
+      if(fn.raw() == cache.callee.load(std::memory_order_relaxed))
+      {
+        if(fn.get_type() == object_type::jit_function)
+        {
+          return detail::jit_arity<sizeof...(Args)>(expect_object<obj::jit_function>(fn).data)(
+            fn,
+            args...);
+        }
+        return detail::jit_arity<sizeof...(Args)>(expect_object<obj::jit_closure>(fn).data)(
+          fn,
+          args...);
+      }
+
+      if constexpr(sizeof...(Args) == 1 || sizeof...(Args) == 2)
+      {
+        if(fn.get_type() == object_type::persistent_array_map
+           && cache.callee_type.load(std::memory_order_relaxed)
+             == object_type::persistent_array_map)
+        {
+          return expect_object<obj::persistent_array_map>(fn)->get(args...);
+        }
+      }
+
+      if(cache.megamorphic.load(std::memory_order_relaxed))
+      {
+        return fn.call(args...);
+      }
+      return detail::call_site_miss(cache, fn, args...);
+    }
+  }
+}
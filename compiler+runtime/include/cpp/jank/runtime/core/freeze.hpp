@@ -0,0 +1,41 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+/* A compact binary encoding for jank data, in the spirit of Nippy and Transit. Anything
+ * which can be written as EDN can be frozen, and thawing it gives back an equal value
+ * without going through the reader.
+ *
+ * Each value is a one byte tag followed by its payload. Counts and integers are varints.
+ * Keywords and symbols are written in full the first time they're seen and then only as
+ * an index into the ones seen so far, so data with many repeated keys stays small.
+ *
+ * Sorted collections are thawed with the default ordering, which is the only one they
+ * can currently have. Input with duplicate map keys or set items is rejected as corrupt. */
+namespace jank::runtime
+{
+  namespace obj
+  {
+    using file_writer_ref = oref<struct file_writer>;
+    using persistent_string_ref = oref<struct persistent_string>;
+  }
+
+  struct thaw_result
+  {
+    object_ref value;
+    /* The number of bytes of the input which were used to thaw `value`. */
+    usize consumed{};
+  };
+
+  /* Appends the frozen form of `o` to `buff`. When `sink` is set, `buff` is drained into it
+   * as it fills up, so the whole encoding never needs to be in memory at once. */
+  void freeze(object_ref const o, jtl::string_builder &buff, obj::file_writer_ref const sink);
+  jtl::immutable_string freeze(object_ref const o);
+  /* Thaws the first frozen value in `input`. */
+  thaw_result thaw(jtl::immutable_string_view const &input);
+
+  obj::persistent_string_ref freeze_str(object_ref const o);
+  object_ref freeze_to(object_ref const w, object_ref const o);
+  object_ref thaw_str(object_ref const s);
+  object_ref thaw_from(object_ref const rdr);
+}
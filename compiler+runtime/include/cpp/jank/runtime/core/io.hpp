@@ -0,0 +1,31 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime
+{
+  namespace obj
+  {
+    using file_reader_ref = oref<struct file_reader>;
+    using file_writer_ref = oref<struct file_writer>;
+    using persistent_string_ref = oref<struct persistent_string>;
+  }
+
+  obj::file_reader_ref open_reader(object_ref const path);
+  obj::file_writer_ref open_writer(object_ref const path, object_ref const append);
+  bool is_reader(object_ref const o);
+  bool is_writer(object_ref const o);
+
+  object_ref read_line(object_ref const rdr);
+  object_ref read_line_chunk(object_ref const rdr);
+  object_ref load_reader(object_ref const rdr);
+
+  object_ref write_string(object_ref const w, object_ref const s);
+  object_ref flush_writer(object_ref const w);
+
+  /* Closes either a reader or a writer. Closing more than once is a no-op. */
+  object_ref close_stream(object_ref const o);
+
+  obj::persistent_string_ref slurp(object_ref const path);
+  object_ref spit(object_ref const path, object_ref const content, object_ref const append);
+}
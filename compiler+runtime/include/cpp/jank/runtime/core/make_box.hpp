@@ -41,7 +41,7 @@ namespace jank::runtime
   [[gnu::flatten, gnu::hot]]
   inline auto make_box(char const i)
   {
-    return make_box<obj::character>(i);
+    return obj::character::create(i);
   }
 
   [[gnu::flatten, gnu::hot]]
@@ -6,11 +6,18 @@
 
 namespace jank::runtime
 {
+  namespace detail
+  {
+    struct shape_slot_cache;
+  }
+
   namespace obj
   {
     using persistent_list_ref = oref<struct persistent_list>;
     using persistent_vector_ref = oref<struct persistent_vector>;
+    using persistent_hash_map_ref = oref<struct persistent_hash_map>;
     using keyword_ref = oref<struct keyword>;
+    using string_rope_ref = oref<struct string_rope>;
   }
 
   template <typename T>
@@ -107,6 +114,14 @@ namespace jank::runtime
     return m.get(key, fallback);
   }
 
+  /* The same as `(kw m)`, for a literal keyword `kw`. Each call site has its own cache, so that
+   * shape maps which share a shape can find `kw` without a scan. */
+  object_ref keyword_get(object_ref const kw, detail::shape_slot_cache &cache, object_ref const m);
+  object_ref keyword_get(object_ref const kw,
+                         detail::shape_slot_cache &cache,
+                         object_ref const m,
+                         object_ref const fallback);
+
   object_ref get_in(object_ref const m, object_ref const keys);
   object_ref get_in(object_ref const m, object_ref const keys, object_ref const fallback);
   object_ref find(object_ref const s, object_ref const key);
@@ -121,16 +136,27 @@ namespace jank::runtime
   object_ref empty(object_ref const o);
 
   jtl::immutable_string str(object_ref const o, object_ref const args);
+  obj::string_rope_ref string_rope(object_ref const args);
+  bool is_string_rope(object_ref const o);
+  obj::string_rope_ref rope_append(object_ref const o, object_ref const args);
 
   obj::persistent_list_ref list(object_ref const s);
   obj::persistent_vector_ref vec(object_ref const s);
+  obj::persistent_hash_map_ref zipmap(object_ref const keys, object_ref const vals);
 
   bool sequence_equal(object_ref const l, object_ref const r);
 
   usize sequence_length(object_ref const s);
   usize sequence_length(object_ref const s, usize const max);
 
+  object_ref reduce(object_ref const f, object_ref const s);
   object_ref reduce(object_ref const f, object_ref const init, object_ref const s);
+  object_ref reduce_kv(object_ref const f, object_ref const init, object_ref const coll);
+  object_ref folder(object_ref const coll, object_ref const xform);
+  object_ref fold(object_ref const n,
+                  object_ref const combinef,
+                  object_ref const reducef,
+                  object_ref const coll);
   object_ref reduced(object_ref const o);
   bool is_reduced(object_ref const o);
 
@@ -150,6 +176,8 @@ namespace jank::runtime
 
   object_ref sort(object_ref const coll);
   object_ref sort(object_ref const comp, object_ref const coll);
+  object_ref sort_by(object_ref const keyfn, object_ref const coll);
+  object_ref sort_by(object_ref const keyfn, object_ref const comp, object_ref const coll);
 
   object_ref shuffle(object_ref const coll);
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime
+{
+  namespace obj
+  {
+    using ref_ref = oref<struct ref>;
+  }
+
+  obj::ref_ref ref(object_ref const o);
+  bool is_ref(object_ref const o);
+
+  /* Runs a fn of no args in a transaction, or within the current one, if there is one. */
+  object_ref run_in_transaction(object_ref const fn);
+  bool is_transaction_running();
+
+  /* These must be called within a transaction. The args are a seq of what to pass the fn
+   * after the ref's value, or nil. */
+  object_ref ref_alter(object_ref const r, object_ref const fn, object_ref const args);
+  object_ref ref_commute(object_ref const r, object_ref const fn, object_ref const args);
+  object_ref ref_set(object_ref const r, object_ref const val);
+  object_ref ref_ensure(object_ref const r);
+
+  i64 ref_history_count(object_ref const r);
+  i64 get_ref_min_history(object_ref const r);
+  object_ref set_ref_min_history(object_ref const r, object_ref const n);
+  i64 get_ref_max_history(object_ref const r);
+  object_ref set_ref_max_history(object_ref const r, object_ref const n);
+
+  /* A map of the contention counters, across every transaction so far. */
+  object_ref transaction_stats();
+}
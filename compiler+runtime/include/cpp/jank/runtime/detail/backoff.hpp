@@ -0,0 +1,37 @@
+#pragma once
+
+#include <thread>
+
+#include <jtl/primitive.hpp>
+
+namespace jank::runtime::detail
+{
+  /* Exponential backoff for CAS loops which lost a race. Each pause spins for twice as long
+   * as the last, up to a cap, after which it yields the thread instead. Backing off gives
+   * the winner time to finish, rather than having everyone recompute and collide again. */
+  struct backoff
+  {
+    static constexpr u32 max_spins{ 1024 };
+
+    void pause()
+    {
+      if(spins > max_spins)
+      {
+        std::this_thread::yield();
+        return;
+      }
+
+      for(u32 i{}; i < spins; ++i)
+      {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+      }
+      spins <<= 1;
+    }
+
+    u32 spins{ 1 };
+  };
+}
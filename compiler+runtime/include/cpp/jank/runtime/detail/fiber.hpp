@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+
+#include <jank/runtime/object.hpp>
+#include <jank/runtime/var.hpp>
+
+namespace jank::runtime::detail
+{
+  struct fiber_context;
+
+  /* A jank fn running on a stack of its own, so that it can park partway through and give its
+   * worker back to the task pool. This is what `go` blocks run on. A parked fiber costs its
+   * stack, which is only committed as it's used, rather than a whole OS thread.
+   *
+   * Fibers are resumed on whichever task pool worker is free, so a fiber may start on one
+   * thread and finish on another. Dynamic bindings and in flight exceptions move along with
+   * it. Anything else which is thread local must not be held across a park. Code which does
+   * hold onto such state uses a `pin_scope`, so waits within it block instead of parking.
+   *
+   * A parked fiber is kept alive by the GC until it's woken, even if nothing else can reach
+   * whatever it's waiting on. */
+  struct fiber : gc
+  {
+    enum class state : u8
+    {
+      running,
+      parked,
+      /* Woken before it finished parking. */
+      woken,
+      done
+    };
+
+    /* While one of these is alive, the current fiber can't park. */
+    struct pin_scope
+    {
+      pin_scope();
+      pin_scope(pin_scope const &) = delete;
+      pin_scope(pin_scope &&) = delete;
+      ~pin_scope();
+
+      pin_scope &operator=(pin_scope const &) = delete;
+      pin_scope &operator=(pin_scope &&) = delete;
+    };
+
+    fiber(object_ref const fn);
+    fiber(fiber const &) = delete;
+    fiber(fiber &&) = delete;
+    ~fiber() = default;
+
+    fiber &operator=(fiber const &) = delete;
+    fiber &operator=(fiber &&) = delete;
+
+    /* Starts running `fn` on a new fiber, on the task pool. */
+    static void spawn(object_ref const fn);
+    /* The fiber running on this thread, if it's able to park. Otherwise null. */
+    static fiber *current();
+
+    /* Parks the current fiber until `wake` is called and returns what `wake` was given. This
+     * must only be called on the fiber returned by `current`. */
+    object_ref park();
+    /* Resumes a parked fiber on the task pool. This may be called from any thread, even before
+     * the fiber has finished parking, but only once for each park. */
+    void wake(object_ref const result);
+    /* Runs the fiber on this thread until it next parks or finishes. Only the task pool calls
+     * this. */
+    void resume();
+
+    object_ref fn;
+    object_ref result;
+    std::atomic<state> st{ state::running };
+    /* The fiber's dynamic bindings, while it's not running. The thread's own bindings, while
+     * it is. */
+    native_list<thread_binding_frame> bindings;
+    /* The saved registers and the stack. This is platform specific, so it's kept out of the
+     * header. */
+    fiber_context *ctx{};
+  };
+}
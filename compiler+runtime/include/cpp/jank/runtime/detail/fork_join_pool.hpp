@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <jtl/primitive.hpp>
+#include <jank/type.hpp>
+
+namespace jank::runtime::detail
+{
+  /* A small work-stealing pool for fork/join parallelism, as used by `fold`. Each worker
+   * owns a deque, which it pushes to and pops from at the back. When a worker runs dry, it
+   * steals from the front of the other deques, which is where the biggest pieces of work
+   * are. Threads which aren't workers push onto a shared deque instead.
+   *
+   * Joining never blocks. The joining thread keeps running pending jobs until the one it's
+   * waiting on is done. That's what makes deeply recursive forking safe with a fixed number
+   * of workers. */
+  struct fork_join_pool
+  {
+    /* A unit of forked work. Jobs are meant to live on the stack of the thread which forks
+     * them and that thread must always join them before the job goes out of scope, even
+     * when unwinding. */
+    struct job
+    {
+      job(std::function<void()> &&fn);
+
+      std::function<void()> fn;
+      std::atomic<bool> done{};
+      std::exception_ptr error;
+    };
+
+    fork_join_pool(usize const worker_count);
+    fork_join_pool(fork_join_pool const &) = delete;
+    fork_join_pool(fork_join_pool &&) = delete;
+    ~fork_join_pool();
+
+    fork_join_pool &operator=(fork_join_pool const &) = delete;
+    fork_join_pool &operator=(fork_join_pool &&) = delete;
+
+    /* The process-wide pool, with one worker per hardware thread. It's started on first
+     * use. */
+    static fork_join_pool &instance();
+
+    void fork(job &j);
+    /* Waits for the job, helping with other work in the meantime, then rethrows anything
+     * the job threw. */
+    void join(job &j);
+    /* Same as `join`, but doesn't rethrow. Used when we're already unwinding. */
+    void wait(job &j);
+
+    usize worker_count() const;
+
+  private:
+    struct queue
+    {
+      std::mutex mutex;
+      std::deque<job *> jobs;
+    };
+
+    void worker_loop(usize const index);
+    bool run_pending();
+    job *find_job();
+    static void run(job &j);
+
+    native_vector<std::thread> workers;
+    /* One per worker, plus the shared queue at the end. */
+    std::unique_ptr<queue[]> queues;
+    std::atomic<usize> pending{};
+    std::atomic<bool> stopping{};
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_cv;
+  };
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+#include <jtl/primitive.hpp>
+#include <jank/type.hpp>
+
+namespace jank::runtime::detail
+{
+  /* A bounded, lock-free queue for any number of producers and consumers. This is Dmitry
+   * Vyukov's design. Every slot has a sequence number which says whether it's ready to be
+   * written or read on the current lap around the ring, so producers only contend with
+   * each other on the tail and consumers only contend with each other on the head.
+   *
+   * The values are kept in a GC allocated vector, so anything queued stays visible to the
+   * GC. That means the ring itself must live somewhere the GC scans. The capacity is
+   * rounded up to a power of two. */
+  template <typename T>
+  struct mpmc_ring
+  {
+    mpmc_ring(usize const min_capacity)
+      : mask{ std::bit_ceil(std::max<usize>(min_capacity, 2)) - 1 }
+      , sequences{ std::make_unique<std::atomic<usize>[]>(mask + 1) }
+      , values(mask + 1)
+    {
+      for(usize i{}; i <= mask; ++i)
+      {
+        sequences[i].store(i, std::memory_order_relaxed);
+      }
+    }
+
+    mpmc_ring(mpmc_ring const &) = delete;
+    mpmc_ring(mpmc_ring &&) = delete;
+
+    mpmc_ring &operator=(mpmc_ring const &) = delete;
+    mpmc_ring &operator=(mpmc_ring &&) = delete;
+
+    /* Returns false if the ring is full. */
+    bool try_push(T const &value)
+    {
+      auto pos{ tail.load(std::memory_order_relaxed) };
+      while(true)
+      {
+        auto &seq{ sequences[pos & mask] };
+        auto const diff{ static_cast<i64>(seq.load(std::memory_order_acquire) - pos) };
+        if(diff == 0)
+        {
+          if(tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            values[pos & mask] = value;
+            seq.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if(diff < 0)
+        {
+          return false;
+        }
+        else
+        {
+          pos = tail.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /* Returns false if the ring is empty. */
+    bool try_pop(T &out)
+    {
+      auto pos{ head.load(std::memory_order_relaxed) };
+      while(true)
+      {
+        auto &seq{ sequences[pos & mask] };
+        auto const diff{ static_cast<i64>(seq.load(std::memory_order_acquire) - (pos + 1)) };
+        if(diff == 0)
+        {
+          if(head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            out = values[pos & mask];
+            /* The slot shouldn't keep the value alive once it's been taken. */
+            values[pos & mask] = T{};
+            seq.store(pos + mask + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if(diff < 0)
+        {
+          return false;
+        }
+        else
+        {
+          pos = head.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    usize capacity() const
+    {
+      return mask + 1;
+    }
+
+    usize const mask;
+    std::unique_ptr<std::atomic<usize>[]> sequences;
+    native_vector<T> values;
+    /* Producers and consumers each hammer their own end, so keep them on separate lines. */
+    alignas(64) std::atomic<usize> head{};
+    alignas(64) std::atomic<usize> tail{};
+  };
+}
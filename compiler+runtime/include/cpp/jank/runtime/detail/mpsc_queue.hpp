@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+
+#include <jank/gc.hpp>
+
+namespace jank::runtime::detail
+{
+  /* An unbounded, lock-free queue for any number of producers and a single consumer. This
+   * is Dmitry Vyukov's intrusive design. A push is a single atomic exchange, followed by
+   * linking the previous node to the new one. The queue always keeps one node around, as
+   * a stub, which is the last node popped.
+   *
+   * Between a producer's exchange and its link, the consumer can't see the new node yet,
+   * so `try_pop` may briefly report the queue as empty while a push is in flight. Anyone
+   * who needs to know better must keep a count alongside the queue.
+   *
+   * Nodes are GC allocated, so the queue itself must live somewhere the GC scans. */
+  template <typename T>
+  struct mpsc_queue
+  {
+    struct node
+    {
+      T value{};
+      std::atomic<node *> next{};
+    };
+
+    mpsc_queue()
+      : head{ new(UseGC) node{} }
+      , tail{ head.load() }
+    {
+    }
+
+    mpsc_queue(mpsc_queue const &) = delete;
+    mpsc_queue(mpsc_queue &&) = delete;
+
+    mpsc_queue &operator=(mpsc_queue const &) = delete;
+    mpsc_queue &operator=(mpsc_queue &&) = delete;
+
+    /* Safe to call from any thread. */
+    void push(T const &value)
+    {
+      auto const n{ new(UseGC) node{ value } };
+      auto const prev{ head.exchange(n, std::memory_order_acq_rel) };
+      prev->next.store(n, std::memory_order_release);
+    }
+
+    /* Must only be called by the consumer. */
+    bool try_pop(T &out)
+    {
+      auto const next{ tail->next.load(std::memory_order_acquire) };
+      if(!next)
+      {
+        return false;
+      }
+
+      out = next->value;
+      /* The node stays around as the stub, but it shouldn't keep the value alive. */
+      next->value = T{};
+      tail = next;
+      return true;
+    }
+
+    /* Must only be called by the consumer. Returns null under the same conditions in which
+     * `try_pop` would return false. */
+    T const *peek() const
+    {
+      auto const next{ tail->next.load(std::memory_order_acquire) };
+      return next ? &next->value : nullptr;
+    }
+
+    std::atomic<node *> head;
+    node *tail{};
+  };
+}
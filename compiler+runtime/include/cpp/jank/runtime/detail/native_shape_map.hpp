@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+
+#include <folly/Synchronized.h>
+
+#include <jtl/option.hpp>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::detail
+{
+  /* A shape is the ordered list of keys of a shape map. All of its keys are keywords and
+   * shapes are interned, so two maps with the same keys, added in the same order, share one
+   * shape and only differ in their values. This is essentially what `defrecord` gives us on
+   * the JVM, without needing to declare anything up front.
+   *
+   * Shapes form a tree, rooted at the empty shape. Each shape knows the shapes which come
+   * from adding one more key to it, so finding the shape for an assoc is a single lookup.
+   * Like keywords, shapes are never freed. */
+  struct map_shape : gc
+  {
+    /* Keys are found with a linear scan of pointer compares, so this can be much larger than
+     * an array map's threshold. Domain entities of a few dozen keys stay within it. */
+    static constexpr u8 max_size{ 32 };
+
+    map_shape() = default;
+    map_shape(map_shape const * const parent, object_ref const key);
+
+    static map_shape const *root();
+
+    /* Returns the shape with `key` added at the end. `key` must be a keyword which isn't
+     * already in this shape and this shape must be smaller than `max_size`. */
+    map_shape const *with_key(object_ref const key) const;
+
+    /* Returns the slot of `key`, or -1 if it's not here. */
+    [[gnu::hot]]
+    i32 index_of(object_ref const key) const
+    {
+      for(u8 i{}; i < size; ++i)
+      {
+        if(keys[i] == key)
+        {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    /* Unique across all shapes and never zero, so a call site cache can refer to a shape
+     * without holding onto it. */
+    u32 id{};
+    u8 size{};
+    object_ref *keys{};
+    mutable folly::Synchronized<native_unordered_map<object *, map_shape const *>> transitions;
+  };
+
+  /* A call site cache for keyword lookups, such as `(:name m)`. It holds the id of the last
+   * shape seen at that call site along with the keyword's slot in that shape. When the next
+   * map has the same shape, the lookup is an id compare and an indexed load.
+   *
+   * Both halves live in one word, so racing threads can't see one without the other. */
+  struct shape_slot_cache
+  {
+    std::atomic<u64> entry{};
+  };
+
+  /* The storage for a shape map. Values are stored in the same order as the shape's keys. */
+  struct native_shape_map
+  {
+    native_shape_map() = default;
+    native_shape_map(map_shape const * const shape, object_ref * const values);
+    native_shape_map(native_shape_map const &) = default;
+    native_shape_map(native_shape_map &&) noexcept = default;
+
+    [[gnu::hot]]
+    jtl::option<object_ref> find(object_ref const key) const
+    {
+      auto const slot{ shape->index_of(key) };
+      if(slot < 0)
+      {
+        return {};
+      }
+      return values[slot];
+    }
+
+    [[gnu::hot]]
+    jtl::option<object_ref> find(object_ref const key, shape_slot_cache &cache) const
+    {
+      auto const entry{ cache.entry.load(std::memory_order_relaxed) };
+      if(static_cast<u32>(entry >> 32) == shape->id)
+      {
+        return values[static_cast<u32>(entry)];
+      }
+
+      auto const slot{ shape->index_of(key) };
+      if(slot < 0)
+      {
+        return {};
+      }
+      cache.entry.store((static_cast<u64>(shape->id) << 32) | static_cast<u32>(slot),
+                        std::memory_order_relaxed);
+      return values[slot];
+    }
+
+    struct iterator
+    {
+      using iterator_category = std::input_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = std::pair<object_ref, object_ref>;
+      using pointer = value_type *;
+      using reference = value_type &;
+
+      iterator(map_shape const *shape, object_ref const *values, u8 index);
+      iterator(iterator const &) = default;
+      iterator(iterator &&) noexcept = default;
+
+      value_type operator*() const;
+
+      iterator &operator++();
+
+      bool operator!=(iterator const &rhs) const;
+
+      bool operator==(iterator const &rhs) const;
+
+      iterator &operator=(iterator const &rhs);
+
+      map_shape const *shape{};
+      object_ref const *values{};
+      u8 index{};
+    };
+
+    using const_iterator = iterator;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    u8 size() const;
+
+    bool empty() const;
+
+    map_shape const *shape{ map_shape::root() };
+    object_ref *values{};
+  };
+}
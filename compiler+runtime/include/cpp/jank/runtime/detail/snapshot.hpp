@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <jank/runtime/oref.hpp>
+
+namespace jank::runtime::detail
+{
+  /* An immutable value which is read far more often than it's written, such as the vars
+   * within a namespace. Readers load the current value with a single atomic load and never
+   * lock. Writers are serialized with each other and publish a whole new value, so a reader
+   * always sees either the old value or the new one, never something in between.
+   *
+   * The GC keeps old values alive for as long as any reader still holds onto them. */
+  template <typename T>
+  struct snapshot
+  {
+    /* Held for the duration of a write. Only the holder of one of these may publish. */
+    struct write_lock
+    {
+      oref<T> get() const
+      {
+        return s.load();
+      }
+
+      void publish(oref<T> const next) const
+      {
+        s.value.store(next.data, std::memory_order_release);
+      }
+
+      snapshot &s;
+      std::lock_guard<std::mutex> lock{ s.write_mutex };
+    };
+
+    snapshot() = delete;
+
+    snapshot(oref<T> const initial)
+      : value{ initial.data }
+    {
+    }
+
+    oref<T> load() const
+    {
+      return value.load(std::memory_order_acquire);
+    }
+
+    write_lock wlock()
+    {
+      return { *this };
+    }
+
+    /* We have to hold only a raw pointer here, since std::atomic doesn't
+     * support more complex types. */
+    std::atomic<T *> value{};
+    std::mutex write_mutex;
+  };
+}
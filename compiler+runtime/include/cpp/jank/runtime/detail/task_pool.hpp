@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <jtl/primitive.hpp>
+#include <jank/type.hpp>
+#include <jank/runtime/oref.hpp>
+#include <jank/runtime/detail/mpmc_ring.hpp>
+
+namespace jank::runtime::detail
+{
+  struct fiber;
+
+  /* A pool of workers for many small, independent tasks, such as `go` blocks and channel
+   * callbacks. A task is a jank fn and, optionally, one arg to call it with. Tasks are
+   * queued on a lock-free ring, so submitting one only takes a lock if the ring is full
+   * and it spills over.
+   *
+   * A task may also be a fiber to resume, which is how `go` blocks run. A fiber which
+   * parks, such as on a channel, gives its worker back until it's woken.
+   *
+   * Tasks may still block, such as when a `go` block derefs a future. While a worker is
+   * blocked, a spare worker is started in its place, so the pool always has its full
+   * number of workers free to run tasks. Spares retire once the blocked workers are running
+   * again. There are never more than `max_spares` spares, since each one is an OS thread.
+   * Past that, blocking tasks just hold onto their workers and other tasks wait for one to
+   * free up. Channel operations park rather than block, so they never need a spare.
+   *
+   * An elastic pool also starts a new worker whenever a task is submitted while every
+   * worker is busy. Workers beyond the base count retire as soon as they run dry. That
+   * suits tasks which spend most of their time blocked on I/O, like `send-off` actions.
+   *
+   * The pool must live where the GC scans it, since it holds onto the queued tasks. */
+  struct task_pool
+  {
+    static constexpr usize max_spares{ 256 };
+
+    /* While one of these is alive, the current thread is considered blocked. This does
+     * nothing on threads which aren't workers of the pool. */
+    struct blocking_scope
+    {
+      blocking_scope();
+      blocking_scope(blocking_scope const &) = delete;
+      blocking_scope(blocking_scope &&) = delete;
+      ~blocking_scope();
+
+      blocking_scope &operator=(blocking_scope const &) = delete;
+      blocking_scope &operator=(blocking_scope &&) = delete;
+
+      task_pool *pool{};
+    };
+
+    task_pool(usize const worker_count, bool const elastic);
+    task_pool(task_pool const &) = delete;
+    task_pool(task_pool &&) = delete;
+
+    task_pool &operator=(task_pool const &) = delete;
+    task_pool &operator=(task_pool &&) = delete;
+
+    /* The process-wide pool, with one worker per hardware thread. It's started on first
+     * use. */
+    static task_pool &instance();
+    /* The process-wide elastic pool, which starts out with no workers. */
+    static task_pool &elastic_instance();
+
+    void submit(object_ref const fn);
+    void submit(object_ref const fn, object_ref const arg);
+    void submit(fiber * const f);
+
+    usize worker_count() const;
+
+  private:
+    struct task
+    {
+      object_ref fn;
+      object_ref arg;
+      bool has_arg{};
+      fiber *f{};
+    };
+
+    void push(task const &t);
+    void spawn_worker();
+    void worker_loop();
+    bool run_pending();
+    bool try_retire();
+    static void run(task const &t);
+
+    usize const target;
+    bool const elastic{};
+    mpmc_ring<task> ring;
+    /* Only used once the ring is full. */
+    std::mutex overflow_mutex;
+    native_deque<task> overflow;
+    std::atomic<usize> overflow_size{};
+    /* Bumped on every submit. Idle workers sleep until it changes. */
+    std::atomic<u32> epoch{};
+    std::atomic<usize> sleeping{};
+    std::atomic<usize> live{};
+    std::atomic<usize> blocked{};
+  };
+}
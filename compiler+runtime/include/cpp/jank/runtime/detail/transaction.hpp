@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/ref.hpp>
+
+namespace jank::runtime::detail
+{
+  enum class transaction_status : u8
+  {
+    running,
+    committing,
+    retry,
+    killed,
+    committed
+  };
+
+  /* What other transactions can see of a transaction. Refs point at this to say who's
+   * claimed them. It's shared, so it outlives any one attempt of the transaction. */
+  struct transaction_info
+  {
+    static transaction_info *create(u64 const start_point);
+
+    bool is_running() const;
+    /* Sets the status and wakes anyone waiting for this attempt to finish. */
+    void stop(transaction_status const s);
+    /* Waits until this attempt is no longer running, or the timeout runs out. */
+    void wait_for(std::chrono::milliseconds const timeout);
+
+    std::atomic<transaction_status> status{ transaction_status::running };
+    u64 start_point{};
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  /* Contention metrics, across every transaction in the process. */
+  struct transaction_stats
+  {
+    std::atomic<u64> commits{};
+    std::atomic<u64> retries{};
+    /* Older transactions killing younger ones to take their refs. */
+    std::atomic<u64> barges{};
+    /* Reads which found no value old enough and had to retry. */
+    std::atomic<u64> faults{};
+    /* Attempts which gave up waiting on a ref's lock. */
+    std::atomic<u64> lock_timeouts{};
+  };
+
+  /* A multi-version concurrency control transaction, following Clojure's
+   * LockingTransaction. Every attempt reads a consistent snapshot of the refs, as of the
+   * point it started. Writes are kept to the transaction until it commits.
+   *
+   * Setting a ref claims it for the transaction. If another running transaction already
+   * has it, the older of the two wins. The younger one either gets killed (barged) or
+   * waits for the other to finish and then retries. A transaction keeps its start point
+   * across retries, so it only gets older and will eventually win. Retries also back off,
+   * with jitter, so transactions which keep colliding spread out.
+   *
+   * Commutes don't claim anything. They're rerun at commit time against the latest value,
+   * so they never conflict with each other. `ensure` takes a read lock on the ref until
+   * commit, which keeps others from claiming it without claiming it ourselves. */
+  struct transaction
+  {
+    static constexpr usize retry_limit{ 10000 };
+    static constexpr std::chrono::milliseconds lock_wait{ 100 };
+    static constexpr std::chrono::milliseconds barge_wait{ 10 };
+
+    struct commute_fn
+    {
+      object_ref fn;
+      object_ref args;
+    };
+
+    struct held_send
+    {
+      obj::agent_ref a;
+      obj::agent::action act;
+    };
+
+    struct notify
+    {
+      obj::ref *r{};
+      object_ref old_val;
+      object_ref new_val;
+    };
+
+    struct by_id
+    {
+      bool operator()(obj::ref const * const l, obj::ref const * const r) const
+      {
+        return l->id < r->id;
+      }
+    };
+
+    /* Commutes are rerun in ref order, which is also the order they're locked in. */
+    using commute_entry = std::pair<obj::ref * const, native_vector<commute_fn>>;
+    using commute_map
+      = std::map<obj::ref *, native_vector<commute_fn>, by_id, native_allocator<commute_entry>>;
+
+    /* The transaction running on this thread, if any. */
+    static transaction *current();
+    /* Runs the fn in a transaction, retrying as needed. If a transaction is already
+     * running, the fn just joins it. */
+    static object_ref run_in_transaction(object_ref const fn);
+    static transaction_stats &stats();
+
+    object_ref get(obj::ref * const r);
+    object_ref set(obj::ref * const r, object_ref const val);
+    object_ref commute(obj::ref * const r, object_ref const fn, object_ref const args);
+    void ensure(obj::ref * const r);
+    /* Agent sends are held until the transaction commits and are dropped on retry. */
+    void hold_send(obj::agent_ref const a, obj::agent::action const &act);
+
+  private:
+    object_ref run(object_ref const fn);
+    bool is_running() const;
+    void stop(transaction_status const s);
+    /* Claims the ref for this transaction. Returns its latest value. */
+    object_ref claim(obj::ref * const r);
+    void release_if_ensured(obj::ref * const r);
+    void lock_for_write(obj::ref * const r);
+    bool barge(transaction_info * const other);
+    [[noreturn]] void block_and_bail(transaction_info * const other);
+    void commit();
+
+    transaction_info *info{};
+    u64 read_point{};
+    u64 start_point{};
+    std::chrono::steady_clock::time_point start_time;
+
+    /* These all use GC allocators, and the transaction lives on the stack, so the GC sees
+     * everything in them. */
+    native_unordered_map<obj::ref *, object_ref> vals;
+    native_set<obj::ref *> sets;
+    commute_map commutes;
+    native_set<obj::ref *> ensures;
+    native_vector<held_send> sends;
+    /* Watches are only notified once everything is unlocked. */
+    native_vector<notify> notifies;
+    /* Locked for commit. */
+    native_vector<obj::ref *> locked;
+  };
+}
@@ -4,6 +4,7 @@
 
 #include <jank/runtime/var.hpp>
 #include <jank/runtime/lazy_meta.hpp>
+#include <jank/runtime/detail/snapshot.hpp>
 #include <jank/error.hpp>
 
 namespace jank::runtime
@@ -31,6 +32,8 @@ namespace jank::runtime
     var_ref intern_owned_var(jtl::immutable_string_view const &);
     var_ref intern_owned_var(obj::symbol_ref const);
     var_ref find_var(obj::symbol_ref const);
+    /* Finds an unqualified var by name, without allocating. */
+    var_ref find_var(jtl::immutable_string_view const &name) const;
     jtl::result<void, jtl::immutable_string> unmap(obj::symbol_ref const sym);
 
     jtl::result<void, jtl::immutable_string> add_alias(obj::symbol_ref const sym, ns_ref const ns);
@@ -61,9 +64,10 @@ namespace jank::runtime
     obj::symbol_ref name{};
 
     /* XXX: Everything here is thread-safe. */
-    /* TODO: Benchmark the use of atomics here. That's what Clojure uses. */
-    folly::Synchronized<obj::persistent_hash_map_ref> vars;
-    folly::Synchronized<obj::persistent_hash_map_ref> aliases;
+    /* Vars and aliases are looked up whenever a symbol is resolved, so reads of these don't
+     * lock. See `detail::snapshot`. */
+    runtime::detail::snapshot<obj::persistent_hash_map> vars;
+    runtime::detail::snapshot<obj::persistent_hash_map> aliases;
     folly::Synchronized<obj::persistent_hash_map_ref> referred_cpp_globals;
     std::atomic_uint64_t symbol_counter{};
 
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <folly/Synchronized.h>
+
+#include <jank/runtime/object.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/detail/mpsc_queue.hpp>
+
+namespace jank::runtime::obj
+{
+  using agent_ref = oref<struct agent>;
+
+  enum class agent_error_mode : u8
+  {
+    fail,
+    continue_
+  };
+
+  enum class agent_executor : u8
+  {
+    /* The fixed pool, for CPU bound actions. */
+    send,
+    /* The elastic pool, for actions which may block. */
+    send_off
+  };
+
+  /* An agent holds a value which is only ever changed by the actions sent to it. Actions
+   * are queued on a lock-free queue and run one at a time, in the order they were sent,
+   * on one of the task pools. Sending never blocks and never retries.
+   *
+   * Whoever sends the first action to an idle agent schedules a drain. The drain runs a
+   * batch of actions and then, if more are queued, schedules itself again, so one busy
+   * agent can't hog a worker. There's never more than one drain per agent, which is what
+   * keeps the queue single consumer.
+   *
+   * Every action runs on the pool it was sent to. When a drain reaches an action which
+   * belongs to the other pool, it ends its batch there and hands that action over to a
+   * drain on the right pool. */
+  struct agent : object
+  {
+    static constexpr object_type obj_type{ object_type::agent };
+    static constexpr object_behavior obj_behaviors{ object_behavior::ref_like
+                                                    | object_behavior::deref };
+    static constexpr bool pointer_free{ false };
+    static constexpr usize batch_size{ 64 };
+
+    /* Counts down once for each agent being awaited. */
+    struct await_latch
+    {
+      static await_latch *create(usize const count);
+
+      void count_down();
+      void wait();
+      /* Returns false if the time ran out first. */
+      bool wait_for(std::chrono::milliseconds const timeout);
+
+      std::mutex mutex;
+      std::condition_variable cv;
+      usize remaining{};
+    };
+
+    struct action
+    {
+      object_ref fn;
+      /* A seq of the args after the state, or nil. */
+      object_ref args;
+      agent_executor executor{};
+      /* If set, this isn't a real action. It just counts the latch down once everything
+       * sent before it has run. */
+      await_latch *latch{};
+    };
+
+    agent(object_ref const o);
+
+    /* behavior::deref */
+    object_ref deref() override;
+
+    /* behavior::metadatable */
+    object_ref with_meta(object_ref const m);
+    object_ref get_meta() const;
+    void set_meta(object_ref const o);
+
+    /* behavior::ref_like */
+    void set_validator(object_ref const vf) override;
+    object_ref get_validator() const override;
+    void add_watch(object_ref const key, object_ref const fn) override;
+    void remove_watch(object_ref const key) override;
+    void validate(object_ref const val);
+
+    /* Sends an action to the agent. Within a transaction or an action, sends are held
+     * until it commits. */
+    static void dispatch(agent_ref const a, action const &act);
+    /* Same as dispatch, without checking whether the agent can accept actions. */
+    static void dispatch_action(agent_ref const a, action const &act);
+    /* Sends everything held by the current action right away. Returns how many there
+     * were. */
+    static usize release_pending_sends();
+    /* The agent whose action is running on this thread, if any. */
+    static agent const *running();
+    /* Once shut down, no agent accepts any more actions. Queued actions still run. */
+    static void shutdown();
+
+    void enqueue(action const &a);
+    /* Runs up to a batch of actions sent to the given pool. This must only be called by the
+     * agent's one drain, running on that pool. */
+    void drain(agent_executor const on);
+
+    object_ref get_error() const;
+    void restart(object_ref const new_state, bool const clear_actions);
+
+    /*** XXX: Everything here is thread-safe. ***/
+
+    /* We have to hold only a raw pointer here, since std::atomic doesn't
+     * support more complex types. */
+    std::atomic<object *> val{};
+    folly::Synchronized<persistent_hash_map_ref> watches{};
+    folly::Synchronized<object_ref> validator{};
+    folly::Synchronized<object_ref> error_handler{};
+    std::atomic<agent_error_mode> error_mode{ agent_error_mode::fail };
+
+    runtime::detail::mpsc_queue<action> queue;
+    /* The number of queued actions. Going from 0 to 1 means scheduling a drain. */
+    std::atomic<usize> pending{};
+    /* An action which has already been popped, but which still needs to run. This is only
+     * touched by whoever owns the queue. */
+    jtl::option<action> next_action;
+
+    /* Guards the error along with whether the drain has been suspended because of it. A
+     * suspended drain still owns the queue and is rescheduled on restart. */
+    mutable std::mutex error_mutex;
+    object_ref error;
+    bool suspended{};
+    /* Mirrors whether there's an error, so sends can check without locking. */
+    std::atomic_bool failed{};
+
+  private:
+    void schedule(agent_executor const executor);
+    /* Takes the next action, once its push is linked in. Only for whoever owns the queue. */
+    action take();
+    /* Returns false if the action failed the agent. */
+    bool run(action const &a);
+
+    lazy_meta meta;
+  };
+}
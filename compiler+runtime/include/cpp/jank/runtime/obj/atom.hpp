@@ -66,6 +66,10 @@ namespace jank::runtime::obj
      * order watches are invoked. */
     folly::Synchronized<persistent_hash_map_ref> watches{};
     folly::Synchronized<object_ref> validator{};
+    /* These mirror whether there's a validator or any watches, so that the common case of
+     * having neither never has to take their locks. */
+    std::atomic_bool has_validator{};
+    std::atomic_bool has_watches{};
 
   private:
     lazy_meta meta;
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using buffered_writer_ref = oref<struct buffered_writer>;
+
+  /* A writer which `*out*` can be bound to, so that printing doesn't hit stdio on every call.
+   * Printing fns render objects straight into `buff` and then call `wrote`, which decides
+   * whether it's time to flush. We flush once the buffer is full or once `flush_interval`
+   * has passed since the last flush. There's no background thread, so the interval is only
+   * checked on writes. Call `flush` explicitly before going quiet.
+   *
+   * The buffer belongs to the thread which created the writer, so there's no lock to contend
+   * on until a flush. Bindings are conveyed to other threads, though, by `future`, `go` and
+   * friends, so any other thread which writes here skips the buffer and writes straight to
+   * the file instead, relying on stdio's own locking. Only the owner may touch `buff`
+   * directly; check `is_owner` first. */
+  struct buffered_writer : object
+  {
+    static constexpr object_type obj_type{ object_type::buffered_writer };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+
+    static constexpr usize default_capacity{ 16 * 1024 };
+    static constexpr std::chrono::milliseconds default_flush_interval{ 50 };
+
+    buffered_writer(std::FILE * const file);
+    buffered_writer(std::FILE * const file,
+                    usize const capacity,
+                    std::chrono::milliseconds const flush_interval);
+
+    void write(jtl::immutable_string_view const &s);
+    void write(char const c);
+    /* To be called after writing directly into `buff`. */
+    void wrote();
+    void flush();
+    bool is_owner() const;
+
+    std::thread::id owner{ std::this_thread::get_id() };
+    /*** XXX: Everything here is only for the owner. ***/
+    std::FILE *file{};
+    jtl::string_builder buff;
+    usize capacity{ default_capacity };
+    std::chrono::milliseconds flush_interval{ default_flush_interval };
+    std::chrono::steady_clock::time_point last_flush{};
+  };
+}
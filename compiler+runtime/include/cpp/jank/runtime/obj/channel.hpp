@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::detail
+{
+  struct fiber;
+}
+
+namespace jank::runtime::obj
+{
+  using channel_ref = oref<struct channel>;
+
+  enum class channel_buffer : u8
+  {
+    /* Every put waits for a take. */
+    none,
+    /* Puts wait once the buffer is full. */
+    fixed,
+    /* Puts into a full buffer are dropped. */
+    dropping,
+    /* Puts into a full buffer push out the oldest value. */
+    sliding
+  };
+
+  /* A core.async style channel. Values are put in one end and taken out the other, in
+   * order. A take or put which can't complete right away is parked on the channel, as a
+   * handler, until a matching put or take comes along. Nothing ever blocks a thread here;
+   * blocking is built on top, by parking a handler which delivers a promise. A go block
+   * parks a handler which wakes its fiber instead.
+   *
+   * Once closed, puts are refused, but everything already buffered or parked can still be
+   * taken. After that, takes get nil. */
+  struct channel : object
+  {
+    static constexpr object_type obj_type{ object_type::channel };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+    /* Past this many parked takes or puts, more are refused, rather than letting the queue
+     * grow without bound. This is the same limit as core.async. */
+    static constexpr usize max_pending{ 1024 };
+    /* Handlers which completed elsewhere, such as the other ops of an `alts`, are swept out
+     * after this many handlers are parked. */
+    static constexpr usize max_dirty{ 64 };
+
+    /* Ensures that a take or put completes only once, even while it's parked on several
+     * channels at once, as with `alts`. A plain take or put has a guard of its own.
+     *
+     * Completing a parked handler means locking both its guard and the guard of the
+     * incoming take or put. Guards are always locked in order of their ids, so two threads
+     * completing overlapping `alts` can't deadlock. */
+    struct guard
+    {
+      enum class state : u8
+      {
+        active,
+        locked,
+        done
+      };
+
+      /* Guards must live in GC memory, since handlers only point to them. */
+      static guard *create();
+
+      /* Returns false if the guard is already done. */
+      bool lock();
+      void unlock();
+      /* Must be called while locked. */
+      void commit();
+      bool is_done() const;
+
+      std::atomic<state> st{ state::active };
+      u64 id{};
+    };
+
+    struct handler
+    {
+      guard *g{};
+      /* Takes are called with the value taken, or nil if the channel is closed. Puts are
+       * called with true, or false if the channel is closed. For `alts`, the result is a
+       * [result port] vector instead. A promise is delivered right away. Anything else is
+       * called on the task pool. */
+      object_ref callback;
+      /* The value being put. */
+      object_ref val;
+      /* Only for `alts`. The channel to report alongside the result. */
+      object_ref port;
+      /* A parked go block to wake with the result, in place of a callback. */
+      runtime::detail::fiber *fiber{};
+    };
+
+    channel(channel_buffer const kind, usize const capacity);
+
+    /* Returns false, without parking, if the channel is already closed. */
+    bool put(handler const &h);
+    void take(handler const &h);
+    /* Puts without parking. Returns true if the value was accepted. */
+    bool offer(object_ref const val);
+    /* Takes without parking. Returns nil if nothing was ready. */
+    object_ref poll();
+    void close();
+    bool is_closed() const;
+
+    struct completion
+    {
+      handler h;
+      object_ref result;
+    };
+
+    static void complete_all(native_vector<completion> const &done);
+    /* Whether a put can complete without a taker. */
+    bool accepts_put() const;
+    void buffer_put(object_ref const val);
+    /* Moves parked puts into the buffer, as long as there's room. */
+    void refill(native_vector<completion> &done);
+    /* Parks a take or put. Throws if there are already too many. */
+    static void
+    park(native_deque<handler> &parked, handler const &h, usize &dirty, char const * const what);
+
+    /*** XXX: Everything below is guarded by the mutex, except the immutable kind and
+     * capacity. ***/
+    channel_buffer const kind;
+    usize const capacity;
+    mutable std::mutex mutex;
+    native_deque<object_ref> buffer;
+    native_deque<handler> takers;
+    native_deque<handler> putters;
+    usize dirty_takes{};
+    usize dirty_puts{};
+    bool closed{};
+  };
+}
@@ -19,6 +19,15 @@ namespace jank::runtime::obj
     character(char);
     character(i64);
 
+    /* Characters are immutable so, like the JVM's `Character.valueOf`, we box the common ones
+     * once and share them. That's all of ASCII, plus the rest of the two byte UTF-8 range,
+     * which covers most Latin, Greek, Cyrillic, Hebrew, and Arabic text. This keeps character
+     * level text processing, such as walking a string's seq, from allocating per char.
+     * Anything else is boxed as usual. */
+    static character_ref create(char const ch);
+    static character_ref create(jtl::immutable_string_view const &bytes);
+    static character_ref create(i64 const codepoint);
+
     /* behavior::object_like */
     bool equal(object const &) const override;
     jtl::immutable_string to_string() const override;
@@ -58,6 +58,9 @@ namespace jank::runtime::obj::detail
     /* behavior::conjable */
     object_ref conj(object_ref const head) const;
 
+    /* behavior::kv_reducible */
+    object_ref kv_reduce(object_ref const f, object_ref const init) const;
+
     /*** XXX: Everything here is thread-safe. ***/
   protected:
     lazy_meta meta;
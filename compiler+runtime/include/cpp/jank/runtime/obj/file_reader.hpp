@@ -0,0 +1,47 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+#include <jank/runtime/module/loader.hpp>
+
+namespace jank::runtime::obj
+{
+  using file_reader_ref = oref<struct file_reader>;
+
+  /* A reader over a whole file, backed by the same `file_view` the module loader uses. For
+   * files on disk, that means the file is mapped with `mmap` and we only ever touch the pages
+   * we're reading, so even files much larger than memory can be walked line by line.
+   *
+   * This is not thread-safe, just as Java's readers aren't. Readers also aren't closed by the
+   * GC, so the mapping lives until `close` is called. Use `with-open`. */
+  struct file_reader : object
+  {
+    static constexpr object_type obj_type{ object_type::file_reader };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+
+    /* The number of lines we'll read into each chunk of a `line-seq`. */
+    static constexpr usize chunk_size{ 32 };
+
+    file_reader(module::file_view &&view);
+
+    /* Returns a view of the next line, without its line terminator, which is only valid
+     * until the reader is closed. Returns none at EOF. */
+    jtl::option<jtl::immutable_string_view> next_line();
+
+    /* Returns the next line as a string, or nil at EOF. */
+    object_ref read_line();
+    /* Returns up to `chunk_size` lines as an array chunk, or nil at EOF. */
+    object_ref read_line_chunk();
+    /* Returns everything from the current position to the end of the file. */
+    jtl::immutable_string_view read_remaining();
+    /* The same, but without moving past it. */
+    jtl::immutable_string_view peek_remaining() const;
+
+    void close();
+
+    /*** XXX: Everything here is not thread-safe. ***/
+    module::file_view view;
+    usize offset{};
+    bool closed{};
+  };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdio>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using file_writer_ref = oref<struct file_writer>;
+
+  /* A buffered writer to a file. Writes go into a 64 KiB stdio buffer and only hit the
+   * file once it fills up, or on `flush`/`close`.
+   *
+   * This is not thread-safe, just as Java's writers aren't. Writers also aren't closed by
+   * the GC. A writer which is dropped without being closed leaks its stream and buffer,
+   * which are flushed when the process exits. Use `with-open`. */
+  struct file_writer : object
+  {
+    static constexpr object_type obj_type{ object_type::file_writer };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+
+    static constexpr usize buffer_size{ 64 * 1024 };
+
+    file_writer(jtl::immutable_string const &path, bool const append);
+
+    void write(jtl::immutable_string_view const &s);
+    void flush();
+    void close();
+
+    /*** XXX: Everything here is not thread-safe. ***/
+    jtl::immutable_string path;
+    std::FILE *file{};
+    /* Malloc'd, since stdio uses it as the buffer for `file` for as long as that's open.
+     * Freed by `close`. */
+    char *buffer{};
+  };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using folder_ref = oref<struct folder>;
+
+  /* A collection paired with a transformation of reducing fns, as created by
+   * `clojure.core.reducers/map` and friends. Nothing happens until the folder is reduced
+   * or folded, at which point the reducing fn is transformed and the underlying collection
+   * is reduced or folded with it. Since no intermediate collections are built, chains of
+   * these are as cheap as a single pass. */
+  struct folder : object
+  {
+    static constexpr object_type obj_type{ object_type::folder };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+
+    folder(object_ref const coll, object_ref const xform);
+
+    /*** XXX: Everything here is immutable after initialization. ***/
+    object_ref coll;
+    object_ref xform;
+  };
+}
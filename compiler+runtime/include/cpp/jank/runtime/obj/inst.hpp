@@ -17,6 +17,7 @@ namespace jank::runtime::obj
 
     inst();
     inst(jtl::immutable_string const &s);
+    inst(inst_time_point const &value);
 
     /* behavior::object_like */
     bool equal(object const &) const override;
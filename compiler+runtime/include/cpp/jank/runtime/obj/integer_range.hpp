@@ -80,6 +80,9 @@ namespace jank::runtime::obj
     /* behavior::countable */
     usize count() const;
 
+    /* behavior::reducible */
+    object_ref reduce(object_ref const f, object_ref const init) const;
+
     /*** XXX: Everything here is immutable after initialization. ***/
     i64 start{};
     i64 end{};
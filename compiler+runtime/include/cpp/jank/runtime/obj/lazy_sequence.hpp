@@ -1,6 +1,6 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
 
 #include <jtl/option.hpp>
 
@@ -13,6 +13,16 @@ namespace jank::runtime::obj
   using cons_ref = oref<struct cons>;
   using lazy_sequence_ref = oref<struct lazy_sequence>;
 
+  /* A lazy sequence is realized at most once, by whichever thread gets to it first. Any other
+   * threads which need it in the meantime wait. After that, it never changes, so reading a
+   * realized sequence is just a load. */
+  enum class realization_state : u8
+  {
+    unrealized,
+    realizing,
+    realized
+  };
+
   /* TODO: IPending analog, to implement `realized?`. */
   struct lazy_sequence : object
   {
@@ -60,17 +70,20 @@ namespace jank::runtime::obj
     object_ref resolve_seq() const;
 
     object_ref realize() const;
-    void force() const;
-    void lock_and_force() const;
-    object_ref sval() const;
-    object_ref unwrap(object_ref ls) const;
+    object_ref realize_slow() const;
+    bool claim() const;
+    void publish(lazy_sequence const * const tail,
+                 object_ref const result,
+                 realization_state const to) const;
 
   public:
     /*** XXX: Everything here is thread-safe. ***/
     lazy_meta meta;
-    mutable std::recursive_mutex mutex;
+    /* Only read or written by the realizing thread until `state` is realized. */
     mutable object_ref fn{};
-    mutable object_ref sv{};
+    /* While realizing, this links to the next nested lazy sequence being realized along
+     * with this one. After that, it's the realized seq. */
     mutable object_ref s{};
+    mutable std::atomic<realization_state> state{ realization_state::realized };
   };
 }
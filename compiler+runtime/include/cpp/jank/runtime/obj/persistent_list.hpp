@@ -75,6 +75,9 @@ namespace jank::runtime::obj
     /* behavior::countable */
     usize count() const;
 
+    /* behavior::reducible */
+    object_ref reduce(object_ref const f, object_ref const init) const;
+
     /* behavior::conjable */
     persistent_list_ref conj(object_ref const head) const;
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <jank/runtime/object.hpp>
+#include <jank/runtime/detail/native_array_map.hpp>
+#include <jank/runtime/detail/native_shape_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map_sequence.hpp>
+#include <jank/runtime/obj/detail/base_persistent_map.hpp>
+
+namespace jank::runtime::obj
+{
+  using persistent_shape_map_ref = oref<struct persistent_shape_map>;
+  using transient_hash_map_ref = oref<struct transient_hash_map>;
+
+  /* A map where every key is a keyword. The keys live in a shared, interned shape and each
+   * map only holds its values, in the same order. Array maps which grow past their max size
+   * become shape maps, rather than hash maps, if all of their keys are keywords. Adding a key
+   * which isn't a keyword, or growing past the shape's max size, promotes to a hash map.
+   *
+   * Since keywords are interned, lookups never need to hash or call `equal`. With a
+   * `shape_slot_cache`, a lookup of a known key is a single compare and an indexed load. */
+  struct persistent_shape_map
+    : obj::detail::base_persistent_map<persistent_shape_map,
+                                       persistent_shape_map_sequence,
+                                       runtime::detail::native_shape_map>
+  {
+    static constexpr object_type obj_type{ object_type::persistent_shape_map };
+    static constexpr object_behavior obj_behaviors{ object_behavior::call | object_behavior::get
+                                                    | object_behavior::find
+                                                    | object_behavior::seqable };
+    static constexpr u8 max_size{ runtime::detail::map_shape::max_size };
+    using parent_type = obj::detail::base_persistent_map<persistent_shape_map,
+                                                         persistent_shape_map_sequence,
+                                                         runtime::detail::native_shape_map>;
+
+    persistent_shape_map() = default;
+    persistent_shape_map(persistent_shape_map &&) noexcept = default;
+    persistent_shape_map(persistent_shape_map const &) = default;
+    persistent_shape_map(value_type &&d);
+    persistent_shape_map(value_type const &d);
+    persistent_shape_map(object_ref const meta, value_type &&d);
+    persistent_shape_map(lazy_meta const &meta, value_type &&d);
+
+    static persistent_shape_map_ref empty()
+    {
+      static persistent_shape_map const ret;
+      return &ret;
+    }
+
+    using base_persistent_map::base_persistent_map;
+
+    /* Whether the `length` keys and values in `kvs`, alternating, can be held in a shape map.
+     * This doesn't check for duplicate keys. */
+    static bool can_hold(object_ref const *kvs, usize const length);
+    /* Whether `m` with `key` added can be held in a shape map. */
+    static bool can_hold(runtime::detail::native_array_map const &m, object_ref const key);
+
+    /* Builds a shape map from alternating keys and values, which must pass `can_hold`.
+     * Throws on duplicate keys. */
+    static persistent_shape_map_ref
+    create_unique(object_ref const meta, object_ref const *kvs, usize const length);
+    static persistent_shape_map_ref create(lazy_meta const &meta,
+                                           runtime::detail::native_array_map const &m,
+                                           object_ref const key,
+                                           object_ref const val);
+
+    /* behavior::get */
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    object_ref get(object_ref const key) const override
+    {
+      return data.find(key).unwrap_or(jank_nil);
+    }
+
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    object_ref get(object_ref const key, object_ref const fallback) const override
+    {
+      return data.find(key).unwrap_or(fallback);
+    }
+
+    [[gnu::always_inline, gnu::flatten, gnu::hot]]
+    object_ref get(object_ref const key,
+                   runtime::detail::shape_slot_cache &cache,
+                   object_ref const fallback) const
+    {
+      return data.find(key, cache).unwrap_or(fallback);
+    }
+
+    bool contains(object_ref const key) const override;
+
+    /* behavior::find */
+    object_ref find(object_ref const key) const override;
+
+    /* behavior::associatively_writable */
+    object_ref assoc(object_ref const key, object_ref const val) const;
+    persistent_shape_map_ref dissoc(object_ref const key) const;
+
+    /* behavior::callable */
+    using object::call;
+    object_ref call(object_ref const) const override;
+    object_ref call(object_ref const, object_ref const) const override;
+
+    /* behavior::transientable */
+    transient_hash_map_ref to_transient() const;
+
+    /*** XXX: Everything here is immutable after initialization. ***/
+    value_type data{};
+  };
+}
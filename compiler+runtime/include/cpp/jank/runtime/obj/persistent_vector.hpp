@@ -106,6 +106,12 @@ namespace jank::runtime::obj
     /* behavior::transientable */
     obj::transient_vector_ref to_transient() const;
 
+    /* behavior::kv_reducible */
+    object_ref kv_reduce(object_ref const f, object_ref const init) const;
+
+    /* behavior::reducible */
+    object_ref reduce(object_ref const f, object_ref const init) const;
+
     /*** XXX: Everything here is immutable after initialization. ***/
     value_type data;
 
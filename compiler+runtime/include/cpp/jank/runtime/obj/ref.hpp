@@ -0,0 +1,88 @@
+#pragma once
+
+#include <shared_mutex>
+
+#include <folly/Synchronized.h>
+
+#include <jank/runtime/object.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+
+namespace jank::runtime::detail
+{
+  struct transaction_info;
+}
+
+namespace jank::runtime::obj
+{
+  using ref_ref = oref<struct ref>;
+
+  /* A ref is a transactional reference, for coordinated changes across several refs at once.
+   * Changes only happen within a transaction and are all or nothing. See
+   * `detail::transaction` for how they're coordinated.
+   *
+   * Each ref keeps a short history of its committed values, each tagged with the point at
+   * which it was committed. Transactions read the newest value which is no newer than the
+   * point at which they started, so readers never block writers and vice versa. When a
+   * transaction can't find an old enough value, the ref notes the fault and grows its
+   * history the next time it's committed to, up to `max_history`. */
+  struct ref : object
+  {
+    static constexpr object_type obj_type{ object_type::ref };
+    static constexpr object_behavior obj_behaviors{ object_behavior::ref_like
+                                                    | object_behavior::deref };
+    static constexpr bool pointer_free{ false };
+
+    struct tval
+    {
+      object_ref val;
+      u64 point{};
+    };
+
+    ref(object_ref const o);
+
+    /* behavior::deref */
+    /* Within a transaction, this is the in-transaction value. Otherwise, it's the most
+     * recently committed value. */
+    object_ref deref() override;
+
+    /* behavior::metadatable */
+    object_ref with_meta(object_ref const m);
+    object_ref get_meta() const;
+    void set_meta(object_ref const o);
+
+    /* behavior::ref_like */
+    void set_validator(object_ref const vf) override;
+    object_ref get_validator() const override;
+    void add_watch(object_ref const key, object_ref const fn) override;
+    void remove_watch(object_ref const key) override;
+    void validate(object_ref const val);
+    void notify_watches(object_ref const old_val, object_ref const new_val);
+
+    /* The most recently committed value. */
+    object_ref current_val();
+    usize history_count();
+    /* Called with the write lock held. Adds the committed value to the history, growing it
+     * only if a reader has faulted since the last commit, or if it's below the minimum. */
+    void commit(object_ref const val, u64 const point);
+
+    /* The refs in a transaction are locked in id order, so they never deadlock. */
+    u64 const id;
+
+    /* Guards the history and the owning transaction. Transactions take the write lock only
+     * to claim a ref and to commit. */
+    std::shared_timed_mutex lock;
+    /* Newest first. */
+    native_deque<tval> history;
+    /* The transaction which has most recently claimed this ref. */
+    detail::transaction_info *tinfo{};
+    std::atomic<usize> faults{};
+    std::atomic<usize> min_history{ 0 };
+    std::atomic<usize> max_history{ 10 };
+
+    folly::Synchronized<persistent_hash_map_ref> watches{};
+    folly::Synchronized<object_ref> validator{};
+
+  private:
+    lazy_meta meta;
+  };
+}
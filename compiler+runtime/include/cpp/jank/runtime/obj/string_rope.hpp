@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using persistent_string_ref = oref<struct persistent_string>;
+  using string_rope_ref = oref<struct string_rope>;
+
+  /* An immutable string which is built up by appending, without copying what's already there.
+   * Each rope is a node holding the piece it appended and a pointer to the rope it was
+   * appended to, so `(str-rope-append rope x)` is O(|x|) instead of O(|rope| + |x|). This
+   * makes building a large string over many appends linear, rather than quadratic.
+   *
+   * The characters are only laid out contiguously once the rope is turned into a string,
+   * at which point the result is cached on the node. Flattening a rope which was appended
+   * to a flattened rope only needs to walk back as far as that rope.
+   *
+   * A rope is not a string, so `str` never returns one. Appending is done explicitly, through
+   * `str-rope-append`. Like strings, ropes are countable through `count`, which has no
+   * behavior flag. */
+  struct string_rope : object
+  {
+    static constexpr object_type obj_type{ object_type::string_rope };
+    static constexpr object_behavior obj_behaviors{ object_behavior::none };
+    static constexpr bool pointer_free{ false };
+
+    string_rope();
+    string_rope(jtl::immutable_string const &piece);
+    string_rope(string_rope_ref const prev, jtl::immutable_string const &piece);
+
+    /* behavior::object_like */
+    bool equal(object const &) const override;
+    jtl::immutable_string to_string() const override;
+    void to_string(jtl::string_builder &buff) const override;
+    jtl::immutable_string to_code_string() const override;
+    uhash to_hash() const override;
+
+    /* behavior::countable */
+    usize count() const;
+
+    /* Returns a new rope with the string form of each of the args appended. Nil args are
+     * skipped, as with `str`. */
+    string_rope_ref append(object_ref const args) const;
+
+    persistent_string_ref flatten() const;
+
+    /*** XXX: Everything here is immutable after initialization. ***/
+    string_rope_ref prev;
+    jtl::immutable_string piece;
+    usize size{};
+
+    /* Lazily filled in by `flatten`. Racing threads will compute equal strings, so it doesn't
+     * matter which of them wins. */
+    mutable std::atomic<persistent_string *> flattened{};
+  };
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+
+#include <jank/runtime/object.hpp>
+
+namespace jank::runtime::obj
+{
+  using striped_counter_ref = oref<struct striped_counter>;
+
+  /* A counter for hot paths which many threads bump at once, like metrics, in the style of
+   * Java's LongAdder. Adding goes to a single base count for as long as nobody else is
+   * adding at the same time. Once a CAS on the base loses a race, the counter switches to
+   * spreading adds across stripes, one per thread (modulo the stripe count), so threads
+   * stop fighting over a single cache line. Reading sums everything up, so it's slower
+   * than adding and isn't an atomic snapshot while adds are in flight. */
+  struct striped_counter : object
+  {
+    static constexpr object_type obj_type{ object_type::striped_counter };
+    static constexpr object_behavior obj_behaviors{ object_behavior::deref };
+    static constexpr bool pointer_free{ true };
+    static constexpr usize stripe_count{ 32 };
+
+    /* Each stripe takes two cache lines. We can't count on the GC aligning the object,
+     * but with this stride no two counts can ever share a line. */
+    struct stripe
+    {
+      std::atomic<i64> count{};
+      char padding[128 - sizeof(std::atomic<i64>)]{};
+    };
+
+    striped_counter();
+
+    /* behavior::deref */
+    object_ref deref() override;
+
+    void add(i64 const n);
+    i64 sum() const;
+    void reset();
+    /* Resets each part of the count as it's read, so no adds are lost, even if they race
+     * with this. */
+    i64 sum_then_reset();
+
+    std::atomic<i64> base{};
+    std::atomic_bool contended{};
+    stripe stripes[stripe_count];
+  };
+}
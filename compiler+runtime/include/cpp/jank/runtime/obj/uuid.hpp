@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <jank/runtime/object.hpp>
 
 namespace uuids
@@ -19,6 +21,7 @@ namespace jank::runtime::obj
 
     uuid();
     uuid(jtl::immutable_string const &s);
+    uuid(std::array<u8, 16> const &bytes);
 
     /* behavior::object_like */
     bool equal(object const &) const override;
@@ -28,6 +28,7 @@ namespace jank::runtime
 
     persistent_string,
     persistent_string_sequence,
+    string_rope,
 
     keyword,
     symbol,
@@ -43,6 +44,9 @@ namespace jank::runtime
     transient_array_map,
     persistent_array_map_sequence,
 
+    persistent_shape_map,
+    persistent_shape_map_sequence,
+
     persistent_hash_map,
     transient_hash_map,
     persistent_hash_map_sequence,
@@ -85,9 +89,14 @@ namespace jank::runtime
     atom,
     volatile_,
     reduced,
+    folder,
     delay,
     future,
     promise,
+    channel,
+    agent,
+    ref,
+    striped_counter,
     ns,
 
     var,
@@ -101,6 +110,10 @@ namespace jank::runtime
     uuid,
     inst,
 
+    file_reader,
+    file_writer,
+    buffered_writer,
+
     opaque_box,
 
     reader_conditional,
@@ -136,6 +149,8 @@ namespace jank::runtime
         return "persistent_string";
       case object_type::persistent_string_sequence:
         return "persistent_string_sequence";
+      case object_type::string_rope:
+        return "string_rope";
 
       case object_type::keyword:
         return "keyword";
@@ -161,6 +176,11 @@ namespace jank::runtime
       case object_type::persistent_array_map_sequence:
         return "persistent_array_map_sequence";
 
+      case object_type::persistent_shape_map:
+        return "persistent_shape_map";
+      case object_type::persistent_shape_map_sequence:
+        return "persistent_shape_map_sequence";
+
       case object_type::persistent_hash_map:
         return "persistent_hash_map";
       case object_type::transient_hash_map:
@@ -237,12 +257,22 @@ namespace jank::runtime
         return "volatile_";
       case object_type::reduced:
         return "reduced";
+      case object_type::folder:
+        return "folder";
       case object_type::delay:
         return "delay";
       case object_type::future:
         return "future";
       case object_type::promise:
         return "promise";
+      case object_type::channel:
+        return "channel";
+      case object_type::agent:
+        return "agent";
+      case object_type::ref:
+        return "ref";
+      case object_type::striped_counter:
+        return "striped_counter";
       case object_type::ns:
         return "ns";
 
@@ -265,6 +295,13 @@ namespace jank::runtime
       case object_type::inst:
         return "inst";
 
+      case object_type::file_reader:
+        return "file_reader";
+      case object_type::file_writer:
+        return "file_writer";
+      case object_type::buffered_writer:
+        return "buffered_writer";
+
       case object_type::opaque_box:
         return "opaque_box";
 
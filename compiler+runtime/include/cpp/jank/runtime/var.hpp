@@ -165,7 +165,8 @@ namespace jank::runtime
     jtl::immutable_string to_code_string() const override;
     uhash to_hash() const override;
 
-    /*** XXX: Everything here is immutable after initialization. ***/
+    /*** XXX: Everything here is immutable after initialization, except that the thread id
+     * changes when a fiber moves the binding to another thread. ***/
     object_ref value{};
     std::thread::id thread_id;
   };
@@ -20,6 +20,8 @@
 #include <jank/runtime/obj/persistent_array_map.hpp>
 #include <jank/runtime/obj/persistent_array_map_sequence.hpp>
 #include <jank/runtime/obj/transient_array_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map_sequence.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
 #include <jank/runtime/obj/persistent_hash_map_sequence.hpp>
 #include <jank/runtime/obj/persistent_sorted_map.hpp>
@@ -48,6 +50,7 @@
 #include <jank/runtime/obj/native_pointer_wrapper.hpp>
 #include <jank/runtime/obj/persistent_vector_sequence.hpp>
 #include <jank/runtime/obj/persistent_string_sequence.hpp>
+#include <jank/runtime/obj/string_rope.hpp>
 #include <jank/runtime/obj/persistent_hash_set_sequence.hpp>
 #include <jank/runtime/obj/persistent_sorted_set_sequence.hpp>
 #include <jank/runtime/obj/native_array_sequence.hpp>
@@ -57,12 +60,20 @@
 #include <jank/runtime/obj/delay.hpp>
 #include <jank/runtime/obj/future.hpp>
 #include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/obj/channel.hpp>
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/ref.hpp>
+#include <jank/runtime/obj/striped_counter.hpp>
 #include <jank/runtime/obj/reduced.hpp>
+#include <jank/runtime/obj/folder.hpp>
 #include <jank/runtime/obj/tagged_literal.hpp>
 #include <jank/runtime/obj/re_pattern.hpp>
 #include <jank/runtime/obj/re_matcher.hpp>
 #include <jank/runtime/obj/uuid.hpp>
 #include <jank/runtime/obj/inst.hpp>
+#include <jank/runtime/obj/file_reader.hpp>
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/runtime/obj/buffered_writer.hpp>
 #include <jank/runtime/obj/opaque_box.hpp>
 #include <jank/runtime/obj/reader_conditional.hpp>
 #include <jank/runtime/obj/exception_info.hpp>
@@ -119,6 +130,8 @@ namespace jank::runtime
         return fn(expect_object<obj::small_real>(erased), std::forward<Args>(args)...);
       case object_type::persistent_string:
         return fn(expect_object<obj::persistent_string>(erased), std::forward<Args>(args)...);
+      case object_type::string_rope:
+        return fn(expect_object<obj::string_rope>(erased), std::forward<Args>(args)...);
       case object_type::keyword:
         return fn(expect_object<obj::keyword>(erased), std::forward<Args>(args)...);
       case object_type::symbol:
@@ -134,6 +147,11 @@ namespace jank::runtime
       case object_type::persistent_array_map_sequence:
         return fn(expect_object<obj::persistent_array_map_sequence>(erased),
                   std::forward<Args>(args)...);
+      case object_type::persistent_shape_map:
+        return fn(expect_object<obj::persistent_shape_map>(erased), std::forward<Args>(args)...);
+      case object_type::persistent_shape_map_sequence:
+        return fn(expect_object<obj::persistent_shape_map_sequence>(erased),
+                  std::forward<Args>(args)...);
       case object_type::transient_array_map:
         return fn(expect_object<obj::transient_array_map>(erased), std::forward<Args>(args)...);
       case object_type::persistent_hash_map:
@@ -218,12 +236,22 @@ namespace jank::runtime
         return fn(expect_object<obj::volatile_>(erased), std::forward<Args>(args)...);
       case object_type::reduced:
         return fn(expect_object<obj::reduced>(erased), std::forward<Args>(args)...);
+      case object_type::folder:
+        return fn(expect_object<obj::folder>(erased), std::forward<Args>(args)...);
       case object_type::delay:
         return fn(expect_object<obj::delay>(erased), std::forward<Args>(args)...);
       case object_type::future:
         return fn(expect_object<obj::future>(erased), std::forward<Args>(args)...);
       case object_type::promise:
         return fn(expect_object<obj::promise>(erased), std::forward<Args>(args)...);
+      case object_type::channel:
+        return fn(expect_object<obj::channel>(erased), std::forward<Args>(args)...);
+      case object_type::agent:
+        return fn(expect_object<obj::agent>(erased), std::forward<Args>(args)...);
+      case object_type::ref:
+        return fn(expect_object<obj::ref>(erased), std::forward<Args>(args)...);
+      case object_type::striped_counter:
+        return fn(expect_object<obj::striped_counter>(erased), std::forward<Args>(args)...);
       case object_type::ns:
         return fn(expect_object<ns>(erased), std::forward<Args>(args)...);
       case object_type::var:
@@ -242,6 +270,12 @@ namespace jank::runtime
         return fn(expect_object<obj::uuid>(erased), std::forward<Args>(args)...);
       case object_type::inst:
         return fn(expect_object<obj::inst>(erased), std::forward<Args>(args)...);
+      case object_type::file_reader:
+        return fn(expect_object<obj::file_reader>(erased), std::forward<Args>(args)...);
+      case object_type::file_writer:
+        return fn(expect_object<obj::file_writer>(erased), std::forward<Args>(args)...);
+      case object_type::buffered_writer:
+        return fn(expect_object<obj::buffered_writer>(erased), std::forward<Args>(args)...);
       case object_type::opaque_box:
         return fn(expect_object<obj::opaque_box>(erased), std::forward<Args>(args)...);
       case object_type::reader_conditional:
@@ -275,6 +309,11 @@ namespace jank::runtime
       case object_type::persistent_array_map_sequence:
         return fn(expect_object<obj::persistent_array_map_sequence>(erased),
                   std::forward<Args>(args)...);
+      case object_type::persistent_shape_map:
+        return fn(expect_object<obj::persistent_shape_map>(erased), std::forward<Args>(args)...);
+      case object_type::persistent_shape_map_sequence:
+        return fn(expect_object<obj::persistent_shape_map_sequence>(erased),
+                  std::forward<Args>(args)...);
       case object_type::persistent_hash_map:
         return fn(expect_object<obj::persistent_hash_map>(erased), std::forward<Args>(args)...);
       case object_type::persistent_hash_map_sequence:
@@ -358,6 +397,8 @@ namespace jank::runtime
     {
       case object_type::persistent_array_map:
         return fn(expect_object<obj::persistent_array_map>(erased), std::forward<Args>(args)...);
+      case object_type::persistent_shape_map:
+        return fn(expect_object<obj::persistent_shape_map>(erased), std::forward<Args>(args)...);
       case object_type::persistent_hash_map:
         return fn(expect_object<obj::persistent_hash_map>(erased), std::forward<Args>(args)...);
       case object_type::persistent_sorted_map:
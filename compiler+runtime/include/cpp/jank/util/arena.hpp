@@ -0,0 +1,86 @@
+#pragma once
+
+#include <jtl/primitive.hpp>
+
+#include <jank/gc.hpp>
+
+namespace jank::util
+{
+  /* A bump allocator for compiler data, like analyzer expressions and IR instructions.
+   * Compiling a form creates a great many small nodes which all die together once
+   * codegen is done. Rather than leaving each of them for the GC to find, we carve them
+   * out of a few large chunks and free those in one go when the arena goes away.
+   *
+   * The chunks are still GC allocated, so anything GC allocated which is only referenced
+   * by a node stays alive for as long as the arena does. Node destructors are never run,
+   * which matches how these nodes are treated when they're GC allocated.
+   *
+   * Nothing may point into the arena once it's gone. Data which needs to outlive the
+   * compilation unit, such as expressions handed back to the caller, needs to be
+   * allocated within an `escape` scope. */
+  struct arena
+  {
+    arena() = default;
+    arena(arena const &) = delete;
+    arena(arena &&) = delete;
+    ~arena();
+
+    arena &operator=(arena const &) = delete;
+    arena &operator=(arena &&) = delete;
+
+    void *allocate(usize const size, usize const alignment);
+
+    /* The arena which this thread is allocating compiler data from, if any. */
+    static arena *current();
+
+    /* Makes an arena current for the lifetime of this scope. These nest, so a compilation
+     * which triggers another one (by loading a module during macro expansion, for example)
+     * will have the inner compilation use its own arena. */
+    struct scope
+    {
+      scope(arena &a);
+      scope(scope const &) = delete;
+      scope(scope &&) = delete;
+      ~scope();
+
+      scope &operator=(scope const &) = delete;
+      scope &operator=(scope &&) = delete;
+
+      arena *previous{};
+    };
+
+    /* Suspends the current arena for the lifetime of this scope, so anything allocated
+     * within it goes to the GC and may outlive the compilation unit. */
+    struct escape
+    {
+      escape();
+      escape(escape const &) = delete;
+      escape(escape &&) = delete;
+      ~escape();
+
+      escape &operator=(escape const &) = delete;
+      escape &operator=(escape &&) = delete;
+
+      arena *previous{};
+    };
+
+  private:
+    struct chunk;
+
+    chunk *allocate_chunk(usize const size);
+
+    chunk *head{};
+    char *cursor{};
+    char *end{};
+  };
+
+  /* Compiler data which derives from this is allocated from the current arena, when
+   * there is one, and from the GC otherwise. This hooks the `new(UseGC)` which
+   * `jtl::make_ref` does, so nothing building these nodes needs to know about arenas. */
+  struct arena_allocated
+  {
+    static void *operator new(usize const size, GCPlacement const placement);
+    /* Only used when a constructor throws. */
+    static void operator delete(void * const data, GCPlacement const placement);
+  };
+}
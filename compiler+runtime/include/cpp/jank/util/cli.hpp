@@ -130,6 +130,8 @@ namespace jank::util::cli
     bool remove_nops{};
 
     /*** O2 ***/
+    bool fuse_seq_chains{};
+    bool call_site_caches{};
 
     /*** O3 ***/
     bool hoist_var_derefs{};
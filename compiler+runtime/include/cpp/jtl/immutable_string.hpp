@@ -160,6 +160,16 @@ namespace jtl
     }
 
     constexpr immutable_string(immutable_string const &s, size_type const pos, size_type count)
+      : immutable_string{ s, pos, count, max_shared_difference }
+    {
+    }
+
+    /* Substrings of large strings share the original's buffer, as long as that doesn't leave
+     * more than `max_difference` bytes of the original alive for nothing. */
+    constexpr immutable_string(immutable_string const &s,
+                               size_type const pos,
+                               size_type count,
+                               size_type const max_difference)
     {
       auto const s_length(s.size());
       /* NOLINTNEXTLINE(readability-inconsistent-ifelse-braces): False positive. */
@@ -179,8 +189,10 @@ namespace jtl
       /* If the size difference between our substring and its original string is too great, it's
        * not worth keeping the original string alive just to share the substring. In that case,
        * we deep copy. This prevents relatively small (yet still categorically large) substrings
-       * from a large file keeping that whole file in memory as long as the substrings live. */
-      else if((s_length - count) > max_shared_difference)
+       * from a large file keeping that whole file in memory as long as the substrings live.
+       * A substring which is at least half of the original is always worth sharing, though,
+       * since it can never keep more than its own size alive. */
+      else if((s_length - count) > max_difference && count < s_length / 2)
       {
         init_large_owned(s.store.large.data + pos, count);
       }
@@ -482,6 +494,16 @@ namespace jtl
       return { *this, pos, count };
     }
 
+    /* Same as `substr`, but a large substring always shares the original's buffer, no matter
+     * how much of the original it leaves out. The whole original stays alive for as long as
+     * the substring does, so this is for pieces which are expected to go away along with the
+     * original, like fields split out of a payload. */
+    constexpr immutable_string
+    shared_substr(size_type const pos = 0, size_type const count = npos) const
+    {
+      return { *this, pos, count, npos };
+    }
+
     /*** Mutations. ***/
     constexpr immutable_string &operator=(immutable_string const &rhs)
     {
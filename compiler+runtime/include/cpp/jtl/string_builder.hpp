@@ -51,6 +51,7 @@ namespace jtl
     string_builder &operator()(char const *d) &;
     string_builder &operator()(std::string const &d) &;
     string_builder &operator()(jtl::immutable_string const &d) &;
+    string_builder &operator()(jtl::immutable_string_view const &d) &;
     string_builder &operator()(terminal::text_style s) &;
 
     template <template <typename> typename V, typename T>
@@ -1,17 +1,28 @@
-#include <nlohmann/json.hpp>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
 
 #include <clojure/data/json_native.hpp>
 
+#include <jtl/utf8.hpp>
+
 #include <jank/util/fmt.hpp>
 
 #include <jank/runtime/behavior/map_like.hpp>
 #include <jank/runtime/behavior/nameable.hpp>
 #include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/equal.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/obj/buffered_writer.hpp>
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
 #include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/transient_hash_map.hpp>
-#include <jank/runtime/obj/transient_vector.hpp>
 #include <jank/runtime/sequence_range.hpp>
 #include <jank/runtime/visit.hpp>
 
@@ -19,186 +30,867 @@ namespace clojure::data::json_native
 {
   using namespace ::jank::runtime;
 
-  static jtl::immutable_string resolve_key(object_ref const key, write_options const &opts)
+  /*** Writing. ***/
+
+  /* Values are printed straight into `buff`, with no intermediate tree. When we're writing to
+   * a writer object, `buff` is drained into it as it fills up, so the whole document never
+   * needs to be in memory at once. */
+  struct writer
+  {
+    /* File writers do their own buffering, so we hand them data in chunks of this size. */
+    static constexpr jtl::usize chunk_size{ 16 * 1024 };
+
+    void write(object_ref const o);
+    void write_string(jtl::immutable_string_view const &s);
+    void write_key(object_ref const key);
+    void newline();
+    void drain();
+    void finish();
+
+    write_options const &opts;
+    jtl::string_builder &buff;
+    obj::buffered_writer_ref buffered_sink;
+    obj::file_writer_ref file_sink;
+    jtl::usize depth{};
+  };
+
+  void writer::write_string(jtl::immutable_string_view const &s)
+  {
+    static constexpr std::array<char, 16> hex{ '0', '1', '2', '3', '4', '5', '6', '7',
+                                               '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+    buff('"');
+    auto run_start{ s.data() };
+    auto const end{ s.data() + s.size() };
+    for(auto it{ s.data() }; it != end; ++it)
+    {
+      auto const c{ static_cast<unsigned char>(*it) };
+      if(c >= 0x20 && c != '"' && c != '\\')
+      {
+        continue;
+      }
+
+      buff(jtl::immutable_string_view{ run_start, it });
+      run_start = it + 1;
+      switch(c)
+      {
+        case '"':
+          buff("\\\"");
+          break;
+        case '\\':
+          buff("\\\\");
+          break;
+        case '\b':
+          buff("\\b");
+          break;
+        case '\f':
+          buff("\\f");
+          break;
+        case '\n':
+          buff("\\n");
+          break;
+        case '\r':
+          buff("\\r");
+          break;
+        case '\t':
+          buff("\\t");
+          break;
+        default:
+          buff("\\u00")(hex[c >> 4])(hex[c & 0xf]);
+          break;
+      }
+    }
+    buff(jtl::immutable_string_view{ run_start, end });
+    buff('"');
+  }
+
+  void writer::write_key(object_ref const key)
   {
     if(truthy(opts.key_fn))
     {
-      return try_object<obj::persistent_string>(opts.key_fn.call(key))->data;
+      write_string(try_object<obj::persistent_string>(opts.key_fn.call(key))->data);
+    }
+    else if(key.get_type() == object_type::persistent_string)
+    {
+      write_string(expect_object<obj::persistent_string>(key)->data);
+    }
+    else if(key.get_type() == object_type::symbol)
+    {
+      write_string(expect_object<obj::symbol>(key)->get_name());
+    }
+    else if(key.get_type() == object_type::keyword)
+    {
+      write_string(expect_object<obj::keyword>(key)->get_name());
+    }
+    else
+    {
+      write_string(key.to_string());
     }
 
-    if(key.get_type() == object_type::symbol)
+    buff(':');
+    if(opts.indent)
     {
-      return expect_object<obj::symbol>(key)->get_name();
+      buff(' ');
     }
+  }
+
+  void writer::newline()
+  {
+    if(!opts.indent)
+    {
+      return;
+    }
+
+    buff('\n');
+    for(jtl::usize i{}; i < depth; ++i)
+    {
+      buff("  ");
+    }
+  }
 
-    if(key.get_type() == object_type::keyword)
+  void writer::drain()
+  {
+    if(buffered_sink.is_some())
+    {
+      if(buffered_sink->capacity <= buff.size())
+      {
+        buffered_sink->wrote();
+      }
+    }
+    else if(file_sink.is_some() && chunk_size <= buff.size())
     {
-      return expect_object<obj::keyword>(key)->get_name();
+      file_sink->write(buff.view());
+      buff.clear();
     }
+  }
 
-    return key.to_string();
+  void writer::finish()
+  {
+    if(buffered_sink.is_some())
+    {
+      buffered_sink->wrote();
+    }
+    else if(file_sink.is_some())
+    {
+      file_sink->write(buff.view());
+      buff.clear();
+    }
   }
 
-  static nlohmann::json write(object_ref const o, write_options const &opts)
+  void writer::write(object_ref const o)
   {
     /* TODO: Port visit_object: Not using all objects. */
-    return visit_object(
-      [&](auto const typed_o) -> nlohmann::json {
+    visit_object(
+      [&](auto const typed_o) {
         using T = typename decltype(typed_o)::value_type;
 
         if constexpr(std::same_as<T, obj::nil>)
         {
-          return {};
+          buff("null");
         }
-
-        if constexpr(jtl::is_any_same<T,
-                                      obj::boolean,
-                                      obj::persistent_string,
-                                      obj::integer,
-                                      obj::small_integer,
-                                      obj::real,
-                                      obj::small_real>)
+        else if constexpr(std::same_as<T, obj::boolean>)
         {
-          return typed_o->data;
+          buff(typed_o->data);
         }
-
-        if constexpr(std::same_as<T, obj::ratio>)
+        else if constexpr(std::same_as<T, obj::persistent_string>)
         {
-          return typed_o->to_real();
+          write_string(typed_o->data);
         }
-
-        if constexpr(jtl::is_any_same<T, obj::uuid, obj::big_integer, obj::big_decimal>)
+        else if constexpr(jtl::is_any_same<T, obj::integer, obj::small_integer>)
         {
-          return typed_o->to_string();
+          buff(static_cast<long long>(typed_o->data));
         }
-
-        if constexpr(jtl::is_any_same<T, obj::inst>)
+        else if constexpr(jtl::is_any_same<T, obj::real, obj::small_real, obj::ratio>)
+        {
+          auto const d{ typed_o->to_real() };
+          /* JSON has no representation for these. */
+          if(std::isnan(d) || std::isinf(d))
+          {
+            buff("null");
+          }
+          else
+          {
+            buff(d);
+          }
+        }
+        else if constexpr(jtl::is_any_same<T, obj::uuid, obj::big_integer, obj::big_decimal>)
+        {
+          write_string(typed_o->to_string());
+        }
+        else if constexpr(std::same_as<T, obj::inst>)
         {
           if(truthy(opts.date_formatter))
           {
-            return try_object<obj::persistent_string>(opts.date_formatter.call(o))->data;
+            write_string(try_object<obj::persistent_string>(opts.date_formatter.call(o))->data);
+          }
+          else
+          {
+            write_string(typed_o->to_string());
           }
-          return typed_o->to_string();
         }
-
-        if constexpr(behavior::nameable<T>)
+        else if constexpr(behavior::nameable<T>)
         {
-          return typed_o->get_name();
+          write_string(typed_o->get_name());
         }
-
-        if constexpr(behavior::map_like<T>)
+        else if constexpr(behavior::map_like<T>)
         {
-          nlohmann::json map{};
-
+          buff('{');
+          ++depth;
+          bool first{ true };
           for(auto const &kv : typed_o->data)
           {
             auto const value(truthy(opts.value_fn) ? opts.value_fn.call(kv.first, kv.second)
                                                    : kv.second);
-            if(opts.value_fn != value)
+            if(opts.value_fn == value)
             {
-              map[resolve_key(kv.first, opts)] = write(value, opts);
+              continue;
             }
-          }
 
-          return map;
+            if(!first)
+            {
+              buff(',');
+            }
+            first = false;
+            newline();
+            write_key(kv.first);
+            write(value);
+          }
+          --depth;
+          if(!first)
+          {
+            newline();
+          }
+          buff('}');
         }
-
-        if(typed_o.has_behavior(object_behavior::seqable))
+        else
         {
-          auto array(nlohmann::json::array());
+          if(!typed_o.has_behavior(object_behavior::seqable))
+          {
+            throw std::runtime_error{ jank::util::format("JSON write error (unsupported type: {})",
+                                                         object_type_str(typed_o.get_type())) };
+          }
 
+          buff('[');
+          ++depth;
+          bool first{ true };
           for(auto const e : make_sequence_range(typed_o))
           {
-            array.push_back(write(e, opts));
+            if(!first)
+            {
+              buff(',');
+            }
+            first = false;
+            newline();
+            write(e);
           }
-
-          return array;
+          --depth;
+          if(!first)
+          {
+            newline();
+          }
+          buff(']');
         }
-
-        throw std::runtime_error{ jank::util::format("JSON write error (unsupported type: {})",
-                                                     object_type_str(typed_o.get_type())) };
       },
       o);
+
+    drain();
   }
 
   jtl::immutable_string write_str(object_ref const x, write_options const &opts)
   {
-    if(opts.indent)
+    jtl::string_builder buff;
+    writer w{ opts, buff, {}, {} };
+    w.write(x);
+    return buff.release();
+  }
+
+  object_ref write(object_ref const x, object_ref const out, write_options const &opts)
+  {
+    if(out.get_type() == object_type::buffered_writer
+       && expect_object<obj::buffered_writer>(out)->is_owner())
     {
-      return write(x, opts).dump(2);
+      auto const sink{ expect_object<obj::buffered_writer>(out) };
+      writer w{ opts, sink->buff, sink, {} };
+      w.write(x);
+      w.finish();
+      return jank_nil;
     }
-    return write(x, opts).dump();
+
+    if(out.get_type() == object_type::file_writer)
+    {
+      jtl::string_builder buff;
+      writer w{ opts, buff, {}, expect_object<obj::file_writer>(out) };
+      w.write(x);
+      w.finish();
+      return jank_nil;
+    }
+
+    /* Anything else, such as the default `*out*`, which is a boxed FILE*, gets the whole
+     * document in one write. */
+    write_to(out, write_str(x, opts));
+    return jank_nil;
   }
 
-  static object_ref read(nlohmann::json const &json, read_options const &opts)
+  /*** Reading. ***/
+
+  /* A recursive descent parser which builds jank values as it goes, rather than building a
+   * DOM first. Objects small enough to be array maps are collected on the stack and only
+   * allocated once we know their final size. */
+  struct reader
+  {
+    /* Keeps adversarial input from blowing the native stack. */
+    static constexpr jtl::usize max_depth{ 512 };
+
+    object_ref read_document();
+    object_ref read_value();
+    object_ref read_object();
+    object_ref read_array();
+    object_ref read_number();
+    object_ref read_key();
+    jtl::immutable_string read_string();
+    void read_literal(jtl::immutable_string_view const &literal);
+    void read_escape(jtl::string_builder &buff);
+    void skip_whitespace();
+    [[noreturn]]
+    void fail(char const * const reason) const;
+
+    char const *begin{};
+    char const *pos{};
+    char const *end{};
+    read_options const &opts;
+    jtl::usize depth{};
+    /* With `:key-fn keyword`, the same few keys tend to show up over and over, so we intern
+     * each distinct key once per document, rather than once per occurrence. */
+    jank::native_unordered_map<jtl::immutable_string, object_ref> keywords;
+  };
+
+  void reader::fail(char const * const reason) const
   {
-    switch(json.type())
+    throw std::runtime_error{ jank::util::format("JSON read error ({} at offset {})",
+                                                 reason,
+                                                 pos - begin) };
+  }
+
+  void reader::skip_whitespace()
+  {
+    while(pos != end && (*pos == ' ' || *pos == '\n' || *pos == '\r' || *pos == '\t'))
     {
-      case nlohmann::json::value_t::null:
-        return jank_nil;
-      case nlohmann::json::value_t::string:
-        return make_box<obj::persistent_string>(json.get<std::string>());
-      case nlohmann::json::value_t::number_unsigned:
-      case nlohmann::json::value_t::number_integer:
-        return make_box(json.get<jtl::i64>());
-      case nlohmann::json::value_t::number_float:
-        {
-          if(opts.bigdec)
-          {
-            return make_box<obj::big_decimal>(json.get<jtl::f64>());
-          }
+      ++pos;
+    }
+  }
 
-          return make_box(json.get<jtl::f64>());
-        }
-      case nlohmann::json::value_t::boolean:
-        return make_box(json.get<bool>());
-      case nlohmann::json::value_t::array:
-        {
-          obj::transient_vector v{};
+  void reader::read_literal(jtl::immutable_string_view const &literal)
+  {
+    if(static_cast<jtl::usize>(end - pos) < literal.size()
+       || std::memcmp(pos, literal.data(), literal.size()) != 0)
+    {
+      fail("invalid literal");
+    }
+    pos += literal.size();
+  }
 
-          for(auto const &element : json)
-          {
-            v.conj_in_place(read(element, opts));
-          }
+  /* Finds the first byte at or after `it` which needs attention within a string: a quote, a
+   * backslash, or a control character. This checks eight bytes at a time, using the usual
+   * SWAR tricks, so long runs of plain text don't need to be checked byte by byte. */
+  static char const *find_string_special(char const *it, char const * const end)
+  {
+    static constexpr jtl::u64 ones{ 0x0101010101010101ull };
+    static constexpr jtl::u64 highs{ 0x8080808080808080ull };
+
+    for(; end - it >= 8; it += 8)
+    {
+      jtl::u64 word{};
+      std::memcpy(&word, it, sizeof(word));
+
+      auto const quotes{ word ^ (ones * '"') };
+      auto const backslashes{ word ^ (ones * '\\') };
+      auto const has_quote{ (quotes - ones) & ~quotes };
+      auto const has_backslash{ (backslashes - ones) & ~backslashes };
+      auto const has_control{ (word - ones * 0x20) & ~word };
+      if((has_quote | has_backslash | has_control) & highs)
+      {
+        break;
+      }
+    }
+
+    for(; it != end; ++it)
+    {
+      auto const c{ static_cast<unsigned char>(*it) };
+      if(c == '"' || c == '\\' || c < 0x20)
+      {
+        return it;
+      }
+    }
+    return end;
+  }
+
+  static jtl::u32 read_hex4(char const * const it)
+  {
+    jtl::u32 ret{};
+    auto const res{ std::from_chars(it, it + 4, ret, 16) };
+    if(res.ec != std::errc{} || res.ptr != it + 4)
+    {
+      throw std::runtime_error{ "JSON read error (invalid unicode escape)" };
+    }
+    return ret;
+  }
+
+  static void write_utf8(jtl::string_builder &buff, jtl::u32 const cp)
+  {
+    if(cp < 0x80)
+    {
+      buff(static_cast<char>(cp));
+    }
+    else if(cp < 0x800)
+    {
+      buff(static_cast<char>(0xC0 | (cp >> 6)));
+      buff(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+    else if(cp < 0x10000)
+    {
+      buff(static_cast<char>(0xE0 | (cp >> 12)));
+      buff(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      buff(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+    else
+    {
+      buff(static_cast<char>(0xF0 | (cp >> 18)));
+      buff(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+      buff(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      buff(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+
+  /* Expects `pos` to be on the backslash. */
+  void reader::read_escape(jtl::string_builder &buff)
+  {
+    if(end - pos < 2)
+    {
+      fail("unterminated string");
+    }
+
+    ++pos;
+    switch(*pos++)
+    {
+      case '"':
+        buff('"');
+        return;
+      case '\\':
+        buff('\\');
+        return;
+      case '/':
+        buff('/');
+        return;
+      case 'b':
+        buff('\b');
+        return;
+      case 'f':
+        buff('\f');
+        return;
+      case 'n':
+        buff('\n');
+        return;
+      case 'r':
+        buff('\r');
+        return;
+      case 't':
+        buff('\t');
+        return;
+      case 'u':
+        break;
+      default:
+        --pos;
+        fail("invalid escape");
+    }
+
+    if(end - pos < 4)
+    {
+      fail("invalid unicode escape");
+    }
+    jtl::u32 cp{ read_hex4(pos) };
+    pos += 4;
+
+    if(jtl::is_surrogate_high(static_cast<jtl::u16>(cp)))
+    {
+      if(end - pos < 6 || pos[0] != '\\' || pos[1] != 'u')
+      {
+        fail("unpaired surrogate");
+      }
+      auto const low{ read_hex4(pos + 2) };
+      if(!jtl::is_surrogate_low(static_cast<jtl::u16>(low)))
+      {
+        fail("unpaired surrogate");
+      }
+      cp = jtl::combine_surrogate_pair(static_cast<jtl::u16>(cp), static_cast<jtl::u16>(low));
+      pos += 6;
+    }
+    else if(jtl::is_surrogate_low(static_cast<jtl::u16>(cp)))
+    {
+      fail("unpaired surrogate");
+    }
+
+    write_utf8(buff, cp);
+  }
+
+  /* Expects `pos` to be on the opening quote. Strings without escapes, which is nearly all of
+   * them, are copied exactly once, straight out of the input. */
+  jtl::immutable_string reader::read_string()
+  {
+    auto const start{ ++pos };
+    pos = find_string_special(pos, end);
+    if(pos != end && *pos == '"')
+    {
+      return { start, static_cast<jtl::usize>(pos++ - start) };
+    }
+
+    jtl::string_builder buff;
+    buff(jtl::immutable_string_view{ start, pos });
+    while(true)
+    {
+      if(pos == end)
+      {
+        fail("unterminated string");
+      }
+
+      switch(*pos)
+      {
+        case '"':
+          ++pos;
+          return buff.release();
+        case '\\':
+          read_escape(buff);
+          break;
+        default:
+          fail("control character in string");
+      }
+
+      auto const run_start{ pos };
+      pos = find_string_special(pos, end);
+      buff(jtl::immutable_string_view{ run_start, pos });
+    }
+  }
+
+  object_ref reader::read_number()
+  {
+    auto const start{ pos };
+    bool is_float{};
+
+    if(pos != end && *pos == '-')
+    {
+      ++pos;
+    }
+    if(pos == end || !std::isdigit(static_cast<unsigned char>(*pos)))
+    {
+      fail("invalid number");
+    }
+    if(*pos == '0')
+    {
+      ++pos;
+    }
+    else
+    {
+      while(pos != end && std::isdigit(static_cast<unsigned char>(*pos)))
+      {
+        ++pos;
+      }
+    }
 
-          return v.to_persistent();
+    if(pos != end && *pos == '.')
+    {
+      is_float = true;
+      ++pos;
+      if(pos == end || !std::isdigit(static_cast<unsigned char>(*pos)))
+      {
+        fail("invalid number");
+      }
+      while(pos != end && std::isdigit(static_cast<unsigned char>(*pos)))
+      {
+        ++pos;
+      }
+    }
+
+    if(pos != end && (*pos == 'e' || *pos == 'E'))
+    {
+      is_float = true;
+      ++pos;
+      if(pos != end && (*pos == '+' || *pos == '-'))
+      {
+        ++pos;
+      }
+      if(pos == end || !std::isdigit(static_cast<unsigned char>(*pos)))
+      {
+        fail("invalid number");
+      }
+      while(pos != end && std::isdigit(static_cast<unsigned char>(*pos)))
+      {
+        ++pos;
+      }
+    }
+
+    if(!is_float)
+    {
+      jtl::i64 i{};
+      auto const res{ std::from_chars(start, pos, i) };
+      if(res.ec == std::errc::result_out_of_range)
+      {
+        return make_box<obj::big_integer>(
+          jtl::immutable_string{ start, static_cast<jtl::usize>(pos - start) });
+      }
+      return make_box(i);
+    }
+
+    if(opts.bigdec)
+    {
+      return make_box<obj::big_decimal>(
+        jtl::immutable_string{ start, static_cast<jtl::usize>(pos - start) });
+    }
+
+    jtl::f64 d{};
+    auto const res{ std::from_chars(start, pos, d) };
+    if(res.ec == std::errc::result_out_of_range)
+    {
+      /* from_chars doesn't give us a value on overflow, but strtod will give us infinity
+       * or zero. The number was validated above, so it's safe to hand over. */
+      std::string const copy{ start, pos };
+      d = std::strtod(copy.c_str(), nullptr);
+    }
+    return make_box(d);
+  }
+
+  object_ref reader::read_key()
+  {
+    if(pos == end || *pos != '"')
+    {
+      fail("expected a string key");
+    }
+
+    auto key_string(read_string());
+    if(opts.keyword_keys)
+    {
+      auto const found{ keywords.find(key_string) };
+      if(found != keywords.end())
+      {
+        return found->second;
+      }
+
+      /* Anything which can't be a keyword is left to `keyword` itself. */
+      auto const kw{ __rt_ctx->intern_keyword(key_string) };
+      if(kw.is_ok())
+      {
+        keywords.emplace(key_string, kw.expect_ok());
+        return kw.expect_ok();
+      }
+    }
+
+    auto const key(make_box<obj::persistent_string>(jtl::move(key_string)));
+    return truthy(opts.key_fn) ? opts.key_fn.call(key) : key;
+  }
+
+  /* Expects `pos` to be on the opening brace. */
+  object_ref reader::read_object()
+  {
+    ++pos;
+
+    std::array<object_ref, obj::persistent_array_map::max_size * 2> small;
+    jtl::usize small_length{};
+    obj::transient_hash_map_ref large;
+
+    skip_whitespace();
+    if(pos != end && *pos == '}')
+    {
+      ++pos;
+      return obj::persistent_array_map::empty();
+    }
+
+    while(true)
+    {
+      skip_whitespace();
+      auto const key(read_key());
+      skip_whitespace();
+      if(pos == end || *pos != ':')
+      {
+        fail("expected ':'");
+      }
+      ++pos;
+      auto const value_initial(read_value());
+
+      auto const value(truthy(opts.value_fn) ? opts.value_fn.call(key, value_initial)
+                                             : value_initial);
+      if(opts.value_fn != value)
+      {
+        if(large.is_some())
+        {
+          large->assoc_in_place(key, value);
         }
-      case nlohmann::json::value_t::object:
+        else
         {
-          obj::transient_hash_map m{};
-
-          for(auto const &[k, v] : json.items())
+          /* Later duplicates win, as with assoc. */
+          jtl::usize i{};
+          for(; i < small_length; i += 2)
           {
-            auto const key_initial(make_box<obj::persistent_string>(k));
-            auto const value_initial(read(v, opts));
-
-            auto const key(truthy(opts.key_fn) ? opts.key_fn.call(key_initial) : key_initial);
-            auto const value(truthy(opts.value_fn) ? opts.value_fn.call(key, value_initial)
-                                                   : value_initial);
-            if(opts.value_fn != value)
+            if(equal(small[i], key))
             {
-              m.assoc_in_place(key, value);
+              small[i + 1] = value;
+              break;
             }
           }
 
-          return m.to_persistent();
+          if(i == small_length)
+          {
+            if(small_length == small.size())
+            {
+              large = make_box<obj::transient_hash_map>();
+              for(jtl::usize j{}; j < small_length; j += 2)
+              {
+                large->assoc_in_place(small[j], small[j + 1]);
+              }
+              large->assoc_in_place(key, value);
+            }
+            else
+            {
+              small[small_length++] = key;
+              small[small_length++] = value;
+            }
+          }
         }
-      case nlohmann::json::value_t::binary:
-        throw std::runtime_error{ "JSON read error (unsupported type: binary)" };
-      case nlohmann::json::value_t::discarded:
+      }
+
+      skip_whitespace();
+      if(pos == end)
+      {
+        fail("unterminated object");
+      }
+      if(*pos == ',')
+      {
+        ++pos;
+        continue;
+      }
+      if(*pos == '}')
+      {
+        ++pos;
+        break;
+      }
+      fail("expected ',' or '}'");
+    }
+
+    if(large.is_some())
+    {
+      return large->to_persistent();
+    }
+    if(small_length == 0)
+    {
+      return obj::persistent_array_map::empty();
+    }
+
+    auto const array_box(make_array_box<object_ref>(small_length));
+    std::copy(small.begin(), small.begin() + small_length, array_box.data);
+    return make_box<obj::persistent_array_map>(runtime::detail::in_place_unique{},
+                                               array_box,
+                                               small_length);
+  }
+
+  /* Expects `pos` to be on the opening bracket. */
+  object_ref reader::read_array()
+  {
+    ++pos;
+
+    runtime::detail::native_transient_vector vec;
+
+    skip_whitespace();
+    if(pos != end && *pos == ']')
+    {
+      ++pos;
+      return obj::persistent_vector::empty();
+    }
+
+    while(true)
+    {
+      vec.push_back(read_value());
+
+      skip_whitespace();
+      if(pos == end)
+      {
+        fail("unterminated array");
+      }
+      if(*pos == ',')
+      {
+        ++pos;
+        continue;
+      }
+      if(*pos == ']')
+      {
+        ++pos;
+        break;
+      }
+      fail("expected ',' or ']'");
+    }
+
+    return make_box<obj::persistent_vector>(vec.persistent());
+  }
+
+  object_ref reader::read_value()
+  {
+    skip_whitespace();
+    if(pos == end)
+    {
+      fail("unexpected end of input");
+    }
+
+    switch(*pos)
+    {
+      case '{':
+      case '[':
         {
-          if(opts.eof_error)
+          if(max_depth <= depth)
           {
-            throw std::runtime_error{ "JSON read error (failed to parse)" };
+            fail("nested too deeply");
           }
-          return opts.eof_value;
+
+          ++depth;
+          auto const ret(*pos == '{' ? read_object() : read_array());
+          --depth;
+          return ret;
         }
+      case '"':
+        return make_box<obj::persistent_string>(read_string());
+      case 't':
+        read_literal("true");
+        return jank_true;
+      case 'f':
+        read_literal("false");
+        return jank_false;
+      case 'n':
+        read_literal("null");
+        return jank_nil;
+      default:
+        return read_number();
+    }
+  }
+
+  object_ref reader::read_document()
+  {
+    skip_whitespace();
+    if(pos == end)
+    {
+      if(opts.eof_error)
+      {
+        fail("unexpected end of input");
+      }
+      return opts.eof_value;
+    }
+
+    auto const ret(read_value());
+    skip_whitespace();
+    if(pos != end)
+    {
+      fail("unexpected trailing input");
     }
+    return ret;
   }
 
   object_ref read_str(jtl::immutable_string const &string, read_options const &opts)
   {
-    auto const json(nlohmann::json::parse(string));
-    return read(json, opts);
+    reader r{ string.data(), string.data(), string.data() + string.size(), opts };
+    return r.read_document();
   }
 }
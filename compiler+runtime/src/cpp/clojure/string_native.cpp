@@ -195,14 +195,14 @@ namespace clojure::string_native
     {
       if(back_index < front_index)
       {
-        buff(s.substr(back_index, front_index - back_index));
+        buff(jtl::immutable_string_view{ s.data() + back_index, front_index - back_index });
       }
       buff(replacement);
     }
 
     if(back_index < s_size)
     {
-      buff(s.substr(back_index));
+      buff(jtl::immutable_string_view{ s.data() + back_index, s_size - back_index });
     }
 
     return buff.release();
@@ -219,37 +219,45 @@ namespace clojure::string_native
                                 obj::re_pattern_ref const match,
                                 jtl::immutable_string const &replacement)
   {
-    std::string const s_str{ s.c_str() };
-    std::string const replacement_str{ replacement.c_str() };
-    return std::regex_replace(s_str, match->regex, replacement_str);
+    /* The input is matched in place and the output goes straight into the result. */
+    jtl::string_builder buff{ s.size() };
+    std::regex_replace(std::back_inserter(buff),
+                       s.data(),
+                       s.data() + s.size(),
+                       match->regex,
+                       replacement.c_str());
+    return buff.release();
   }
 
   jtl::immutable_string replace(jtl::immutable_string const &s,
                                 obj::re_pattern_ref const match,
                                 object_ref const replacement)
   {
-    std::string const s_str{ s.c_str() };
-    std::sregex_iterator const end{};
-    std::sregex_iterator it(s_str.begin(), s_str.end(), match->regex);
+    std::cregex_iterator const end{};
+    std::cregex_iterator it(s.data(), s.data() + s.size(), match->regex);
 
     if(it == end)
     {
       return s;
     }
 
-    std::string suffix{};
-    jtl::string_builder buff{};
+    /* Only the matches are copied out, since they're handed to the replacement fn. Everything
+     * between them goes straight from the input into the result. */
+    auto rest{ s.data() };
+    jtl::string_builder buff{ s.size() };
 
     for(; it != end; ++it)
     {
-      buff((*it).prefix().str());
-      auto const match_str(make_box<obj::persistent_string>((*it)[0].str()));
-      auto const replacement_value(replacement.call(make_box<obj::persistent_string>(match_str)));
+      auto const &m{ (*it)[0] };
+      buff(jtl::immutable_string_view{ rest, static_cast<usize>(m.first - rest) });
+      auto const match_str(make_box<obj::persistent_string>(
+        jtl::immutable_string{ m.first, static_cast<usize>(m.second - m.first) }));
+      auto const replacement_value(replacement.call(match_str));
       buff(try_object<obj::persistent_string>(replacement_value)->data);
-      suffix = (*it).suffix().str();
+      rest = m.second;
     }
 
-    buff(suffix);
+    buff(jtl::immutable_string_view{ rest, static_cast<usize>(s.data() + s.size() - rest) });
 
     return buff.release();
   }
@@ -382,6 +390,16 @@ namespace clojure::string_native
     return s.substr(0, r);
   }
 
+  /* A piece which is most of `s` shares its buffer, like any `substr`. Smaller pieces are
+   * copied, so that keeping one small field from a large payload doesn't keep the whole
+   * payload alive. */
+  static obj::persistent_string_ref
+  split_piece(jtl::immutable_string const &s, std::cregex_token_iterator const &iter)
+  {
+    return make_box<obj::persistent_string>(
+      s.substr(iter->first - s.data(), iter->second - iter->first));
+  }
+
   obj::persistent_vector_ref split(jtl::immutable_string const &s, obj::re_pattern_ref const re)
   {
     detail::native_transient_vector vec;
@@ -392,28 +410,26 @@ namespace clojure::string_native
     }
     else
     {
-      auto const regex(re->regex);
-
-      std::string const search_str{ s.c_str() };
-
-      std::sregex_token_iterator iter(search_str.begin(), search_str.end(), regex, -1);
-      std::sregex_token_iterator const end;
+      std::cregex_token_iterator iter(s.data(), s.data() + s.size(), re->regex, -1);
+      std::cregex_token_iterator const end;
 
+      /* Discard all trailing empty strings to match java.lang.String/split behavior. Empty
+       * pieces are only pushed once we know a non-empty piece follows them. */
+      usize pending_empty{};
       for(; iter != end; ++iter)
       {
-        vec.push_back(make_box<obj::persistent_string>(iter->str()));
-      }
+        if(iter->first == iter->second)
+        {
+          ++pending_empty;
+          continue;
+        }
 
-      /* Discard all trailing empty strings to match java.lang.String/split behavior. */
-      auto n(vec.size());
-      for(; n > 0; --n)
-      {
-        if(!expect_object<obj::persistent_string>(vec[n - 1])->data.empty())
+        for(; pending_empty > 0; --pending_empty)
         {
-          break;
+          vec.push_back(make_box<obj::persistent_string>());
         }
+        vec.push_back(split_piece(s, iter));
       }
-      vec.take(n);
     }
 
     return make_box<obj::persistent_vector>(vec.persistent());
@@ -427,24 +443,20 @@ namespace clojure::string_native
       return split(s, re);
     }
 
-    auto const regex(re->regex);
-
-    std::string const search_str{ s.c_str() };
-
     detail::native_transient_vector vec;
 
-    std::sregex_token_iterator iter(search_str.begin(), search_str.end(), regex, -1);
-    std::sregex_token_iterator const end;
+    std::cregex_token_iterator iter(s.data(), s.data() + s.size(), re->regex, -1);
+    std::cregex_token_iterator const end;
 
     int i{ 1 };
     for(; i < limit && iter != end; ++i, ++iter)
     {
-      vec.push_back(make_box<obj::persistent_string>(iter->str().c_str()));
+      vec.push_back(split_piece(s, iter));
     }
 
-    if(i == limit)
+    if(i == limit && iter != end)
     {
-      vec.push_back(make_box(s.substr(iter->first - search_str.begin())));
+      vec.push_back(make_box<obj::persistent_string>(s.substr(iter->first - s.data())));
     }
 
     return make_box<obj::persistent_vector>(vec.persistent());
@@ -747,6 +747,13 @@ namespace jank::analyze::cpp_util
         return type;
       }
     }
+    /* Shape maps are lowered to `_jank_hmap`, so that's the type we end up with. */
+    else if(o.get_type() == runtime::object_type::persistent_shape_map)
+    {
+      static auto const type{ Cpp::GetTypeFromScope(
+        resolve_scope("jank.runtime.obj.persistent_hash_map_ref").expect_ok()) };
+      return type;
+    }
 
     return literal_type(o, is_boxed);
   }
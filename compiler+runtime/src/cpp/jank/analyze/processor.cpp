@@ -4212,6 +4212,12 @@ namespace jank::analyze
 
     auto const raw_string{ expect_object<runtime::obj::persistent_string>(obj)->data };
 
+    /* The C++ code may refer to any local by name, without us seeing it. */
+    if(fn_ctx.is_some())
+    {
+      fn_ctx.unwrap()->has_cpp_raw = true;
+    }
+
     /* We wrap all cpp/raw strings in unique preprocessor guards because jank currently does
        codegen twice when compiling and this can lead to ODR violations. */
     auto const content_hash{ std::hash<jtl::immutable_string>{}(raw_string) };
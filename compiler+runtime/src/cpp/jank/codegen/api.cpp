@@ -5,6 +5,8 @@
 #include <jank/runtime/obj/transient_hash_map.hpp>
 #include <jank/runtime/obj/transient_array_map.hpp>
 #include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/transient_vector.hpp>
 #include <jank/runtime/obj/transient_hash_set.hpp>
 
@@ -18,6 +20,59 @@ jank::runtime::var_ref _jank_var_owned(char const * const sym)
   return jank::runtime::__rt_ctx->intern_owned_var(sym).expect_ok();
 }
 
+void _jank_vars(_jank_lifted_var const * const vars, jank::u64 const count)
+{
+  /* Lifted vars tend to cluster around a few namespaces, like clojure.core, so we hold
+   * onto the last ns we saw and only look up another one when it changes. */
+  jtl::immutable_string_view last_ns_name{ "" };
+  jank::runtime::ns_ref last_ns;
+
+  for(jank::u64 i{}; i < count; ++i)
+  {
+    auto const &v{ vars[i] };
+    jtl::immutable_string_view const qualified_name{ v.qualified_name };
+    /* Namespaces can't contain a slash, but var names can (i.e. clojure.core//), so we
+     * split on the first one. */
+    auto const slash{ qualified_name.find('/') };
+    jank_debug_assert(slash != jtl::immutable_string_view::npos);
+    jtl::immutable_string_view const ns_name{ qualified_name.data(), slash };
+    jtl::immutable_string_view const name{ qualified_name.data() + slash + 1,
+                                           qualified_name.size() - slash - 1 };
+
+    if(last_ns.is_nil() || ns_name != last_ns_name)
+    {
+      last_ns = jank::runtime::__rt_ctx->intern_ns(ns_name);
+      last_ns_name = ns_name;
+    }
+
+    new(v.slot) jank::runtime::var_ref{ v.owned ? last_ns->intern_owned_var(name)
+                                                : last_ns->intern_var(name) };
+  }
+}
+
+void _jank_keywords(_jank_lifted_keyword const * const keywords, jank::u64 const count)
+{
+  /* This is the same as context::intern_keyword, but we only take the lock once for the
+   * whole module, rather than once per keyword. */
+  auto locked_keywords(jank::runtime::__rt_ctx->keywords.wlock());
+  for(jank::u64 i{}; i < count; ++i)
+  {
+    auto const &k{ keywords[i] };
+    jtl::immutable_string const qualified_name{ k.qualified_name };
+    auto found(locked_keywords->find(qualified_name));
+    if(found == locked_keywords->end())
+    {
+      found = locked_keywords
+                ->emplace(qualified_name,
+                          jank::runtime::make_box<jank::runtime::obj::keyword>(
+                            jank::runtime::detail::must_be_interned{},
+                            qualified_name))
+                .first;
+    }
+    new(k.slot) jank::runtime::obj::keyword_ref{ found->second };
+  }
+}
+
 jank::runtime::obj::keyword_ref _jank_keyword(char const * const ns, char const * const name)
 {
   return jank::runtime::__rt_ctx->intern_keyword(ns, name, true).expect_ok();
@@ -283,6 +338,106 @@ _jank_hmap(char const * const meta, jank::u64 const pairs, ...)
   return ret;
 }
 
+jank::runtime::obj::persistent_vector_ref
+_jank_vec_array(char const * const meta,
+                jank::runtime::object_ref const * const elems,
+                jank::u64 const count)
+{
+  /* immer fills each leaf in place when given the whole range, rather than going through
+   * a transient one push at a time. */
+  jank::runtime::detail::native_persistent_vector vec(elems, elems + count);
+  if(meta)
+  {
+    return jank::runtime::make_box<jank::runtime::obj::persistent_vector>(
+      jank::runtime::lazy_meta{ meta },
+      jtl::move(vec));
+  }
+  return jank::runtime::make_box<jank::runtime::obj::persistent_vector>(jtl::move(vec));
+}
+
+jank::runtime::obj::persistent_vector_ref
+_jank_vec_array(jank::runtime::object_ref const * const elems, jank::u64 const count)
+{
+  return _jank_vec_array(nullptr, elems, count);
+}
+
+jank::runtime::obj::persistent_hash_set_ref
+_jank_hset_array(char const * const meta,
+                 jank::runtime::object_ref const * const elems,
+                 jank::u64 const count)
+{
+  jank::runtime::detail::native_transient_hash_set trans;
+  for(jank::u64 i{}; i < count; ++i)
+  {
+    trans.insert(elems[i]);
+  }
+
+  if(meta)
+  {
+    return jank::runtime::make_box<jank::runtime::obj::persistent_hash_set>(
+      jank::runtime::lazy_meta{ meta },
+      trans.persistent());
+  }
+  return jank::runtime::make_box<jank::runtime::obj::persistent_hash_set>(trans.persistent());
+}
+
+jank::runtime::obj::persistent_hash_set_ref
+_jank_hset_array(jank::runtime::object_ref const * const elems, jank::u64 const count)
+{
+  return _jank_hset_array(nullptr, elems, count);
+}
+
+jank::runtime::obj::persistent_array_map_ref
+_jank_amap_array(char const * const meta,
+                 jank::runtime::object_ref const * const kvs,
+                 jank::u64 const pairs)
+{
+  jank::runtime::obj::transient_array_map trans;
+  trans.data.reserve(pairs);
+  for(jank::u64 i{}; i < pairs; ++i)
+  {
+    trans.assoc_in_place(kvs[i * 2], kvs[i * 2 + 1]);
+  }
+
+  if(meta)
+  {
+    return trans.to_persistent(meta);
+  }
+  return trans.to_persistent();
+}
+
+jank::runtime::obj::persistent_array_map_ref
+_jank_amap_array(jank::runtime::object_ref const * const kvs, jank::u64 const pairs)
+{
+  return _jank_amap_array(nullptr, kvs, pairs);
+}
+
+jank::runtime::obj::persistent_hash_map_ref
+_jank_hmap_array(char const * const meta,
+                 jank::runtime::object_ref const * const kvs,
+                 jank::u64 const pairs)
+{
+  jank::runtime::detail::native_transient_hash_map trans;
+  for(jank::u64 i{}; i < pairs; ++i)
+  {
+    trans.set(kvs[i * 2], kvs[i * 2 + 1]);
+  }
+
+  if(meta)
+  {
+    return jank::runtime::make_box<jank::runtime::obj::persistent_hash_map>(
+      jank::runtime::lazy_meta{ meta },
+      trans.persistent());
+  }
+  return jank::runtime::make_box<jank::runtime::obj::persistent_hash_map>(trans.persistent());
+}
+
+jank::runtime::obj::persistent_hash_map_ref
+_jank_hmap_array(jank::runtime::object_ref const * const kvs, jank::u64 const pairs)
+{
+  return _jank_hmap_array(nullptr, kvs, pairs);
+}
+
 jank::runtime::obj::jit_function_ref _jank_fn(jank::runtime::callable_arity_flags const flags)
 {
   return jank::runtime::make_box<jank::runtime::obj::jit_function>(flags);
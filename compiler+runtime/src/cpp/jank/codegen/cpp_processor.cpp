@@ -60,6 +60,29 @@ namespace jank::codegen
       deferred_bindings.emplace_back(context, binding);
     }
 
+    /* Whether the instruction with this name is a literal keyword. These are gathered on first
+     * use, since most functions don't call keywords. */
+    bool is_keyword_literal(identifier const &name)
+    {
+      if(!keyword_literals_found)
+      {
+        for(auto const &block : function->blocks)
+        {
+          for(auto const &inst : block.instructions)
+          {
+            if(inst->kind == ir::instruction_kind::literal
+               && static_box_cast<ir::inst::literal>(inst)->obj.get_type()
+                 == object_type::keyword)
+            {
+              keyword_literals.emplace(inst->name);
+            }
+          }
+        }
+        keyword_literals_found = true;
+      }
+      return keyword_literals.contains(name);
+    }
+
     jtl::immutable_string declaration_str() const
     {
       native_transient_string declaration;
@@ -118,6 +141,8 @@ namespace jank::codegen
     usize block_index{}, instruction_index{};
     native_vector<std::pair<jtl::immutable_string, jtl::immutable_string>> deferred_bindings;
     native_set<ir::identifier> seen_blocks;
+    native_set<ir::identifier> keyword_literals;
+    bool keyword_literals_found{};
   };
 
   using ir::identifier;
@@ -449,7 +474,10 @@ namespace jank::codegen
             }
             util::format_to(buffer, ")");
           }
-          else if constexpr(std::same_as<T, obj::persistent_hash_map>)
+          /* Shape maps are rebuilt as hash maps. They can only come from macros, since the
+           * reader doesn't make them, and it's the value which matters. */
+          else if constexpr(std::same_as<T, obj::persistent_hash_map>
+                            || std::same_as<T, obj::persistent_shape_map>)
           {
             util::format_to(buffer, "_jank_hmap(");
             if(should_gen_meta(typed_o->get_meta()))
@@ -593,6 +621,47 @@ namespace jank::codegen
   jtl::option<identifier> gen(ir::inst::dynamic_call_ref const inst, builder &b)
   {
     b.next_instruction();
+
+    /* Calls like `(:name m)` get their own cache, so that repeated lookups into shape maps
+     * of the same shape skip the key scan. */
+    if((inst->args.size() == 1 || inst->args.size() == 2) && b.is_keyword_literal(inst->fn))
+    {
+      util::format_to(b.body_buffer,
+                      "static jank::runtime::detail::shape_slot_cache {}_cache;\n",
+                      inst->name);
+      util::format_to(b.body_buffer,
+                      "auto const {}(jank::runtime::keyword_get({}, {}_cache",
+                      inst->name,
+                      inst->fn,
+                      inst->name);
+      for(auto const &arg : inst->args)
+      {
+        util::format_to(b.body_buffer, ", {}", arg);
+      }
+      util::format_to(b.body_buffer, "));\n");
+      return inst->name;
+    }
+
+    /* Every other call site gets a cache of the callee it last saw, so that calls to the
+     * same function skip the virtual dispatch. See `detail::call_site_cache`. */
+    if(util::cli::opts.call_site_caches)
+    {
+      util::format_to(b.body_buffer,
+                      "static auto &{}_site(jank::runtime::detail::call_site_cache::create());\n",
+                      inst->name);
+      util::format_to(b.body_buffer,
+                      "auto const {}(jank::runtime::dynamic_call({}_site, {}",
+                      inst->name,
+                      inst->name,
+                      inst->fn);
+      for(auto const &arg : inst->args)
+      {
+        util::format_to(b.body_buffer, ", {}", arg);
+      }
+      util::format_to(b.body_buffer, "));\n");
+      return inst->name;
+    }
+
     util::format_to(b.body_buffer, "auto const {}({}.call(", inst->name, inst->fn);
     bool need_comma{};
     for(auto const &arg : inst->args)
@@ -609,6 +678,138 @@ namespace jank::codegen
     return inst->name;
   }
 
+  /* The lazy path would build a lazy sequence, a cons and a closure call per element per
+   * stage. Instead, the stages and the reducing fn are composed into a single step, which
+   * the source is reduced with. Vectors, lists and integer ranges walk their own storage for
+   * that, so no seq is allocated per element. Each element goes through every stage before
+   * the next one is pulled, so stage fns see the same elements, in the same order, as with
+   * the lazy path, but not at the same time, since the lazy `map` and `filter` realize
+   * chunked sources 32 elements at a time. A `take` which is done stops the reduce before
+   * anything more is pulled from the source. */
+  jtl::option<identifier> gen(ir::inst::fused_reduce_ref const inst, builder &b)
+  {
+    b.next_instruction();
+
+    using stage_kind = ir::inst::fused_reduce::stage_kind;
+
+    auto const &name{ inst->name };
+    util::format_to(b.body_buffer, "jank::runtime::object_ref {}", name);
+    if(inst->init.is_some())
+    {
+      util::format_to(b.body_buffer, "({})", inst->init.unwrap());
+    }
+    util::format_to(b.body_buffer, ";\n{\n");
+    util::format_to(b.body_buffer, "bool {}_has_acc{ {} };\n", name, inst->init.is_some());
+
+    /* A `take` of nothing never looks at its input, so the source isn't even reduced. */
+    util::format_to(b.body_buffer, "bool {}_done{ false", name);
+    for(auto const &stage : inst->stages)
+    {
+      if(stage.kind == stage_kind::take)
+      {
+        util::format_to(b.body_buffer, " || !jank::runtime::is_pos({})", stage.value);
+      }
+    }
+    util::format_to(b.body_buffer, " };\n");
+    for(usize i{}; i < inst->stages.size(); ++i)
+    {
+      if(inst->stages[i].kind == stage_kind::take)
+      {
+        util::format_to(b.body_buffer,
+                        "jank::runtime::object_ref {}_take_{}({});\n",
+                        name,
+                        i,
+                        inst->stages[i].value);
+      }
+    }
+
+    /* The accumulator lives outside of the step, since without an init the first element
+     * which makes it through the stages becomes the accumulator. */
+    util::format_to(b.body_buffer, "if(!{}_done)\n{\n", name);
+    util::format_to(b.body_buffer,
+                    "std::function<jank::runtime::object_ref(jank::runtime::object_ref, "
+                    "jank::runtime::object_ref)> {}_step{ [&](jank::runtime::object_ref, "
+                    "jank::runtime::object_ref {}_x) -> jank::runtime::object_ref\n{\n",
+                    name,
+                    name);
+
+    usize open_scopes{};
+    for(usize i{}; i < inst->stages.size(); ++i)
+    {
+      auto const &stage{ inst->stages[i] };
+      switch(stage.kind)
+      {
+        case stage_kind::map:
+          util::format_to(b.body_buffer, "{}_x = {}.call({}_x);\n", name, stage.value, name);
+          break;
+        case stage_kind::filter:
+          util::format_to(b.body_buffer,
+                          "if(jank::runtime::truthy({}.call({}_x)))\n{\n",
+                          stage.value,
+                          name);
+          ++open_scopes;
+          break;
+        case stage_kind::remove:
+          util::format_to(b.body_buffer,
+                          "if(!jank::runtime::truthy({}.call({}_x)))\n{\n",
+                          stage.value,
+                          name);
+          ++open_scopes;
+          break;
+        case stage_kind::take:
+          util::format_to(b.body_buffer,
+                          "{}_take_{} = jank::runtime::dec({}_take_{});\n",
+                          name,
+                          i,
+                          name,
+                          i);
+          util::format_to(b.body_buffer,
+                          "if(!jank::runtime::is_pos({}_take_{}))\n{\n{}_done = true;\n}\n",
+                          name,
+                          i,
+                          name);
+          break;
+      }
+    }
+
+    util::format_to(b.body_buffer, "if({}_has_acc)\n{\n", name);
+    util::format_to(b.body_buffer, "{} = {}.call({}, {}_x);\n", name, inst->fn, name, name);
+    util::format_to(b.body_buffer,
+                    "if({}.get_type() == jank::runtime::object_type::reduced)\n{\n",
+                    name);
+    util::format_to(b.body_buffer,
+                    "{} = jank::runtime::expect_object<jank::runtime::obj::reduced>({})->val;\n",
+                    name,
+                    name);
+    util::format_to(b.body_buffer, "{}_done = true;\n}\n}\n", name);
+    util::format_to(b.body_buffer,
+                    "else\n{\n{} = {}_x;\n{}_has_acc = true;\n}\n",
+                    name,
+                    name,
+                    name);
+    for(usize i{}; i < open_scopes; ++i)
+    {
+      util::format_to(b.body_buffer, "}\n");
+    }
+    util::format_to(b.body_buffer,
+                    "return {}_done ? jank::runtime::reduced(jank::runtime::object_ref())"
+                    " : jank::runtime::object_ref();\n} };\n",
+                    name);
+    util::format_to(b.body_buffer,
+                    "jank::runtime::reduce(jank::runtime::make_box<"
+                    "jank::runtime::obj::native_function_wrapper>(std::move({}_step)), "
+                    "jank::runtime::object_ref(), {});\n}\n",
+                    name,
+                    inst->source);
+
+    util::format_to(b.body_buffer,
+                    "if(!{}_has_acc)\n{\n{} = {}.call();\n}\n}\n",
+                    name,
+                    name,
+                    inst->fn);
+    return name;
+  }
+
   jtl::option<identifier> gen(ir::inst::literal_ref const inst, builder &b)
   {
     b.next_instruction();
@@ -635,20 +836,50 @@ namespace jank::codegen
     return inst->name;
   }
 
-  jtl::option<identifier> gen(ir::inst::persistent_vector_ref const inst, builder &b)
+  /* Non-constant collection literals build their elements into one stack array, which the
+   * runtime then builds the collection from in bulk. Returns the name of the array, or
+   * `nullptr` if there are no elements, since C++ doesn't allow empty arrays. */
+  template <typename F>
+  static jtl::immutable_string
+  gen_elems_array(identifier const &name, usize const count, builder &b, F const &gen_elems)
   {
-    b.next_instruction();
-    util::format_to(b.body_buffer, "auto const {}(_jank_vec(", inst->name);
-    if(!is_empty(inst->meta))
+    if(count == 0)
     {
-      util::format_to(b.body_buffer, "\"{}\", ", util::escape(inst->meta.to_code_string()));
+      return "nullptr";
     }
-    util::format_to(b.body_buffer, "{}", inst->values.size());
-    for(auto const &val : inst->values)
+
+    auto const array_name{ util::format("{}_elems", name) };
+    util::format_to(b.body_buffer, "jank::runtime::object_ref const {}[]{", array_name);
+    gen_elems();
+    util::format_to(b.body_buffer, " };\n");
+    return array_name;
+  }
+
+  static void gen_collection_call(identifier const &name,
+                                  jtl::immutable_string const &fn,
+                                  runtime::object_ref const meta,
+                                  jtl::immutable_string const &elems,
+                                  usize const count,
+                                  builder &b)
+  {
+    util::format_to(b.body_buffer, "auto const {}({}(", name, fn);
+    if(!is_empty(meta))
     {
-      util::format_to(b.body_buffer, ", {}.erase()", val);
+      util::format_to(b.body_buffer, "\"{}\", ", util::escape(meta.to_code_string()));
     }
-    util::format_to(b.body_buffer, "));\n");
+    util::format_to(b.body_buffer, "{}, {}));\n", elems, count);
+  }
+
+  jtl::option<identifier> gen(ir::inst::persistent_vector_ref const inst, builder &b)
+  {
+    b.next_instruction();
+    auto const elems{ gen_elems_array(inst->name, inst->values.size(), b, [&]() {
+      for(auto const &val : inst->values)
+      {
+        util::format_to(b.body_buffer, " {}.erase(),", val);
+      }
+    }) };
+    gen_collection_call(inst->name, "_jank_vec_array", inst->meta, elems, inst->values.size(), b);
 
     return inst->name;
   }
@@ -656,18 +887,13 @@ namespace jank::codegen
   jtl::option<identifier> gen(ir::inst::persistent_array_map_ref const inst, builder &b)
   {
     b.next_instruction();
-    util::format_to(b.body_buffer, "auto const {}(_jank_amap(", inst->name);
-    if(!is_empty(inst->meta))
-    {
-      util::format_to(b.body_buffer, "\"{}\",", util::escape(inst->meta.to_code_string()));
-    }
-
-    util::format_to(b.body_buffer, "{}", inst->values.size());
-    for(auto const &val : inst->values)
-    {
-      util::format_to(b.body_buffer, ", {}.erase(), {}.erase()", val.first, val.second);
-    }
-    util::format_to(b.body_buffer, "));\n");
+    auto const elems{ gen_elems_array(inst->name, inst->values.size(), b, [&]() {
+      for(auto const &val : inst->values)
+      {
+        util::format_to(b.body_buffer, " {}.erase(), {}.erase(),", val.first, val.second);
+      }
+    }) };
+    gen_collection_call(inst->name, "_jank_amap_array", inst->meta, elems, inst->values.size(), b);
 
     return inst->name;
   }
@@ -675,18 +901,13 @@ namespace jank::codegen
   jtl::option<identifier> gen(ir::inst::persistent_hash_map_ref const inst, builder &b)
   {
     b.next_instruction();
-    util::format_to(b.body_buffer, "auto const {}(_jank_hmap(", inst->name);
-    if(!is_empty(inst->meta))
-    {
-      util::format_to(b.body_buffer, "\"{}\",", util::escape(inst->meta.to_code_string()));
-    }
-
-    util::format_to(b.body_buffer, "{}", inst->values.size());
-    for(auto const &val : inst->values)
-    {
-      util::format_to(b.body_buffer, ", {}.erase(), {}.erase()", val.first, val.second);
-    }
-    util::format_to(b.body_buffer, "));\n");
+    auto const elems{ gen_elems_array(inst->name, inst->values.size(), b, [&]() {
+      for(auto const &val : inst->values)
+      {
+        util::format_to(b.body_buffer, " {}.erase(), {}.erase(),", val.first, val.second);
+      }
+    }) };
+    gen_collection_call(inst->name, "_jank_hmap_array", inst->meta, elems, inst->values.size(), b);
 
     return inst->name;
   }
@@ -694,18 +915,13 @@ namespace jank::codegen
   jtl::option<identifier> gen(ir::inst::persistent_hash_set_ref const inst, builder &b)
   {
     b.next_instruction();
-    util::format_to(b.body_buffer, "auto const {}(_jank_hset(", inst->name);
-    if(!is_empty(inst->meta))
-    {
-      util::format_to(b.body_buffer, "\"{}\",", util::escape(inst->meta.to_code_string()));
-    }
-
-    util::format_to(b.body_buffer, "{}", inst->values.size());
-    for(auto const &val : inst->values)
-    {
-      util::format_to(b.body_buffer, ", {}.erase()", val);
-    }
-    util::format_to(b.body_buffer, "));\n");
+    auto const elems{ gen_elems_array(inst->name, inst->values.size(), b, [&]() {
+      for(auto const &val : inst->values)
+      {
+        util::format_to(b.body_buffer, " {}.erase(),", val);
+      }
+    }) };
+    gen_collection_call(inst->name, "_jank_hset_array", inst->meta, elems, inst->values.size(), b);
 
     return inst->name;
   }
@@ -2051,27 +2267,26 @@ namespace jank::codegen
                         last->second.name);
       }
 
-      for(auto const &v : b.module->lifted_vars)
+      /* Since global ctors don't run when loading object files, we need to manually
+       * initialize these. Rather than generating a call for each var, we describe them
+       * all in a constant table, which needs no initialization of its own. The runtime
+       * then interns them all in one pass, placement newing each slot. */
+      if(!b.module->lifted_vars.empty())
       {
-        /* Since global ctors don't run when loading object files, we
-         * need to manually initialize these. We use placement new to
-         * properly run ctors, just like what would happen normally. */
-        if(v.second.owned)
-        {
-          util::format_to(b.footer_buffer,
-                          "new (&{}::{}) auto(_jank_var_owned(\"{}\"));\n",
-                          native_ns,
-                          v.second.name,
-                          v.first);
-        }
-        else
+        util::format_to(b.footer_buffer,
+                        "static _jank_lifted_var const _jank_lifted_vars[]{\n");
+        for(auto const &v : b.module->lifted_vars)
         {
           util::format_to(b.footer_buffer,
-                          "new (&{}::{}) auto(_jank_var(\"{}\"));\n",
+                          "{ \"{}\", &{}::{}, {} },\n",
+                          v.first,
                           native_ns,
                           v.second.name,
-                          v.first);
+                          v.second.owned);
         }
+        util::format_to(b.footer_buffer,
+                        "};\n_jank_vars(_jank_lifted_vars, {});\n",
+                        b.module->lifted_vars.size());
       }
 
       if(!b.module->lifted_constants.empty())
@@ -2089,13 +2304,41 @@ namespace jank::codegen
                         last->second);
       }
 
+      /* Keywords get the same table treatment as vars, since they're the most common
+       * lifted constant and interning each of them separately means taking the keyword
+       * lock once per keyword. */
+      native_vector<std::pair<jtl::immutable_string, identifier>> lifted_keywords;
       for(auto const &v : b.module->lifted_constants)
       {
+        if(v.first.get_type() == object_type::keyword)
+        {
+          auto const kw{ expect_object<obj::keyword>(v.first) };
+          lifted_keywords.emplace_back(kw->sym->to_string(), v.second);
+          continue;
+        }
+
         util::format_to(b.footer_buffer, "new (&{}::{}) auto(", native_ns, v.second);
         detail::gen_constant(v.first, b.footer_buffer, true);
         util::format_to(b.footer_buffer, ");\n");
       }
 
+      if(!lifted_keywords.empty())
+      {
+        util::format_to(b.footer_buffer,
+                        "static _jank_lifted_keyword const _jank_lifted_keywords[]{\n");
+        for(auto const &kw : lifted_keywords)
+        {
+          util::format_to(b.footer_buffer,
+                          "{ \"{}\", &{}::{} },\n",
+                          util::escape(kw.first),
+                          native_ns,
+                          kw.second);
+        }
+        util::format_to(b.footer_buffer,
+                        "};\n_jank_keywords(_jank_lifted_keywords, {});\n",
+                        lifted_keywords.size());
+      }
+
       auto const fn_tmp{ b.expression_str() };
       util::format_to(b.footer_buffer, "{}->call();\n", fn_tmp);
 
@@ -235,6 +235,21 @@ namespace jank::ir::inst
   {
   }
 
+  fused_reduce::fused_reduce(identifier const &name,
+                             jtl::ptr<void> const type,
+                             read::source const &location,
+                             identifier const &fn,
+                             jtl::option<identifier> const &init,
+                             identifier const &source,
+                             native_vector<stage> &&stages)
+    : instruction{ instruction_kind::fused_reduce, name, type, location }
+    , fn{ fn }
+    , init{ init }
+    , source{ source }
+    , stages{ jtl::move(stages) }
+  {
+  }
+
   named_recursion::named_recursion(identifier const &name,
                                    jtl::ptr<void> const type,
                                    read::source const &location,
@@ -0,0 +1,167 @@
+#include <algorithm>
+
+#include <jank/ir/processor.hpp>
+#include <jank/ir/walk.hpp>
+#include <jank/ir/util.hpp>
+
+namespace jank::ir
+{
+  using stage_kind = inst::fused_reduce::stage_kind;
+
+  static jtl::option<stage_kind> stage_kind_of(jtl::immutable_string const &qualified_var)
+  {
+    if(qualified_var == "clojure.core/map")
+    {
+      return stage_kind::map;
+    }
+    if(qualified_var == "clojure.core/filter")
+    {
+      return stage_kind::filter;
+    }
+    if(qualified_var == "clojure.core/remove")
+    {
+      return stage_kind::remove;
+    }
+    if(qualified_var == "clojure.core/take")
+    {
+      return stage_kind::take;
+    }
+    return jtl::none;
+  }
+
+  /* Instructions which may open or close a C++ scope. A value from before one of these may
+   * not be visible after it, so a chain can't be fused across them. */
+  static bool changes_scope(instruction_kind const kind)
+  {
+    switch(kind)
+    {
+      case instruction_kind::cpp_scope_open:
+      case instruction_kind::cpp_scope_close:
+      case instruction_kind::try_:
+      case instruction_kind::catch_:
+      case instruction_kind::finally:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /* Fuses `(reduce f init (map g (filter p (take n coll))))`, and any other chain of `map`,
+   * `filter`, `remove` and `take` calls ending in a `reduce`, into a single `fused_reduce`.
+   * This is how `->>` pipelines end up, so they no longer build a lazy sequence per stage.
+   *
+   * A chain is only fused when none of its intermediate sequences escape. That is, each one
+   * is only used by the next call in the chain. Otherwise, the lazy path is kept, since the
+   * sequence needs to exist. Each call in the chain also needs to be in the same block, with
+   * no scope changes in between, so that all of their inputs are still visible where the
+   * `reduce` is.
+   *
+   * Like the other var based passes, this assumes that the `clojure.core` vars involved
+   * aren't redefined after the code is compiled. */
+  void fuse_seq_chains(function &fn)
+  {
+    native_unordered_map<identifier, jtl::immutable_string> var_derefs;
+    native_unordered_map<identifier, usize> uses;
+    for(auto const &block : fn.blocks)
+    {
+      for(auto const &instr : block.instructions)
+      {
+        if(instr->kind == instruction_kind::var_deref)
+        {
+          auto const &deref{ static_cast<inst::var_deref &>(*instr.data) };
+          var_derefs[deref.name] = deref.qualified_var;
+        }
+        walk_references(instr, [&](identifier const &ref) { ++uses[ref]; });
+      }
+    }
+
+    auto const var_of{ [&](identifier const &name) -> jtl::immutable_string {
+      auto const found{ var_derefs.find(name) };
+      if(found == var_derefs.end())
+      {
+        return "";
+      }
+      return found->second;
+    } };
+
+    for(auto &block : fn.blocks)
+    {
+      native_unordered_map<identifier, usize> positions;
+      for(usize i{}; i < block.instructions.size(); ++i)
+      {
+        auto const instr{ block.instructions[i] };
+        positions[instr->name] = i;
+
+        if(instr->kind != instruction_kind::dynamic_call)
+        {
+          continue;
+        }
+        auto const &reduce{ static_cast<inst::dynamic_call &>(*instr.data) };
+        if(var_of(reduce.fn) != "clojure.core/reduce"
+           || (reduce.args.size() != 2 && reduce.args.size() != 3))
+        {
+          continue;
+        }
+
+        native_vector<inst::fused_reduce::stage> stages;
+        native_vector<usize> fused_positions;
+        auto source{ reduce.args.back() };
+        while(true)
+        {
+          auto const found{ positions.find(source) };
+          if(found == positions.end() || uses[source] != 1)
+          {
+            break;
+          }
+
+          auto const producer{ block.instructions[found->second] };
+          if(producer->kind != instruction_kind::dynamic_call)
+          {
+            break;
+          }
+          auto const &call{ static_cast<inst::dynamic_call &>(*producer.data) };
+          auto const kind{ stage_kind_of(var_of(call.fn)) };
+          if(kind.is_none() || call.args.size() != 2)
+          {
+            break;
+          }
+
+          bool crosses_scope{};
+          for(auto j{ found->second + 1 }; j < i; ++j)
+          {
+            crosses_scope |= changes_scope(block.instructions[j]->kind);
+          }
+          if(crosses_scope)
+          {
+            break;
+          }
+
+          stages.push_back({ kind.unwrap(), call.args[0] });
+          fused_positions.push_back(found->second);
+          source = call.args[1];
+        }
+
+        if(stages.empty())
+        {
+          continue;
+        }
+
+        std::ranges::reverse(stages);
+        block.instructions[i] = jtl::make_ref<inst::fused_reduce>(
+          reduce.name,
+          reduce.type,
+          reduce.location,
+          reduce.args[0],
+          reduce.args.size() == 3 ? jtl::option<identifier>{ reduce.args[1] } : jtl::none,
+          source,
+          jtl::move(stages));
+
+        /* The intermediate calls only built lazy sequences, so they can just go away. */
+        for(auto const position : fused_positions)
+        {
+          replace_with_nop(fn, block.name, block.instructions[position]->name);
+        }
+      }
+    }
+  }
+}
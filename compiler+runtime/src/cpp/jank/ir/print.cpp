@@ -271,6 +271,43 @@ namespace jank::ir
     util::format_to(sb, "] :type \"{}\"}", get_qualified_type_name(type));
   }
 
+  static char const *stage_kind_str(inst::fused_reduce::stage_kind const kind)
+  {
+    switch(kind)
+    {
+      case inst::fused_reduce::stage_kind::map:
+        return "map";
+      case inst::fused_reduce::stage_kind::filter:
+        return "filter";
+      case inst::fused_reduce::stage_kind::remove:
+        return "remove";
+      case inst::fused_reduce::stage_kind::take:
+        return "take";
+    }
+    return "unknown";
+  }
+
+  void inst::fused_reduce::print(jtl::string_builder &sb, usize const) const
+  {
+    util::format_to(sb, "{:name {} :op :fused-reduce :fn {}", name, fn);
+    if(init.is_some())
+    {
+      util::format_to(sb, " :init {}", init.unwrap());
+    }
+    util::format_to(sb, " :source {} :stages [", source);
+    bool needs_space{};
+    for(auto const &stage : stages)
+    {
+      if(needs_space)
+      {
+        util::format_to(sb, " ");
+      }
+      needs_space = true;
+      util::format_to(sb, "[:{} {}]", stage_kind_str(stage.kind), stage.value);
+    }
+    util::format_to(sb, "] :type \"{}\"}", get_qualified_type_name(type));
+  }
+
   void inst::named_recursion::print(jtl::string_builder &sb, usize const) const
   {
     util::format_to(sb, "{:name {} :op :named-recursion :fn {} :args [", name, fn);
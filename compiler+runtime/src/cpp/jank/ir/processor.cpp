@@ -4,6 +4,7 @@
 #include <jank/ir/opt/hoist_scoped_values.hpp>
 #include <jank/ir/opt/hoist_literals.hpp>
 #include <jank/ir/opt/hoist_var_derefs.hpp>
+#include <jank/ir/opt/fuse_seq_chains.hpp>
 #include <jank/ir/opt/remove_nops.hpp>
 #include <jank/runtime/context.hpp>
 #include <jank/runtime/core/make_box.hpp>
@@ -333,9 +334,18 @@ namespace jank::ir
                                      && highest_fixed_arity->fn_ctx->param_count
                                        == variadic_arity->fn_ctx->param_count - 1 };
 
+      /* If the rest param is never referenced, callers don't need to pack the rest args. */
+      auto const &rest_binding{
+        variadic_arity->frame->locals.find(variadic_arity->params.back())->second.back()
+      };
+      bool const rest_unused{ !variadic_arity->fn_ctx->has_cpp_raw
+                              && !rest_binding.has_boxed_usage
+                              && !rest_binding.has_unboxed_usage };
+
       return runtime::build_arity_flags(variadic_arity->fn_ctx->param_count - 1,
                                         true,
-                                        variadic_ambiguous);
+                                        variadic_ambiguous,
+                                        rest_unused);
     }
     jank_assert(highest_fixed_arity != nullptr);
     return runtime::build_arity_flags(highest_fixed_arity->fn_ctx->param_count, false, false);
@@ -971,6 +981,11 @@ namespace jank::ir
         hoist_var_derefs(fn);
       }
 
+      if(util::cli::opts.fuse_seq_chains)
+      {
+        fuse_seq_chains(fn);
+      }
+
       hoist_scoped_values(fn);
 
       if(util::cli::opts.remove_nops)
@@ -135,6 +135,18 @@ namespace jank::ir
           }
         }
         break;
+      case instruction_kind::fused_reduce:
+        {
+          auto &i{ static_cast<inst::fused_reduce &>(*inst.data) };
+          rewritten |= rewrite(i.fn, old_name, new_name);
+          rewritten |= rewrite(i.init, old_name, new_name);
+          rewritten |= rewrite(i.source, old_name, new_name);
+          for(auto &stage : i.stages)
+          {
+            rewritten |= rewrite(stage.value, old_name, new_name);
+          }
+        }
+        break;
       case instruction_kind::named_recursion:
         {
           auto &i{ static_cast<inst::named_recursion &>(*inst.data) };
@@ -99,6 +99,13 @@ namespace jank::ir
     f(instr, s.current_block());
   }
 
+  void
+  walk_typed(ir::inst::fused_reduce_ref const instr, instruction_walk_function const &f, state &s)
+  {
+    s.next_instruction();
+    f(instr, s.current_block());
+  }
+
   void walk_typed(ir::inst::literal_ref const instr, instruction_walk_function const &f, state &s)
   {
     s.next_instruction();
@@ -531,6 +538,21 @@ namespace jank::ir
     }
   }
 
+  void
+  walk_references_typed(ir::inst::fused_reduce_ref const instr, reference_walk_function const &f)
+  {
+    f(instr->fn);
+    if(instr->init.is_some())
+    {
+      f(instr->init.unwrap());
+    }
+    f(instr->source);
+    for(auto const &stage : instr->stages)
+    {
+      f(stage.value);
+    }
+  }
+
   void walk_references_typed(ir::inst::literal_ref const, reference_walk_function const &)
   {
   }
@@ -0,0 +1,318 @@
+#include <charconv>
+
+#include <jank/nrepl/bencode.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/number.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::nrepl::bencode
+{
+  using namespace jank::runtime;
+
+  /* Dictionaries and lists nest, but nREPL messages are shallow. This is just to keep
+   * hostile input from blowing the stack. */
+  static constexpr usize max_depth{ 64 };
+  /* An i64 is at most 19 digits, plus a sign. Anything longer can't be a valid number, so
+   * we don't keep buffering while we wait for its terminator. */
+  static constexpr usize max_number_length{ 20 };
+
+  namespace
+  {
+    struct parser
+    {
+      /* Returns none if the input ends before the value does. In that case, `required`
+       * holds how far into the input we'll need to go to make progress. */
+      jtl::option<object_ref> value(usize const depth)
+      {
+        if(depth > max_depth)
+        {
+          throw std::runtime_error{ "Bencode is nested too deeply." };
+        }
+        if(pos >= input.size())
+        {
+          required = pos + 1;
+          return jtl::none;
+        }
+
+        switch(input[pos])
+        {
+          case 'i':
+            return integer();
+          case 'l':
+            return list(depth);
+          case 'd':
+            return dict(depth);
+          default:
+            return string();
+        }
+      }
+
+      /* Reads digits up to `terminator`, which is consumed. */
+      jtl::option<i64> number(char const terminator)
+      {
+        auto const end{ input.find(terminator, pos) };
+        if((end == std::string_view::npos ? input.size() : end) - pos > max_number_length)
+        {
+          throw std::runtime_error{ "Invalid bencode number." };
+        }
+        if(end == std::string_view::npos)
+        {
+          required = input.size() + 1;
+          return jtl::none;
+        }
+
+        i64 ret{};
+        auto const res{ std::from_chars(input.data() + pos, input.data() + end, ret) };
+        if(res.ec != std::errc{} || res.ptr != input.data() + end)
+        {
+          throw std::runtime_error{ "Invalid bencode number." };
+        }
+        pos = end + 1;
+        return ret;
+      }
+
+      jtl::option<object_ref> integer()
+      {
+        ++pos;
+        auto const n{ number('e') };
+        if(n.is_none())
+        {
+          return jtl::none;
+        }
+        return make_box(n.unwrap());
+      }
+
+      jtl::option<object_ref> string()
+      {
+        auto const length{ number(':') };
+        if(length.is_none())
+        {
+          return jtl::none;
+        }
+        if(length.unwrap() < 0)
+        {
+          throw std::runtime_error{ "Bencode byte strings can't have a negative length." };
+        }
+
+        auto const size{ static_cast<usize>(length.unwrap()) };
+        if(input.size() - pos < size)
+        {
+          required = pos + size;
+          return jtl::none;
+        }
+
+        auto const ret{ make_box<obj::persistent_string>(
+          jtl::immutable_string{ input.data() + pos, size }) };
+        pos += size;
+        return ret;
+      }
+
+      jtl::option<object_ref> list(usize const depth)
+      {
+        ++pos;
+        runtime::detail::native_transient_vector ret;
+        while(true)
+        {
+          if(pos >= input.size())
+          {
+            required = pos + 1;
+            return jtl::none;
+          }
+          if(input[pos] == 'e')
+          {
+            ++pos;
+            return make_box<obj::persistent_vector>(ret.persistent());
+          }
+
+          auto const item{ value(depth + 1) };
+          if(item.is_none())
+          {
+            return jtl::none;
+          }
+          ret.push_back(item.unwrap());
+        }
+      }
+
+      jtl::option<object_ref> dict(usize const depth)
+      {
+        ++pos;
+        native_vector<object_ref> kvs;
+        while(true)
+        {
+          if(pos >= input.size())
+          {
+            required = pos + 1;
+            return jtl::none;
+          }
+          if(input[pos] == 'e')
+          {
+            ++pos;
+            break;
+          }
+
+          auto const k{ value(depth + 1) };
+          if(k.is_none())
+          {
+            return jtl::none;
+          }
+          auto const v{ value(depth + 1) };
+          if(v.is_none())
+          {
+            return jtl::none;
+          }
+          kvs.push_back(k.unwrap());
+          kvs.push_back(v.unwrap());
+        }
+
+        /* Keys may repeat, in which case the last one wins, as with `into`. */
+        object_ref ret{ obj::persistent_array_map::empty() };
+        for(usize i{}; i < kvs.size(); i += 2)
+        {
+          ret = assoc(ret, kvs[i], kvs[i + 1]);
+        }
+        return ret;
+      }
+
+      std::string_view input;
+      usize pos{};
+      usize required{};
+    };
+  }
+
+  void decoder::feed(jtl::immutable_string_view const &bytes)
+  {
+    /* Drop what we've already decoded once it's the bulk of the buffer, so the buffer
+     * doesn't grow with the life of the connection. */
+    if(offset > 0 && offset >= buffer.size() / 2)
+    {
+      buffer.erase(0, offset);
+      required -= std::min(required, offset);
+      offset = 0;
+    }
+    buffer.append(bytes.data(), bytes.size());
+  }
+
+  jtl::option<object_ref> decoder::next()
+  {
+    if(offset == buffer.size() || buffer.size() < required)
+    {
+      return jtl::none;
+    }
+
+    parser p{ std::string_view{ buffer }, offset };
+    auto const ret{ p.value(0) };
+    if(ret.is_none())
+    {
+      required = p.required;
+      return jtl::none;
+    }
+
+    offset = p.pos;
+    required = 0;
+    return ret;
+  }
+
+  usize decoder::buffered() const
+  {
+    return buffer.size() - offset;
+  }
+
+  void encode(object_ref const o, jtl::string_builder &sb)
+  {
+    switch(o.get_type())
+    {
+      case object_type::nil:
+        throw std::runtime_error{ "Can't write nil as bencode." };
+      case object_type::integer:
+      case object_type::small_integer:
+        util::format_to(sb, "i{}e", o.to_integer());
+        return;
+      case object_type::persistent_string:
+        {
+          auto const &data{ expect_object<obj::persistent_string>(o)->data };
+          util::format_to(sb, "{}:", data.size());
+          sb(data);
+          return;
+        }
+      case object_type::keyword:
+        {
+          auto const &name{ expect_object<obj::keyword>(o)->sym->name };
+          util::format_to(sb, "{}:", name.size());
+          sb(name);
+          return;
+        }
+      default:
+        break;
+    }
+
+    if(is_map(o))
+    {
+      sb('d');
+      for(auto it{ o.seq() }; it.is_some(); it = it.next())
+      {
+        auto const entry{ it.first() };
+        encode(first(entry), sb);
+        encode(second(entry), sb);
+      }
+      sb('e');
+    }
+    else if(is_collection(o) || is_seq(o))
+    {
+      sb('l');
+      for(auto it{ o.seq() }; it.is_some(); it = it.next())
+      {
+        encode(it.first(), sb);
+      }
+      sb('e');
+    }
+    else if(o.get_type() == object_type::big_integer)
+    {
+      util::format_to(sb, "i{}e", o.to_string());
+    }
+    else
+    {
+      /* Anything else goes over the wire as its string form. That includes reals and
+       * ratios, since bencode only has integers. */
+      auto const s{ o.to_string() };
+      util::format_to(sb, "{}:", s.size());
+      sb(s);
+    }
+  }
+
+  object_ref encode(object_ref const o)
+  {
+    jtl::string_builder sb;
+    encode(o, sb);
+    return make_box<obj::persistent_string>(sb.release());
+  }
+
+  object_ref decode(object_ref const s)
+  {
+    if(s.is_nil())
+    {
+      return jank_nil;
+    }
+
+    auto const &data{ expect_object<obj::persistent_string>(s)->data };
+    parser p{ std::string_view{ data.data(), data.size() } };
+    auto const ret{ p.value(0) };
+    if(ret.is_none())
+    {
+      return jank_nil;
+    }
+
+    object_ref remaining{ jank_nil };
+    if(p.pos < data.size())
+    {
+      remaining = make_box<obj::persistent_string>(
+        jtl::immutable_string{ data.data() + p.pos, data.size() - p.pos });
+    }
+    return make_box<obj::persistent_vector>(std::in_place, ret.unwrap(), remaining);
+  }
+}
@@ -1,9 +1,21 @@
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <thread>
+#include <vector>
+
 #include <boost/asio.hpp>
 
 #include <jtl/string_builder.hpp>
 
 #include <jank/nrepl/server.hpp>
+#include <jank/nrepl/bencode.hpp>
+#include <jank/runtime/context.hpp>
 #include <jank/util/fmt.hpp>
+#include <jank/util/fmt/print.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/util/try.hpp>
+#include <jank/gc.hpp>
 
 namespace jank::nrepl::server
 {
@@ -75,6 +87,140 @@ namespace jank::nrepl::server
     impl_->write_some(data);
   }
 
+  /* A connection served by the event loop. Socket work happens on the network thread, while
+   * decoding and handling happen on this session's strand of the worker pool. Only plain
+   * bytes pass between the two, so no GC data is ever held by asio, where the GC can't
+   * see it. */
+  struct session : std::enable_shared_from_this<session>
+  {
+    /* The handler is kept alive by `serve`, which outlives every session. */
+    session(tcp::socket &&socket, io_context &workers, runtime::object_ref const handler)
+      : socket_{ std::move(socket) }
+      , strand_{ make_strand(workers) }
+      , handler_{ handler }
+    {
+    }
+
+    void read()
+    {
+      socket_.async_read_some(
+        buffer(rx_buf_),
+        [self{ shared_from_this() }](boost::system::error_code const &error,
+                                     std::size_t const length) {
+          if(error)
+          {
+            self->close();
+            return;
+          }
+
+          post(self->strand_,
+               [self, bytes{ std::string{ self->rx_buf_.data(), length } }]() {
+                 self->handle(bytes);
+               });
+          self->read();
+        });
+    }
+
+    void handle(std::string const &bytes)
+    {
+      decoder_.feed(bytes);
+
+      while(true)
+      {
+        jtl::option<runtime::object_ref> request;
+        try
+        {
+          request = decoder_.next();
+        }
+        catch(std::exception const &e)
+        {
+          util::println(stderr, "Dropping nREPL client which sent invalid bencode: {}", e.what());
+          post(socket_.get_executor(), [self{ shared_from_this() }]() { self->close(); });
+          return;
+        }
+        if(request.is_none())
+        {
+          return;
+        }
+
+        jtl::string_builder sb;
+        try
+        {
+          auto const responses{ handler_.call(request.unwrap()) };
+          for(auto it{ responses.seq() }; it.is_some(); it = it.next())
+          {
+            bencode::encode(it.first(), sb);
+          }
+        }
+        catch(runtime::object_ref const o)
+        {
+          util::println(stderr, "Exception while handling nREPL request: {}", o.to_code_string());
+        }
+        catch(std::exception const &e)
+        {
+          util::println(stderr, "Exception while handling nREPL request: {}", e.what());
+        }
+        catch(...)
+        {
+          /* This runs on one of the server's threads, so nothing can escape. */
+          util::print_current_exception();
+        }
+
+        if(!sb.empty())
+        {
+          write(std::string{ sb.data(), sb.size() });
+        }
+      }
+    }
+
+    void write(std::string &&bytes)
+    {
+      post(socket_.get_executor(),
+           [self{ shared_from_this() }, bytes{ std::move(bytes) }]() mutable {
+             self->outbox_.push_back(std::move(bytes));
+             if(self->outbox_.size() == 1)
+             {
+               self->write_next();
+             }
+           });
+    }
+
+    void write_next()
+    {
+      async_write(
+        socket_,
+        buffer(outbox_.front()),
+        [self{ shared_from_this() }](boost::system::error_code const &error, std::size_t) {
+          if(error)
+          {
+            self->close();
+            return;
+          }
+
+          self->outbox_.pop_front();
+          if(!self->outbox_.empty())
+          {
+            self->write_next();
+          }
+        });
+    }
+
+    void close()
+    {
+      boost::system::error_code ignored;
+      socket_.close(ignored);
+    }
+
+    tcp::socket socket_;
+    strand<io_context::executor_type> strand_;
+    runtime::object_ref handler_;
+    /* Only touched on the strand. */
+    bencode::decoder decoder_;
+    /* Only touched on the network thread. */
+    std::deque<std::string> outbox_;
+    std::array<char, 64 * 1024> rx_buf_{};
+  };
+
   // server
   struct native_server::impl
   {
@@ -91,6 +237,66 @@ namespace jank::nrepl::server
       return impl;
     }
 
+    void accept_next(io_context &workers, runtime::object_ref const handler)
+    {
+      acceptor_.async_accept(
+        [this, &workers, handler](boost::system::error_code const &error, tcp::socket socket) {
+          if(error == boost::asio::error::operation_aborted)
+          {
+            return;
+          }
+          if(!error)
+          {
+            std::make_shared<session>(std::move(socket), workers, handler)->read();
+          }
+          accept_next(workers, handler);
+        });
+    }
+
+    void serve(runtime::object_ref const handler, usize const worker_count)
+    {
+      auto const bindings{ runtime::__rt_ctx->get_thread_bindings() };
+      io_context workers;
+      auto work{ make_work_guard(workers) };
+
+      std::vector<std::thread> threads;
+      for(usize i{}; i < std::max<usize>(worker_count, 1); ++i)
+      {
+        threads.emplace_back([&workers, bindings]() {
+          /* Workers run jank code, so they need to be known to the GC. See `future` for
+           * the macOS caveat. */
+          if constexpr(jtl::current_platform != jtl::platform::macos_like)
+          {
+            GC_stack_base sb{};
+            GC_get_stack_base(&sb);
+            GC_register_my_thread(&sb);
+          }
+          util::scope_exit const unregister{ []() {
+            if constexpr(jtl::current_platform != jtl::platform::macos_like)
+            {
+              GC_unregister_my_thread();
+            }
+          } };
+
+          runtime::__rt_ctx->push_thread_bindings(bindings).expect_ok();
+          util::scope_exit const pop{ []() { runtime::__rt_ctx->pop_thread_bindings(); } };
+
+          workers.run();
+        });
+      }
+
+      accept_next(workers, handler);
+      io_context_.restart();
+      io_context_.run();
+
+      work.reset();
+      workers.stop();
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+    }
+
     io_context io_context_;
     tcp::acceptor acceptor_;
   };
@@ -121,4 +327,14 @@ namespace jank::nrepl::server
     // an opaque type if we return unique_ptr<native_client>.
     return new native_client(std::move(impl));
   }
+
+  void native_server::serve(runtime::object_ref const handler, usize const worker_count) const
+  {
+    impl_->serve(handler, worker_count);
+  }
+
+  void native_server::stop() const
+  {
+    impl_->io_context_.stop();
+  }
 }
@@ -0,0 +1,629 @@
+#include <array>
+#include <string_view>
+
+#include <jank/read/edn.hpp>
+#include <jank/read/lex.hpp>
+#include <jank/read/parse.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/obj/big_decimal.hpp>
+#include <jank/runtime/obj/big_integer.hpp>
+#include <jank/runtime/obj/character.hpp>
+#include <jank/runtime/obj/inst.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map.hpp>
+#include <jank/runtime/obj/persistent_hash_set.hpp>
+#include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/ratio.hpp>
+#include <jank/runtime/obj/uuid.hpp>
+#include <jank/util/escape.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::read::edn
+{
+  using namespace jank::runtime;
+
+  options options::from_map(object_ref const opts)
+  {
+    options ret;
+    if(opts.is_nil())
+    {
+      return ret;
+    }
+    if(!is_map(opts))
+    {
+      throw std::runtime_error{ util::format("The EDN reader options must be a map, not a `{}`.",
+                                             object_type_str(opts.get_type())) };
+    }
+
+    static auto const eof_kw{ __rt_ctx->intern_keyword("", "eof").expect_ok() };
+    static auto const readers_kw{ __rt_ctx->intern_keyword("", "readers").expect_ok() };
+    static auto const default_kw{ __rt_ctx->intern_keyword("", "default").expect_ok() };
+
+    if(contains(opts, eof_kw))
+    {
+      ret.eof = get(opts, eof_kw);
+      ret.eof_throw = false;
+    }
+    ret.readers = get(opts, readers_kw);
+    ret.default_fn = get(opts, default_kw);
+    return ret;
+  }
+
+  struct processor
+  {
+    /* Keeps adversarial input from blowing the native stack. */
+    static constexpr usize max_depth{ 512 };
+
+    /* Held while reading anything which can contain other forms. */
+    struct nesting
+    {
+      nesting(processor &p);
+      ~nesting();
+
+      processor &p;
+    };
+
+    processor(jtl::immutable_string_view const &input, options const &opts);
+
+    /* Returns none once there's nothing but whitespace and comments left. */
+    jtl::option<object_ref> next();
+    /* Like `next`, but the end of the input is an error. */
+    object_ref next_required(char const * const context);
+
+    lex::token next_token();
+    object_ref read(lex::token const &token);
+    object_ref read_dispatch();
+    object_ref read_list();
+    object_ref read_vector();
+    object_ref read_map();
+    object_ref read_set();
+    object_ref read_meta();
+    object_ref read_tagged(lex::token const &tag_token);
+    object_ref read_symbolic_value();
+    object_ref read_symbol(jtl::immutable_string_view const &sv) const;
+    object_ref read_keyword(jtl::immutable_string_view const &sv);
+    object_ref read_character(jtl::immutable_string_view const &sv) const;
+
+    /* Calls `fn` with each form up to `closer`, which is consumed. */
+    template <typename F>
+    void read_until(lex::token_kind const closer, char const * const context, F const &fn);
+
+    lex::processor lexer;
+    options const &opts;
+    /* The same few keywords tend to show up over and over in data, so we intern each distinct
+     * keyword once per read, rather than once per occurrence. This is keyed on the keyword's
+     * source text, which lives as long as the input does. */
+    native_unordered_map<std::string_view, object_ref> keywords;
+    usize depth{};
+  };
+
+  processor::nesting::nesting(processor &p)
+    : p{ p }
+  {
+    if(max_depth <= p.depth)
+    {
+      throw std::runtime_error{ util::format(
+        "EDN read error: forms are nested more than {} levels deep.",
+        max_depth) };
+    }
+    ++p.depth;
+  }
+
+  processor::nesting::~nesting()
+  {
+    --p.depth;
+  }
+
+  processor::processor(jtl::immutable_string_view const &input, options const &opts)
+    : lexer{ input }
+    , opts{ opts }
+  {
+  }
+
+  lex::token processor::next_token()
+  {
+    while(true)
+    {
+      auto token_result(lexer.next());
+      if(token_result.is_err())
+      {
+        throw token_result.expect_err();
+      }
+      auto token(token_result.expect_ok());
+      if(token.kind != lex::token_kind::comment)
+      {
+        return token;
+      }
+    }
+  }
+
+  jtl::option<object_ref> processor::next()
+  {
+    while(true)
+    {
+      auto const token(next_token());
+      switch(token.kind)
+      {
+        case lex::token_kind::eof:
+          return none;
+        case lex::token_kind::reader_macro_comment:
+          {
+            nesting const n{ *this };
+            next_required("`#_`");
+          }
+          continue;
+        default:
+          return read(token);
+      }
+    }
+  }
+
+  object_ref processor::next_required(char const * const context)
+  {
+    auto const ret(next());
+    if(ret.is_none())
+    {
+      throw std::runtime_error{ util::format("EDN read error: EOF while reading {}.", context) };
+    }
+    return ret.unwrap();
+  }
+
+  template <typename F>
+  void processor::read_until(lex::token_kind const closer, char const * const context, F const &fn)
+  {
+    while(true)
+    {
+      auto const token(next_token());
+      if(token.kind == closer)
+      {
+        return;
+      }
+
+      switch(token.kind)
+      {
+        case lex::token_kind::eof:
+          throw std::runtime_error{ util::format("EDN read error: EOF while reading {}.",
+                                                 context) };
+        case lex::token_kind::reader_macro_comment:
+          {
+            nesting const n{ *this };
+            next_required("`#_`");
+          }
+          break;
+        default:
+          fn(read(token));
+          break;
+      }
+    }
+  }
+
+  object_ref processor::read_list()
+  {
+    native_vector<object_ref> items;
+    read_until(lex::token_kind::close_paren, "a list", [&](object_ref const o) {
+      items.push_back(o);
+    });
+
+    if(items.empty())
+    {
+      return obj::persistent_list::empty();
+    }
+    return make_box<obj::persistent_list>(std::in_place, items.rbegin(), items.rend());
+  }
+
+  object_ref processor::read_vector()
+  {
+    runtime::detail::native_transient_vector items;
+    read_until(lex::token_kind::close_square_bracket, "a vector", [&](object_ref const o) {
+      items.push_back(o);
+    });
+
+    if(items.empty())
+    {
+      return obj::persistent_vector::empty();
+    }
+    return make_box<obj::persistent_vector>(items.persistent());
+  }
+
+  /* Maps which are small enough to be array maps or shape maps are collected on the stack and
+   * only allocated once we know their final size and keys. Larger maps are built in a
+   * transient. */
+  object_ref processor::read_map()
+  {
+    std::array<object_ref, obj::persistent_shape_map::max_size * 2> small;
+    usize small_length{};
+    runtime::detail::native_transient_hash_map large;
+    bool spilled{};
+    jtl::option<object_ref> pending_key;
+
+    auto const insert{ [&](object_ref const key, object_ref const value) {
+      if(spilled)
+      {
+        if(large.find(key))
+        {
+          throw std::runtime_error{ util::format("EDN read error: duplicate key {} in a map.",
+                                                 key.to_code_string()) };
+        }
+        large.set(key, value);
+        return;
+      }
+
+      for(usize i{}; i < small_length; i += 2)
+      {
+        if(equal(small[i], key))
+        {
+          throw std::runtime_error{ util::format("EDN read error: duplicate key {} in a map.",
+                                                 key.to_code_string()) };
+        }
+      }
+
+      if(small_length < small.size())
+      {
+        small[small_length++] = key;
+        small[small_length++] = value;
+        return;
+      }
+
+      spilled = true;
+      for(usize i{}; i < small_length; i += 2)
+      {
+        large.set(small[i], small[i + 1]);
+      }
+      large.set(key, value);
+    } };
+
+    read_until(lex::token_kind::close_curly_bracket, "a map", [&](object_ref const o) {
+      if(pending_key.is_none())
+      {
+        pending_key = o;
+        return;
+      }
+      insert(pending_key.unwrap(), o);
+      pending_key = none;
+    });
+
+    if(pending_key.is_some())
+    {
+      throw std::runtime_error{ "EDN read error: a map literal must contain an even number of "
+                                "forms." };
+    }
+
+    if(spilled)
+    {
+      return make_box<obj::persistent_hash_map>(large.persistent());
+    }
+    if(small_length == 0)
+    {
+      return obj::persistent_array_map::empty();
+    }
+
+    if(small_length > obj::persistent_array_map::max_size * 2)
+    {
+      if(obj::persistent_shape_map::can_hold(small.data(), small_length))
+      {
+        return obj::persistent_shape_map::create_unique({}, small.data(), small_length);
+      }
+      for(usize i{}; i < small_length; i += 2)
+      {
+        large.set(small[i], small[i + 1]);
+      }
+      return make_box<obj::persistent_hash_map>(large.persistent());
+    }
+
+    auto const array_box(make_array_box<object_ref>(small_length));
+    std::copy(small.begin(), small.begin() + small_length, array_box.data);
+    return make_box<obj::persistent_array_map>(runtime::detail::in_place_unique{},
+                                               array_box,
+                                               small_length);
+  }
+
+  object_ref processor::read_set()
+  {
+    runtime::detail::native_transient_hash_set items;
+    read_until(lex::token_kind::close_curly_bracket, "a set", [&](object_ref const o) {
+      if(items.find(o))
+      {
+        throw std::runtime_error{ util::format("EDN read error: duplicate item {} in a set.",
+                                               o.to_code_string()) };
+      }
+      items.insert(o);
+    });
+
+    return make_box<obj::persistent_hash_set>(items.persistent());
+  }
+
+  /* Same as Clojure, `^:foo` is `^{:foo true}` and `^foo` or `^"foo"` is `^{:tag foo}`. */
+  object_ref processor::read_meta()
+  {
+    static auto const tag_kw{ __rt_ctx->intern_keyword("", "tag").expect_ok() };
+
+    auto meta(next_required("metadata"));
+    switch(meta.get_type())
+    {
+      case object_type::keyword:
+        meta = obj::persistent_array_map::create_unique(meta, jank_true);
+        break;
+      case object_type::symbol:
+      case object_type::persistent_string:
+        meta = obj::persistent_array_map::create_unique(tag_kw, meta);
+        break;
+      default:
+        if(!is_map(meta))
+        {
+          throw std::runtime_error{
+            "EDN read error: metadata must be a symbol, keyword, string, or map."
+          };
+        }
+    }
+
+    auto const target(next_required("the target of metadata"));
+    auto const existing(runtime::meta(target));
+    return with_meta(target, existing.is_nil() ? meta : merge(existing, meta));
+  }
+
+  object_ref processor::read_tagged(lex::token const &tag_token)
+  {
+    auto const tag(read(tag_token));
+    auto const value(next_required("a tagged literal"));
+
+    if(opts.readers.is_some())
+    {
+      auto const reader(get(opts.readers, tag));
+      if(reader.is_some())
+      {
+        return reader.call(value);
+      }
+    }
+
+    auto const &tag_name(expect_object<obj::symbol>(tag)->name);
+    if(expect_object<obj::symbol>(tag)->ns.empty() && (tag_name == "inst" || tag_name == "uuid"))
+    {
+      if(value.get_type() != object_type::persistent_string)
+      {
+        throw std::runtime_error{ util::format("EDN read error: #{} expects a string, not a `{}`.",
+                                               tag_name,
+                                               object_type_str(value.get_type())) };
+      }
+
+      auto const &s(expect_object<obj::persistent_string>(value)->data);
+      if(tag_name == "inst")
+      {
+        return make_box<obj::inst>(s);
+      }
+      return make_box<obj::uuid>(s);
+    }
+
+    if(opts.default_fn.is_some())
+    {
+      return opts.default_fn.call(tag, value);
+    }
+
+    throw std::runtime_error{ util::format("EDN read error: no reader function for tag {}.",
+                                           tag.to_string()) };
+  }
+
+  object_ref processor::read_symbolic_value()
+  {
+    auto const token(next_token());
+    if(token.kind == lex::token_kind::symbol)
+    {
+      auto const sv(std::get<jtl::immutable_string_view>(token.data));
+      if(sv == "Inf")
+      {
+        return jank_inf;
+      }
+      if(sv == "-Inf")
+      {
+        return jank_neg_inf;
+      }
+      if(sv == "NaN")
+      {
+        return jank_nan;
+      }
+    }
+    throw std::runtime_error{ "EDN read error: invalid symbolic value after `##`." };
+  }
+
+  /* After a `#`, EDN only allows sets, tags, and symbolic values. Everything else is code. */
+  object_ref processor::read_dispatch()
+  {
+    auto const token(next_token());
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wswitch-enum"
+    switch(token.kind)
+    {
+      case lex::token_kind::open_curly_bracket:
+        return read_set();
+      case lex::token_kind::symbol:
+        return read_tagged(token);
+      case lex::token_kind::reader_macro:
+        return read_symbolic_value();
+      default:
+        throw std::runtime_error{ util::format(
+          "EDN read error: `#` followed by a {} isn't supported in EDN.",
+          lex::token_kind_str(token.kind)) };
+    }
+#pragma clang diagnostic pop
+  }
+
+  object_ref processor::read_symbol(jtl::immutable_string_view const &sv) const
+  {
+    auto const slash(sv.find('/'));
+    /* If it's only a slash, it's a name. Otherwise, it's a ns/name separator. */
+    if(slash == jtl::immutable_string_view::npos || sv.size() == 1)
+    {
+      return make_box<obj::symbol>(jtl::immutable_string{}, jtl::immutable_string{ sv });
+    }
+    return make_box<obj::symbol>(jtl::immutable_string{ sv.substr(0, slash) },
+                                 jtl::immutable_string{ sv.substr(slash + 1) });
+  }
+
+  object_ref processor::read_keyword(jtl::immutable_string_view const &sv)
+  {
+    std::string_view const key{ sv.data(), sv.size() };
+    if(auto const found{ keywords.find(key) }; found != keywords.end())
+    {
+      return found->second;
+    }
+
+    /* The lexer leaves the second colon of `::foo` on the name. */
+    if(sv[0] == ':')
+    {
+      throw std::runtime_error{ util::format(
+        "EDN read error: auto-resolved keywords, like :{}, aren't supported in EDN.",
+        jtl::immutable_string{ sv }) };
+    }
+
+    auto const slash(sv.find('/'));
+    jtl::immutable_string ns, name;
+    if(slash == jtl::immutable_string_view::npos)
+    {
+      name = sv;
+    }
+    else
+    {
+      ns = sv.substr(0, slash);
+      name = sv.substr(slash + 1);
+    }
+
+    auto const intern_res(__rt_ctx->intern_keyword(ns, name, true));
+    if(intern_res.is_err())
+    {
+      throw std::runtime_error{ util::format("EDN read error: {}", intern_res.expect_err()) };
+    }
+    keywords.emplace(key, intern_res.expect_ok());
+    return intern_res.expect_ok();
+  }
+
+  object_ref processor::read_character(jtl::immutable_string_view const &sv) const
+  {
+    auto const character(parse::get_char_from_literal(sv));
+    if(character.is_some())
+    {
+      return obj::character::create(character.unwrap());
+    }
+
+    if(sv.size() > 2 && (sv[1] == 'u' || sv[1] == 'o'))
+    {
+      auto const char_bytes(parse::parse_character_in_base(sv.substr(2), sv[1] == 'u' ? 16 : 8));
+      if(char_bytes.is_err())
+      {
+        throw std::runtime_error{ util::format("EDN read error: {}",
+                                               char_bytes.expect_err().error) };
+      }
+      return obj::character::create(char_bytes.expect_ok());
+    }
+
+    /* Multi-byte UTF-8 characters are validated by the lexer. */
+    return obj::character::create(sv.substr(1));
+  }
+
+  object_ref processor::read(lex::token const &token)
+  {
+    switch(token.kind)
+    {
+      case lex::token_kind::open_paren:
+        {
+          nesting const n{ *this };
+          return read_list();
+        }
+      case lex::token_kind::open_square_bracket:
+        {
+          nesting const n{ *this };
+          return read_vector();
+        }
+      case lex::token_kind::open_curly_bracket:
+        {
+          nesting const n{ *this };
+          return read_map();
+        }
+      case lex::token_kind::reader_macro:
+        {
+          nesting const n{ *this };
+          return read_dispatch();
+        }
+      case lex::token_kind::meta_hint:
+        {
+          nesting const n{ *this };
+          return read_meta();
+        }
+      case lex::token_kind::nil:
+        return jank_nil;
+      case lex::token_kind::boolean:
+        return make_box(std::get<bool>(token.data));
+      case lex::token_kind::character:
+        return read_character(std::get<jtl::immutable_string_view>(token.data));
+      case lex::token_kind::symbol:
+        return read_symbol(std::get<jtl::immutable_string_view>(token.data));
+      case lex::token_kind::keyword:
+        return read_keyword(std::get<jtl::immutable_string_view>(token.data));
+      case lex::token_kind::integer:
+        return make_box(std::get<i64>(token.data));
+      case lex::token_kind::real:
+        return make_box(std::get<f64>(token.data));
+      case lex::token_kind::big_integer:
+        {
+          auto const &[number_literal, radix, is_negative](std::get<lex::big_integer>(token.data));
+          return obj::big_integer::create(number_literal, radix, is_negative);
+        }
+      case lex::token_kind::big_decimal:
+        return obj::big_decimal::create(std::get<lex::big_decimal>(token.data).number_literal);
+      case lex::token_kind::ratio:
+        {
+          auto const &ratio_data(std::get<lex::ratio>(token.data));
+          if(ratio_data.denominator == 0)
+          {
+            throw std::runtime_error{ "EDN read error: a ratio may not have a denominator of "
+                                      "zero." };
+          }
+          return obj::ratio::create(ratio_data.numerator, ratio_data.denominator);
+        }
+      case lex::token_kind::string:
+        {
+          auto const sv(std::get<jtl::immutable_string_view>(token.data));
+          return make_box<obj::persistent_string>(jtl::immutable_string{ sv.data(), sv.size() });
+        }
+      case lex::token_kind::escaped_string:
+        {
+          auto const sv(std::get<jtl::immutable_string_view>(token.data));
+          auto res(util::unescape({ sv.data(), sv.size() }));
+          if(res.is_err())
+          {
+            throw std::runtime_error{ util::format("EDN read error: {}",
+                                                   res.expect_err().message) };
+          }
+          return make_box<obj::persistent_string>(res.expect_ok_move());
+        }
+      case lex::token_kind::close_paren:
+      case lex::token_kind::close_square_bracket:
+      case lex::token_kind::close_curly_bracket:
+        throw std::runtime_error{ util::format("EDN read error: unmatched delimiter {}.",
+                                               lex::token_kind_str(token.kind)) };
+      default:
+        throw std::runtime_error{ util::format("EDN read error: {} isn't supported in EDN.",
+                                               lex::token_kind_str(token.kind)) };
+    }
+  }
+
+  read_result read(jtl::immutable_string_view const &input, options const &opts)
+  {
+    processor p{ input, opts };
+    auto const value(p.next());
+    if(value.is_none())
+    {
+      if(opts.eof_throw)
+      {
+        throw std::runtime_error{ "EDN read error: EOF while reading." };
+      }
+      return { opts.eof, input.size() };
+    }
+    return { value.unwrap(), p.lexer.pos.offset };
+  }
+}
@@ -32,6 +32,7 @@ namespace jank::runtime
   context::context()
     /* We want to initialize __rt_ctx ASAP so other code can start using it. */
     : binary_version{ (__rt_ctx = this, util::binary_version()) }
+    , namespaces{ obj::persistent_hash_map::empty() }
     , jit_prc{ binary_version }
   {
     intern_ns(make_box<obj::symbol>("cpp"));
@@ -138,18 +139,7 @@ namespace jank::runtime
     profile::timer const timer{ "rt find_var" };
     if(!sym->ns.empty())
     {
-      ns_ref ns{};
-      {
-        auto const locked_namespaces(namespaces.rlock());
-        auto const found(locked_namespaces->find(make_box<obj::symbol>("", sym->ns)));
-        if(found == locked_namespaces->end())
-        {
-          return {};
-        }
-        ns = found->second;
-      }
-
-      return ns->find_var(make_box<obj::symbol>("", sym->name));
+      return find_var(sym->ns, sym->name);
     }
     else
     {
@@ -158,9 +148,18 @@ namespace jank::runtime
     }
   }
 
-  var_ref context::find_var(jtl::immutable_string const &ns, jtl::immutable_string const &name)
+  var_ref
+  context::find_var(jtl::immutable_string_view const &ns, jtl::immutable_string_view const &name)
   {
-    return find_var(make_box<obj::symbol>(ns, name));
+    /* Like in `ns::find_var`, this symbol never leaves this function. */
+    obj::symbol const ns_sym{ "", ns };
+    auto const found(namespaces.load()->data.find(&ns_sym));
+    if(!found)
+    {
+      return {};
+    }
+
+    return expect_object<runtime::ns>(*found)->find_var(name);
   }
 
   object_ref context::read_string(jtl::immutable_string const &code,
@@ -402,25 +401,35 @@ namespace jank::runtime
                                              "Namespace names for `intern-ns` must be unqualified.",
                                              sym->to_string()) };
     }
-    auto locked_namespaces(namespaces.wlock());
-    auto const found(locked_namespaces->find(sym));
-    if(found != locked_namespaces->end())
+    if(auto const found(find_ns(sym)); found.is_some())
     {
-      return found->second;
+      return found;
+    }
+
+    auto const locked_namespaces(namespaces.wlock());
+    auto const current_namespaces(locked_namespaces.get());
+    auto const found(current_namespaces->data.find(sym));
+    if(found)
+    {
+      return expect_object<ns>(*found);
     }
 
-    auto const result(locked_namespaces->emplace(sym, make_box<ns>(sym)));
-    return result.first->second;
+    auto const ret(make_box<ns>(sym));
+    locked_namespaces.publish(
+      make_box<obj::persistent_hash_map>(current_namespaces->data.set(sym, ret)));
+    return ret;
   }
 
   ns_ref context::remove_ns(obj::symbol_ref const sym)
   {
-    auto locked_namespaces(namespaces.wlock());
-    auto const found(locked_namespaces->find(sym));
-    if(found != locked_namespaces->end())
+    auto const locked_namespaces(namespaces.wlock());
+    auto const current_namespaces(locked_namespaces.get());
+    auto const found(current_namespaces->data.find(sym));
+    if(found)
     {
-      auto const ret(found->second);
-      locked_namespaces->erase(found);
+      auto const ret(expect_object<ns>(*found));
+      locked_namespaces.publish(
+        make_box<obj::persistent_hash_map>(current_namespaces->data.erase(sym)));
       return ret;
     }
     return {};
@@ -428,11 +437,10 @@ namespace jank::runtime
 
   ns_ref context::find_ns(obj::symbol_ref const sym)
   {
-    auto locked_namespaces(namespaces.rlock());
-    auto const found(locked_namespaces->find(sym));
-    if(found != locked_namespaces->end())
+    auto const found(namespaces.load()->data.find(sym));
+    if(found)
     {
-      return found->second;
+      return expect_object<ns>(*found);
     }
     return {};
   }
@@ -456,18 +464,18 @@ namespace jank::runtime
 
   native_vector<ns_ref> context::all_ns() const
   {
-    auto locked_namespaces(namespaces.rlock());
+    auto const current_namespaces(namespaces.load());
     native_vector<ns_ref> ret;
-    ret.reserve(locked_namespaces->size());
-    for(auto const p : *locked_namespaces)
+    ret.reserve(current_namespaces->data.size());
+    for(auto const &p : current_namespaces->data)
     {
       /* This isn't a real ns. */
-      if(p.first->name == "cpp")
+      if(expect_object<obj::symbol>(p.first)->name == "cpp")
       {
         continue;
       }
 
-      ret.emplace_back(p.second);
+      ret.emplace_back(expect_object<ns>(p.second));
     }
     return ret;
   }
@@ -481,6 +489,10 @@ namespace jank::runtime
   jtl::result<var_ref, jtl::immutable_string>
   context::intern_var(jtl::immutable_string const &ns, jtl::immutable_string const &name)
   {
+    if(auto const found(find_var(ns, name)); found.is_some())
+    {
+      return ok(found);
+    }
     return intern_var(make_box<obj::symbol>(ns, name));
   }
 
@@ -494,20 +506,7 @@ namespace jank::runtime
         util::format("Can't intern var. Sym isn't qualified: {}", qualified_name->to_string()));
     }
 
-    obj::symbol_ref const ns_sym{ make_box<obj::symbol>(qualified_name->ns) };
-    ns_ref found_ns;
-    {
-      auto locked_namespaces(namespaces.rlock());
-      auto const found{ locked_namespaces->find(ns_sym) };
-      if(found != locked_namespaces->end())
-      {
-        found_ns = found->second;
-      }
-    }
-    if(found_ns.is_nil())
-    {
-      found_ns = intern_ns(ns_sym);
-    }
+    auto const found_ns(intern_ns(make_box<obj::symbol>(qualified_name->ns)));
 
     return ok(found_ns->intern_var(qualified_name));
   }
@@ -535,20 +534,7 @@ namespace jank::runtime
         util::format("Can't intern var. Sym isn't qualified: {}", qualified_sym->to_string()));
     }
 
-    obj::symbol_ref const ns_sym{ make_box<obj::symbol>(qualified_sym->ns) };
-    ns_ref found_ns;
-    {
-      auto locked_namespaces(namespaces.rlock());
-      auto const found{ locked_namespaces->find(ns_sym) };
-      if(found != locked_namespaces->end())
-      {
-        found_ns = found->second;
-      }
-    }
-    if(found_ns.is_nil())
-    {
-      found_ns = intern_ns(ns_sym);
-    }
+    auto const found_ns(intern_ns(make_box<obj::symbol>(qualified_sym->ns)));
 
     return ok(found_ns->intern_owned_var(qualified_sym));
   }
@@ -756,6 +742,42 @@ namespace jank::runtime
     tbfs.pop_front();
   }
 
+  native_list<thread_binding_frame> context::take_thread_bindings()
+  {
+    auto const thread_id{ std::this_thread::get_id() };
+    auto tbfs_map(thread_binding_frames.wlock());
+    auto const tbfs{ tbfs_map->find(thread_id) };
+    if(tbfs == tbfs_map->end())
+    {
+      return {};
+    }
+    auto ret{ jtl::move(tbfs->second) };
+    tbfs->second.clear();
+    return ret;
+  }
+
+  void context::restore_thread_bindings(native_list<thread_binding_frame> &&frames)
+  {
+    auto const thread_id{ std::this_thread::get_id() };
+    /* Each frame has all of the bindings in effect at that point, so the bindings of the
+     * outer frames are repeated in the inner ones. They now belong to this thread, for the
+     * sake of `set!`. */
+    for(auto const &frame : frames)
+    {
+      for(auto it(frame.bindings->fresh_seq()); it.is_some(); it = it.next_in_place())
+      {
+        auto const binding(it.first().seq().next().first());
+        if(binding.get_type() == object_type::var_thread_binding)
+        {
+          expect_object<var_thread_binding>(binding)->thread_id = thread_id;
+        }
+      }
+    }
+
+    auto tbfs_map(thread_binding_frames.wlock());
+    (*tbfs_map)[thread_id] = jtl::move(frames);
+  }
+
   obj::persistent_hash_map_ref context::get_thread_bindings() const
   {
     auto const thread_id{ std::this_thread::get_id() };
@@ -23,6 +23,7 @@
 #include <jank/util/environment.hpp>
 #include <jank/util/fmt/print.hpp>
 #include <jank/util/scope_exit.hpp>
+#include <jank/util/arena.hpp>
 #include <jank/ir/processor.hpp>
 #include <jank/codegen/cpp_processor.hpp>
 #include <jank/codegen/optimize.hpp>
@@ -65,6 +66,10 @@ namespace jank::runtime
       }
 
       no_op = false;
+      /* Each form is its own compilation unit, so everything the compiler builds for it
+       * can go as soon as it has been evaluated. */
+      util::arena compiler_arena;
+      util::arena::scope const arena_scope{ compiler_arena };
       analyze::processor an_prc;
       auto const expr(analyze::pass::optimize(
         an_prc.analyze(form.expect_ok().unwrap().ptr, analyze::expression_position::statement)
@@ -102,6 +107,8 @@ namespace jank::runtime
                                     obj::persistent_vector::empty()),
                       make_box<obj::symbol>(name)),
         make_box<obj::symbol>("fn*")) };
+      util::arena compiler_arena;
+      util::arena::scope const arena_scope{ compiler_arena };
       analyze::processor an_prc;
       auto const expr(analyze::pass::optimize(
         an_prc.analyze(form, analyze::expression_position::statement).expect_ok()));
@@ -173,6 +180,8 @@ namespace jank::runtime
     read::lex::processor l_prc{ code };
     read::parse::processor p_prc{ l_prc.begin(), l_prc.end() };
 
+    /* We're handing the expressions back, so they can't live in anyone's arena. */
+    util::arena::escape const escape_arena;
     analyze::processor an_prc;
     native_vector<analyze::expression_ref> ret{};
     for(auto const &form : p_prc)
@@ -219,6 +228,8 @@ namespace jank::runtime
 
   object_ref context::eval(object_ref const o)
   {
+    util::arena compiler_arena;
+    util::arena::scope const arena_scope{ compiler_arena };
     analyze::processor an_prc;
     auto const expr(
       analyze::pass::optimize(an_prc.analyze(o, analyze::expression_position::value).expect_ok()));
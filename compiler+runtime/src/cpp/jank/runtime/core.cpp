@@ -8,6 +8,7 @@
 #include <cpptrace/basic.hpp>
 
 #include <jank/gc.hpp>
+#include <jank/read/edn.hpp>
 #include <jank/runtime/core.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/behavior/nameable.hpp>
@@ -111,12 +112,11 @@ namespace jank::runtime
     return make_box<obj::symbol>(ns, name);
   }
 
-  static FILE *get_stdout()
+  static FILE *expect_stream(object_ref const out_val)
   {
     static auto const stream_val{ __rt_ctx->stream_var->deref() };
     static auto const stream_box{ try_object<obj::opaque_box>(stream_val) };
 
-    auto const out_val{ __rt_ctx->current_out_var->deref() };
     auto const out_box{ try_object<obj::opaque_box>(out_val) };
 
     if(stream_box->canonical_type != out_box->canonical_type)
@@ -129,54 +129,103 @@ namespace jank::runtime
     return reinterpret_cast<FILE *>(out_box->data.data);
   }
 
-  object_ref print(object_ref const args)
+  /* All printing goes through here. `*out*` is either a boxed FILE* or one of our writers.
+   * A buffered writer lets us render straight into its buffer, whereas the others need the
+   * output to be built up first, so it can be written in one go. */
+  template <typename F>
+  static void write_out(F const &render)
   {
-    if(args.is_nil())
+    auto const out_val{ __rt_ctx->current_out_var->deref() };
+    switch(out_val.get_type())
     {
-      return {};
-    }
-
-    auto const out{ get_stdout() };
+      case object_type::buffered_writer:
+        {
+          auto const writer{ expect_object<obj::buffered_writer>(out_val) };
+          if(writer->is_owner())
+          {
+            render(writer->buff);
+            writer->wrote();
+            return;
+          }
 
-    jtl::string_builder buff;
-    args.first().to_string(buff);
-    for(auto const e : make_sequence_range(args).skip(1))
-    {
-      buff(' ');
-      e.to_string(buff);
+          /* Some other thread's buffer, conveyed to us by a binding. */
+          jtl::string_builder buff;
+          render(buff);
+          writer->write(buff.view());
+          return;
+        }
+      case object_type::file_writer:
+        {
+          jtl::string_builder buff;
+          render(buff);
+          expect_object<obj::file_writer>(out_val)->write(buff.view());
+          return;
+        }
+      default:
+        {
+          auto const out{ expect_stream(out_val) };
+          jtl::string_builder buff;
+          render(buff);
+          std::fwrite(buff.data(), 1, buff.size(), out);
+          return;
+        }
     }
-    std::fwrite(buff.data(), 1, buff.size(), out);
-    return {};
   }
 
-  object_ref print1(object_ref const o)
+  void write_to(object_ref const out, jtl::immutable_string_view const &s)
   {
-    jtl::string_builder buff;
-    o.to_string(buff);
-    std::fwrite(buff.data(), 1, buff.size(), get_stdout());
-    return {};
+    switch(out.get_type())
+    {
+      case object_type::buffered_writer:
+        expect_object<obj::buffered_writer>(out)->write(s);
+        return;
+      case object_type::file_writer:
+        expect_object<obj::file_writer>(out)->write(s);
+        return;
+      default:
+        std::fwrite(s.data(), 1, s.size(), expect_stream(out));
+        return;
+    }
   }
 
-  object_ref println(object_ref const args)
+  object_ref print(object_ref const args)
   {
-    auto const out{ get_stdout() };
-
     if(args.is_nil())
     {
-      std::putc('\n', out);
+      return {};
     }
-    else
-    {
-      jtl::string_builder buff;
+
+    write_out([&](jtl::string_builder &buff) {
       args.first().to_string(buff);
       for(auto const e : make_sequence_range(args).skip(1))
       {
         buff(' ');
         e.to_string(buff);
       }
-      std::fwrite(buff.data(), 1, buff.size(), out);
-      std::putc('\n', out);
-    }
+    });
+    return {};
+  }
+
+  object_ref print1(object_ref const o)
+  {
+    write_out([&](jtl::string_builder &buff) { o.to_string(buff); });
+    return {};
+  }
+
+  object_ref println(object_ref const args)
+  {
+    write_out([&](jtl::string_builder &buff) {
+      if(!args.is_nil())
+      {
+        args.first().to_string(buff);
+        for(auto const e : make_sequence_range(args).skip(1))
+        {
+          buff(' ');
+          e.to_string(buff);
+        }
+      }
+      buff('\n');
+    });
     return {};
   }
 
@@ -187,42 +236,71 @@ namespace jank::runtime
       return {};
     }
 
-    auto const out{ get_stdout() };
-
-    jtl::string_builder buff;
-    buff(args.first().to_code_string());
-    for(auto const e : make_sequence_range(args).skip(1))
-    {
-      buff(' ');
-      buff(e.to_code_string());
-    }
-    std::fwrite(buff.data(), 1, buff.size(), out);
-
+    write_out([&](jtl::string_builder &buff) {
+      runtime::to_code_string(args.first(), buff);
+      for(auto const e : make_sequence_range(args).skip(1))
+      {
+        buff(' ');
+        runtime::to_code_string(e, buff);
+      }
+    });
     return {};
   }
 
   object_ref prn(object_ref const args)
   {
-    auto const out{ get_stdout() };
+    write_out([&](jtl::string_builder &buff) {
+      if(!args.is_nil())
+      {
+        runtime::to_code_string(args.first(), buff);
+        for(auto const e : make_sequence_range(args).skip(1))
+        {
+          buff(' ');
+          runtime::to_code_string(e, buff);
+        }
+      }
+      buff('\n');
+    });
+    return {};
+  }
+
+  object_ref newline()
+  {
+    write_out([](jtl::string_builder &buff) { buff('\n'); });
+    return {};
+  }
 
-    if(args.is_nil())
+  object_ref flush()
+  {
+    auto const out_val{ __rt_ctx->current_out_var->deref() };
+    switch(out_val.get_type())
     {
-      std::putc('\n', out);
+      case object_type::buffered_writer:
+        expect_object<obj::buffered_writer>(out_val)->flush();
+        break;
+      case object_type::file_writer:
+        expect_object<obj::file_writer>(out_val)->flush();
+        break;
+      default:
+        std::fflush(expect_stream(out_val));
+        break;
     }
-    else
+    return {};
+  }
+
+  obj::buffered_writer_ref make_buffered_writer(object_ref const out)
+  {
+    if(out.get_type() == object_type::buffered_writer)
     {
-      jtl::string_builder buff;
-      buff(args.first().to_code_string());
-      for(auto const e : make_sequence_range(args).skip(1))
+      auto const writer{ expect_object<obj::buffered_writer>(out) };
+      if(writer->is_owner())
       {
-        buff(' ');
-        buff(e.to_code_string());
+        return writer;
       }
-      std::fwrite(buff.data(), 1, buff.size(), out);
-      std::putc('\n', out);
+      /* We can't share another thread's buffer, but we can have our own over its file. */
+      return make_box<obj::buffered_writer>(writer->file);
     }
-
-    return {};
+    return make_box<obj::buffered_writer>(expect_stream(out));
   }
 
   jtl::immutable_string format(jtl::immutable_string const &format, object_ref const args)
@@ -692,6 +770,38 @@ namespace jank::runtime
     return v->reset(new_val);
   }
 
+  obj::striped_counter_ref striped_counter()
+  {
+    return make_box<obj::striped_counter>();
+  }
+
+  bool is_striped_counter(object_ref const o)
+  {
+    return o.get_type() == object_type::striped_counter;
+  }
+
+  object_ref striped_counter_add(object_ref const c, object_ref const n)
+  {
+    try_object<obj::striped_counter>(c)->add(to_int(n));
+    return c;
+  }
+
+  i64 striped_counter_sum(object_ref const c)
+  {
+    return try_object<obj::striped_counter>(c)->sum();
+  }
+
+  object_ref striped_counter_reset(object_ref const c)
+  {
+    try_object<obj::striped_counter>(c)->reset();
+    return c;
+  }
+
+  i64 striped_counter_sum_then_reset(object_ref const c)
+  {
+    return try_object<obj::striped_counter>(c)->sum_then_reset();
+  }
+
   void push_thread_bindings(object_ref const o)
   {
     __rt_ctx->push_thread_bindings(o).expect_ok();
@@ -1070,6 +1180,31 @@ namespace jank::runtime
     return __rt_ctx->read_file(typed_o->data, opts);
   }
 
+  object_ref edn_read_string(object_ref const s, object_ref const opts)
+  {
+    if(s.get_type() != object_type::persistent_string)
+    {
+      throw std::runtime_error{ util::format(
+        "The `clojure.edn/read-string` function expects a string, not a `{}`.",
+        object_type_str(s.get_type())) };
+    }
+
+    return read::edn::read(expect_object<obj::persistent_string>(s)->data,
+                           read::edn::options::from_map(opts))
+      .value;
+  }
+
+  /* Reads one form from wherever the reader is and leaves the reader just after it. The
+   * file is read straight out of its mapping. If the read fails, the reader stays put. */
+  object_ref edn_read(object_ref const rdr, object_ref const opts)
+  {
+    auto const reader{ try_object<obj::file_reader>(rdr) };
+    auto const res{ read::edn::read(reader->peek_remaining(),
+                                    read::edn::options::from_map(opts)) };
+    reader->offset += res.consumed;
+    return res.value;
+  }
+
   obj::character_ref to_char(object_ref const x)
   {
     if(x.get_type() == object_type::character)
@@ -1077,7 +1212,7 @@ namespace jank::runtime
       return expect_object<obj::character>(x);
     }
 
-    return make_box<obj::character>(to_int(x));
+    return obj::character::create(to_int(x));
   }
 
   obj::exception_info_ref ex_info(jtl::immutable_string const &message, object_ref const data)
@@ -0,0 +1,156 @@
+#include <jank/runtime/core/agent.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/sequence_range.hpp>
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/runtime/detail/transaction.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime
+{
+  static obj::agent_ref expect_agent(object_ref const o, char const * const fn)
+  {
+    if(o.get_type() != object_type::agent)
+    {
+      throw std::runtime_error{ util::format("The `{}` function expects an agent, not a `{}`.",
+                                             fn,
+                                             object_type_str(o.get_type())) };
+    }
+    return expect_object<obj::agent>(o);
+  }
+
+  obj::agent_ref agent(object_ref const state)
+  {
+    return make_box<obj::agent>(state);
+  }
+
+  bool is_agent(object_ref const o)
+  {
+    return o.get_type() == object_type::agent;
+  }
+
+  object_ref agent_send(object_ref const a, object_ref const fn, object_ref const args)
+  {
+    auto const typed_a{ expect_agent(a, "send") };
+    obj::agent::dispatch(typed_a, { fn, args, obj::agent_executor::send, {} });
+    return typed_a;
+  }
+
+  object_ref agent_send_off(object_ref const a, object_ref const fn, object_ref const args)
+  {
+    auto const typed_a{ expect_agent(a, "send-off") };
+    obj::agent::dispatch(typed_a, { fn, args, obj::agent_executor::send_off, {} });
+    return typed_a;
+  }
+
+  i64 release_pending_sends()
+  {
+    return static_cast<i64>(obj::agent::release_pending_sends());
+  }
+
+  object_ref agent_error(object_ref const a)
+  {
+    return expect_agent(a, "agent-error")->get_error();
+  }
+
+  object_ref restart_agent(object_ref const a, object_ref const new_state, bool const clear)
+  {
+    expect_agent(a, "restart-agent")->restart(new_state, clear);
+    return new_state;
+  }
+
+  object_ref set_agent_error_handler(object_ref const a, object_ref const handler)
+  {
+    auto const typed_a{ expect_agent(a, "set-error-handler!") };
+    auto locked_handler(typed_a->error_handler.wlock());
+    *locked_handler = handler;
+    return {};
+  }
+
+  object_ref get_agent_error_handler(object_ref const a)
+  {
+    auto const typed_a{ expect_agent(a, "error-handler") };
+    return *typed_a->error_handler.rlock();
+  }
+
+  object_ref set_agent_error_mode(object_ref const a, object_ref const mode)
+  {
+    auto const typed_a{ expect_agent(a, "set-error-mode!") };
+    if(mode.get_type() == object_type::keyword)
+    {
+      auto const &name{ expect_object<obj::keyword>(mode)->get_name() };
+      if(name == "fail" || name == "continue")
+      {
+        typed_a->error_mode.store(name == "fail" ? obj::agent_error_mode::fail
+                                                 : obj::agent_error_mode::continue_);
+        return {};
+      }
+    }
+
+    throw std::runtime_error{ util::format(
+      "An agent's error mode must be either :fail or :continue, not {}.",
+      runtime::to_code_string(mode)) };
+  }
+
+  object_ref get_agent_error_mode(object_ref const a)
+  {
+    auto const typed_a{ expect_agent(a, "error-mode") };
+    auto const fail{ typed_a->error_mode.load() == obj::agent_error_mode::fail };
+    return __rt_ctx->intern_keyword(fail ? "fail" : "continue").expect_ok();
+  }
+
+  static obj::agent::await_latch *send_latch(object_ref const agents)
+  {
+    if(obj::agent::running())
+    {
+      throw std::runtime_error{ "Can't await in agent action." };
+    }
+    if(detail::transaction::current())
+    {
+      throw std::runtime_error{ "Can't await in transaction." };
+    }
+
+    native_vector<obj::agent_ref> typed_agents;
+    for(auto const a : make_sequence_range(agents))
+    {
+      typed_agents.push_back(expect_agent(a, "await"));
+    }
+
+    /* The latch is queued behind everything sent so far, so it counts down only once
+     * those actions have run. A failed agent still takes the latch, which then waits for
+     * a restart. Nothing here can throw once we start queueing, so the latch never ends up
+     * on only some of the agents. */
+    auto const latch{ obj::agent::await_latch::create(typed_agents.size()) };
+    for(auto const a : typed_agents)
+    {
+      obj::agent::dispatch_action(a, { {}, {}, obj::agent_executor::send, latch });
+    }
+    return latch;
+  }
+
+  object_ref await_agents(object_ref const agents)
+  {
+    auto const latch{ send_latch(agents) };
+    detail::task_pool::blocking_scope const blocking;
+    latch->wait();
+    return {};
+  }
+
+  bool await_agents_for(object_ref const ms, object_ref const agents)
+  {
+    auto const latch{ send_latch(agents) };
+    detail::task_pool::blocking_scope const blocking;
+    return latch->wait_for(std::chrono::milliseconds{ to_int(ms) });
+  }
+
+  object_ref shutdown_agents()
+  {
+    obj::agent::shutdown();
+    return {};
+  }
+}
@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <jank/runtime/core/async.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/obj/channel.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/sequence_range.hpp>
+#include <jank/runtime/detail/fiber.hpp>
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/gc.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::runtime
+{
+  namespace
+  {
+    /* A single thread which closes timeout channels once their time is up. */
+    struct timeout_timer
+    {
+      using clock = std::chrono::steady_clock;
+
+      struct entry
+      {
+        clock::time_point deadline;
+        obj::channel_ref ch;
+      };
+
+      timeout_timer()
+      {
+        std::thread{ [this]() { run(); } }.detach();
+      }
+
+      static timeout_timer &instance()
+      {
+        /* Leaked and uncollectable, like the task pool, since it holds onto channels. */
+        static auto * const timer{ new(NoGC) timeout_timer{} };
+        return *timer;
+      }
+
+      static bool later(entry const &l, entry const &r)
+      {
+        return l.deadline > r.deadline;
+      }
+
+      void schedule(clock::time_point const deadline, obj::channel_ref const ch)
+      {
+        {
+          std::lock_guard<std::mutex> const lock{ mutex };
+          entries.push_back({ deadline, ch });
+          std::push_heap(entries.begin(), entries.end(), later);
+        }
+        cv.notify_one();
+      }
+
+      void run()
+      {
+        /* Closing a channel can run jank code, so this thread needs to be known to the GC.
+         * See `future` for the macOS caveat. */
+        if constexpr(jtl::current_platform != jtl::platform::macos_like)
+        {
+          GC_stack_base sb{};
+          GC_get_stack_base(&sb);
+          GC_register_my_thread(&sb);
+        }
+        util::scope_exit const unregister{ []() {
+          if constexpr(jtl::current_platform != jtl::platform::macos_like)
+          {
+            GC_unregister_my_thread();
+          }
+        } };
+
+        std::unique_lock<std::mutex> lock{ mutex };
+        while(true)
+        {
+          if(entries.empty())
+          {
+            cv.wait(lock);
+            continue;
+          }
+
+          auto const next{ entries.front() };
+          if(clock::now() < next.deadline)
+          {
+            cv.wait_until(lock, next.deadline);
+            continue;
+          }
+
+          std::pop_heap(entries.begin(), entries.end(), later);
+          entries.pop_back();
+          lock.unlock();
+          next.ch->close();
+          lock.lock();
+        }
+      }
+
+      std::mutex mutex;
+      std::condition_variable cv;
+      /* A min heap on the deadline. */
+      native_vector<entry> entries;
+    };
+  }
+
+  static obj::channel_ref expect_chan(object_ref const o, char const * const fn)
+  {
+    if(o.get_type() != object_type::channel)
+    {
+      throw std::runtime_error{ util::format("The `{}` function expects a channel, not a `{}`.",
+                                             fn,
+                                             object_type_str(o.get_type())) };
+    }
+    return expect_object<obj::channel>(o);
+  }
+
+  namespace
+  {
+    /* Where a take, put or alts waits for its result. Within a go block, that's the go
+     * block itself, which parks and gives its worker back. Anywhere else, the thread blocks
+     * on a promise. */
+    struct waiter
+    {
+      waiter()
+        : fiber{ detail::fiber::current() }
+      {
+        if(!fiber)
+        {
+          p = make_box<obj::promise>();
+        }
+      }
+
+      obj::channel::handler
+      handler(obj::channel::guard * const g, object_ref const val, object_ref const port) const
+      {
+        return { g, p, val, port, fiber };
+      }
+
+      object_ref wait() const
+      {
+        if(fiber)
+        {
+          return fiber->park();
+        }
+
+        auto const typed_p{ expect_object<obj::promise>(p) };
+        if(typed_p->is_realized())
+        {
+          return typed_p->deref();
+        }
+
+        detail::task_pool::blocking_scope const blocking;
+        return typed_p->deref();
+      }
+
+      detail::fiber *fiber{};
+      object_ref p;
+    };
+  }
+
+  obj::channel_ref chan(object_ref const kind, object_ref const n)
+  {
+    if(kind.is_nil())
+    {
+      return make_box<obj::channel>(obj::channel_buffer::none, 0);
+    }
+
+    auto const size{ to_int(n) };
+    if(size < 0)
+    {
+      throw std::runtime_error{ util::format("A channel buffer can't have a negative size: {}",
+                                             size) };
+    }
+
+    if(kind.get_type() == object_type::keyword)
+    {
+      auto const &name{ expect_object<obj::keyword>(kind)->get_name() };
+      if(name == "fixed")
+      {
+        return make_box<obj::channel>(size == 0 ? obj::channel_buffer::none
+                                                : obj::channel_buffer::fixed,
+                                      static_cast<usize>(size));
+      }
+
+      auto const buffer{ name == "dropping"  ? obj::channel_buffer::dropping
+                         : name == "sliding" ? obj::channel_buffer::sliding
+                                             : obj::channel_buffer::none };
+      if(buffer != obj::channel_buffer::none)
+      {
+        if(size == 0)
+        {
+          throw std::runtime_error{ util::format("A {} buffer must have a size of at least 1.",
+                                                 name) };
+        }
+        return make_box<obj::channel>(buffer, static_cast<usize>(size));
+      }
+    }
+
+    throw std::runtime_error{ util::format("Unknown channel buffer kind: {}", to_string(kind)) };
+  }
+
+  bool is_chan(object_ref const o)
+  {
+    return o.get_type() == object_type::channel;
+  }
+
+  bool chan_put(object_ref const ch, object_ref const val, object_ref const callback)
+  {
+    if(val.is_nil())
+    {
+      throw std::runtime_error{ "Can't put nil on a channel." };
+    }
+    return expect_chan(ch, "put!")->put({ obj::channel::guard::create(), callback, val, {} });
+  }
+
+  object_ref chan_take(object_ref const ch, object_ref const callback)
+  {
+    expect_chan(ch, "take!")->take({ obj::channel::guard::create(), callback, {}, {} });
+    return {};
+  }
+
+  bool chan_offer(object_ref const ch, object_ref const val)
+  {
+    if(val.is_nil())
+    {
+      throw std::runtime_error{ "Can't put nil on a channel." };
+    }
+    return expect_chan(ch, "offer!")->offer(val);
+  }
+
+  object_ref chan_poll(object_ref const ch)
+  {
+    return expect_chan(ch, "poll!")->poll();
+  }
+
+  object_ref chan_close(object_ref const ch)
+  {
+    expect_chan(ch, "close!")->close();
+    return {};
+  }
+
+  bool chan_put_blocking(object_ref const ch, object_ref const val)
+  {
+    if(val.is_nil())
+    {
+      throw std::runtime_error{ "Can't put nil on a channel." };
+    }
+    waiter const w;
+    expect_chan(ch, ">!!")->put(w.handler(obj::channel::guard::create(), val, {}));
+    return truthy(w.wait());
+  }
+
+  object_ref chan_take_blocking(object_ref const ch)
+  {
+    waiter const w;
+    expect_chan(ch, "<!!")->take(w.handler(obj::channel::guard::create(), {}, {}));
+    return w.wait();
+  }
+
+  object_ref alts(object_ref const ports,
+                  object_ref const priority,
+                  object_ref const has_default,
+                  object_ref const default_val)
+  {
+    native_vector<object_ref> ops;
+    for(auto const op : make_sequence_range(ports))
+    {
+      ops.push_back(op);
+    }
+    if(ops.empty())
+    {
+      throw std::runtime_error{ "alts requires at least one port." };
+    }
+    if(!truthy(priority))
+    {
+      thread_local std::mt19937 gen{ std::random_device{}() };
+      std::shuffle(ops.begin(), ops.end(), gen);
+    }
+
+    /* Every op is parked with the same guard, so only one can ever complete. The rest are
+     * dropped by their channels whenever they come across them. */
+    auto const g{ obj::channel::guard::create() };
+    waiter const w;
+    try
+    {
+      for(auto const op : ops)
+      {
+        if(is_vector(op))
+        {
+          auto const c{ expect_chan(first(op), "alts!") };
+          auto const val{ second(op) };
+          if(val.is_nil())
+          {
+            throw std::runtime_error{ "Can't put nil on a channel." };
+          }
+          c->put(w.handler(g, val, c));
+        }
+        else
+        {
+          auto const c{ expect_chan(op, "alts!") };
+          c->take(w.handler(g, {}, c));
+        }
+
+        if(g->is_done())
+        {
+          break;
+        }
+      }
+    }
+    catch(...)
+    {
+      /* The ops parked so far must not complete later on, since nothing will be waiting for
+       * them. If one already has, its result is already on the way, so we take that. */
+      if(g->lock())
+      {
+        g->commit();
+        throw;
+      }
+      return w.wait();
+    }
+
+    if(truthy(has_default) && g->lock())
+    {
+      g->commit();
+      return make_box<obj::persistent_vector>(std::in_place,
+                                              default_val,
+                                              __rt_ctx->intern_keyword("default").expect_ok());
+    }
+    return w.wait();
+  }
+
+  obj::channel_ref timeout(object_ref const ms)
+  {
+    auto const ret{ make_box<obj::channel>(obj::channel_buffer::none, 0) };
+    timeout_timer::instance().schedule(timeout_timer::clock::now()
+                                         + std::chrono::milliseconds{ to_int(ms) },
+                                       ret);
+    return ret;
+  }
+
+  object_ref dispatch(object_ref const fn)
+  {
+    detail::task_pool::instance().submit(fn);
+    return {};
+  }
+
+  object_ref go_dispatch(object_ref const fn)
+  {
+    detail::fiber::spawn(fn);
+    return {};
+  }
+}
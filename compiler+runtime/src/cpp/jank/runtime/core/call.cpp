@@ -1,8 +1,13 @@
+#include <algorithm>
+#include <array>
+
 #include <jank/runtime/core/call.hpp>
 #include <jank/runtime/behavior/seqable.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core.hpp>
-#include <jank/runtime/sequence_range.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/obj/native_array_sequence.hpp>
+#include <jank/runtime/obj/persistent_vector_sequence.hpp>
 #include <jank/util/make_array.hpp>
 #include <jank/util/fmt.hpp>
 
@@ -10,148 +15,172 @@ namespace jank::runtime
 {
   using namespace behavior;
 
-  object_ref apply_to(object_ref const source, object_ref const args)
+  using apply_args = std::array<object_ref, max_params>;
+
+  /* Reads args out of `args` into `out`, starting at `n`, until either `out` is full or
+   * `args` is exhausted. Anything left over is returned as a seq. Vectors are read by index,
+   * so `(apply f [a b c])` doesn't need to allocate a seq at all. */
+  static object_ref read_apply_args(apply_args &out, usize &n, object_ref const args)
   {
-    return apply_to(source, args, false);
+    if(args.get_type() == object_type::persistent_vector)
+    {
+      auto const v{ expect_object<obj::persistent_vector>(args) };
+      auto const size{ v->data.size() };
+      usize i{};
+      for(; i < size && n < max_params; ++i, ++n)
+      {
+        out[n] = v->data[i];
+      }
+      if(i == size)
+      {
+        return {};
+      }
+      return make_box<obj::persistent_vector_sequence>(v, i);
+    }
+
+    auto s{ seq(args) };
+    for(; s.is_some() && n < max_params; s = next(s), ++n)
+    {
+      out[n] = first(s);
+    }
+    return s;
   }
 
-  object_ref apply_to(object_ref const source, object_ref const args, bool const already_packed)
+  static object_ref apply_args_to(object_ref const source,
+                                  apply_args const &a,
+                                  usize const n,
+                                  object_ref const rest,
+                                  bool const already_packed)
   {
-    auto const s(args.fresh_seq());
-    auto const length(sequence_length(s, max_params + 1));
-    auto const r{ make_sequence_range(s) };
-    auto it{ r.begin() };
-
-    /* XXX: It's UB to have multiple *(++it) in one expression, since the order in
-         * which they will run is not defined. This requires us to pull out all of the
-         * args into locals. */
-    switch(length)
+    switch(n)
     {
       case 0:
         return source.call();
       case 1:
-        {
-          auto const a1{ *it };
-          return source.call(a1);
-        }
+        return source.call(a[0]);
       case 2:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          return source.call(a1, a2);
-        }
+        return source.call(a[0], a[1]);
       case 3:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          return source.call(a1, a2, a3);
-        }
+        return source.call(a[0], a[1], a[2]);
       case 4:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          return source.call(a1, a2, a3, a4);
-        }
+        return source.call(a[0], a[1], a[2], a[3]);
       case 5:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5);
-        }
+        return source.call(a[0], a[1], a[2], a[3], a[4]);
       case 6:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5, a6);
-        }
+        return source.call(a[0], a[1], a[2], a[3], a[4], a[5]);
       case 7:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          auto const a7{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5, a6, a7);
-        }
+        return source.call(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
       case 8:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          auto const a7{ *(++it) };
-          auto const a8{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5, a6, a7, a8);
-        }
+        return source.call(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
       case 9:
+        return source.call(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8]);
+      default:
+        if(rest.is_nil())
         {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          auto const a7{ *(++it) };
-          auto const a8{ *(++it) };
-          auto const a9{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5, a6, a7, a8, a9);
-        }
-      case 10:
-        {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          auto const a7{ *(++it) };
-          auto const a8{ *(++it) };
-          auto const a9{ *(++it) };
-          auto const a10{ *(++it) };
-          return source.call(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+          return source.call(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9]);
         }
-      default:
+        if(already_packed)
         {
-          auto const a1{ *it };
-          auto const a2{ *(++it) };
-          auto const a3{ *(++it) };
-          auto const a4{ *(++it) };
-          auto const a5{ *(++it) };
-          auto const a6{ *(++it) };
-          auto const a7{ *(++it) };
-          auto const a8{ *(++it) };
-          auto const a9{ *(++it) };
-          auto const a10{ *(++it) };
-          if(already_packed)
-          {
-            return source.call(a1,
-                               a2,
-                               a3,
-                               a4,
-                               a5,
-                               a6,
-                               a7,
-                               a8,
-                               a9,
-                               a10,
-                               try_object<obj::persistent_list>(*(++it)));
-          }
-          return source.call(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, (++it).data);
+          return source.call(a[0],
+                             a[1],
+                             a[2],
+                             a[3],
+                             a[4],
+                             a[5],
+                             a[6],
+                             a[7],
+                             a[8],
+                             a[9],
+                             try_object<obj::persistent_list>(first(rest)));
         }
+        return source.call(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], rest);
     }
   }
+
+  object_ref apply_to(object_ref const source, object_ref const args)
+  {
+    return apply_to(source, args, false);
+  }
+
+  object_ref apply_to(object_ref const source, object_ref const args, bool const already_packed)
+  {
+    apply_args a;
+    usize n{};
+    auto const rest{ read_apply_args(a, n, args) };
+    return apply_args_to(source, a, n, rest, already_packed);
+  }
+
+  object_ref apply_to(object_ref const source, object_ref const a1, object_ref const args)
+  {
+    apply_args a{ a1 };
+    usize n{ 1 };
+    auto const rest{ read_apply_args(a, n, args) };
+    return apply_args_to(source, a, n, rest, false);
+  }
+
+  object_ref apply_to(object_ref const source,
+                      object_ref const a1,
+                      object_ref const a2,
+                      object_ref const args)
+  {
+    apply_args a{ a1, a2 };
+    usize n{ 2 };
+    auto const rest{ read_apply_args(a, n, args) };
+    return apply_args_to(source, a, n, rest, false);
+  }
+
+  object_ref apply_to(object_ref const source,
+                      object_ref const a1,
+                      object_ref const a2,
+                      object_ref const a3,
+                      object_ref const args)
+  {
+    apply_args a{ a1, a2, a3 };
+    usize n{ 3 };
+    auto const rest{ read_apply_args(a, n, args) };
+    return apply_args_to(source, a, n, rest, false);
+  }
+
+  object_ref pack_rest(callable_arity_flags const arity_flags,
+                       std::initializer_list<object_ref> const args)
+  {
+    if(is_variadic_rest_unused(arity_flags) || args.size() == 0)
+    {
+      return {};
+    }
+
+    auto const arr{ make_array_box<object_ref>(args.size()) };
+    std::copy(args.begin(), args.end(), arr.data);
+    return make_box<obj::native_array_sequence>(arr.data, args.size());
+  }
+
+  object_ref pack_rest(callable_arity_flags const arity_flags,
+                       std::initializer_list<object_ref> const args,
+                       object_ref const more)
+  {
+    if(is_variadic_rest_unused(arity_flags))
+    {
+      return {};
+    }
+    if(more.is_nil())
+    {
+      return pack_rest(arity_flags, args);
+    }
+
+    /* Callers pack args beyond `max_params` into a list, which we know the size of, so
+     * everything can go into one array. Anything else may be lazy, or even infinite, so it
+     * needs to stay lazy. */
+    if(more.get_type() == object_type::persistent_list)
+    {
+      auto const &list{ expect_object<obj::persistent_list>(more)->data };
+      auto const size{ args.size() + list.size() };
+      auto const arr{ make_array_box<object_ref>(size) };
+      auto const it{ std::copy(args.begin(), args.end(), arr.data) };
+      std::copy(list.begin(), list.end(), it);
+      return make_box<obj::native_array_sequence>(arr.data, size);
+    }
+
+    static auto const concat{ __rt_ctx->intern_var("clojure.core/concat*").expect_ok()->deref() };
+    return concat.call(pack_rest(arity_flags, args), more);
+  }
 }
@@ -0,0 +1,35 @@
+#include <jank/runtime/core/call_site.hpp>
+#include <jank/gc.hpp>
+
+namespace jank::runtime::detail
+{
+  call_site_cache &call_site_cache::create()
+  {
+    /* Uncollectable, so the GC scans it for the callee, but never frees it. Call sites are
+     * never freed either. */
+    return *new(NoGC) call_site_cache{};
+  }
+
+  bool call_site_cache::miss()
+  {
+    if(misses.fetch_add(1, std::memory_order_relaxed) < max_misses)
+    {
+      return false;
+    }
+
+    callee.store(nullptr, std::memory_order_relaxed);
+    callee_type.store(object_type::nil, std::memory_order_relaxed);
+    megamorphic.store(true, std::memory_order_relaxed);
+    return true;
+  }
+
+  void call_site_cache::observe_callee(object_ref const fn)
+  {
+    callee.store(fn.raw(), std::memory_order_relaxed);
+  }
+
+  void call_site_cache::observe_type(object_type const type)
+  {
+    callee_type.store(type, std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,837 @@
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include <uuid.h>
+
+#include <jank/runtime/core/freeze.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/obj/big_decimal.hpp>
+#include <jank/runtime/obj/big_integer.hpp>
+#include <jank/runtime/obj/character.hpp>
+#include <jank/runtime/obj/file_reader.hpp>
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/runtime/obj/inst.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_hash_set.hpp>
+#include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_sorted_map.hpp>
+#include <jank/runtime/obj/persistent_sorted_set.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/ratio.hpp>
+#include <jank/runtime/obj/string_rope.hpp>
+#include <jank/runtime/obj/tagged_literal.hpp>
+#include <jank/runtime/obj/uuid.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime
+{
+  /* Every frozen value starts with this. The last byte is the format version, which needs
+   * to be bumped whenever the encoding of an existing tag changes. */
+  static constexpr std::array<char, 4> header{ 'J', 'N', 'K', 1 };
+
+  /* Both sides enforce the same limit, so anything we can freeze can also be thawed. This
+   * also keeps hostile input from overflowing the native stack. */
+  static constexpr usize max_depth{ 1024 };
+
+  /* File writers do their own buffering, so we hand them data in chunks of this size. */
+  static constexpr usize chunk_size{ 64 * 1024 };
+
+  /* NOTE: These are part of the format. Only ever add new tags to the end. */
+  enum class freeze_tag : u8
+  {
+    nil,
+    boolean_false,
+    boolean_true,
+    integer,
+    real,
+    big_integer,
+    ratio,
+    big_decimal,
+    string,
+    character,
+    keyword,
+    keyword_ref,
+    symbol,
+    symbol_ref,
+    list,
+    vector,
+    map,
+    sorted_map,
+    set,
+    sorted_set,
+    inst,
+    uuid,
+    tagged_literal,
+    meta,
+  };
+
+  /* A comparator can't be frozen, so sorted collections are thawed with the default
+   * ordering. That's only faithful while sorted collections can't be built with any
+   * other. Once they can, freezing needs to refuse the ones which have a custom one. */
+  static_assert(std::is_same_v<runtime::detail::native_persistent_sorted_map::key_compare,
+                               runtime::detail::object_ref_compare>);
+  static_assert(std::is_same_v<runtime::detail::native_persistent_sorted_set::key_compare,
+                               runtime::detail::object_ref_compare>);
+
+  /*** Freezing. ***/
+
+  struct freezer
+  {
+    void write_tag(freeze_tag const tag);
+    void write_varint(u64 n);
+    void write_signed(i64 const n);
+    void write_bytes(jtl::immutable_string_view const &s);
+    void write_big_integer(native_big_integer const &n);
+    /* Returns true if `o` has already been written, in which case only its index is. */
+    bool write_interned(object_ref const o, freeze_tag const ref_tag);
+    void write_meta(object_ref const meta);
+    void write(object_ref const o);
+    void drain();
+
+    jtl::string_builder &buff;
+    obj::file_writer_ref sink;
+    native_unordered_map<object_ref, u32> interned;
+    usize depth{};
+  };
+
+  void freezer::write_tag(freeze_tag const tag)
+  {
+    buff(static_cast<char>(tag));
+  }
+
+  /* LEB128, so small counts and lengths take a single byte. */
+  void freezer::write_varint(u64 n)
+  {
+    while(n >= 0x80)
+    {
+      buff(static_cast<char>((n & 0x7f) | 0x80));
+      n >>= 7;
+    }
+    buff(static_cast<char>(n));
+  }
+
+  /* Zigzag encoded, so small negative numbers stay small. */
+  void freezer::write_signed(i64 const n)
+  {
+    write_varint((static_cast<u64>(n) << 1) ^ static_cast<u64>(n >> 63));
+  }
+
+  void freezer::write_bytes(jtl::immutable_string_view const &s)
+  {
+    write_varint(s.size());
+    buff(s);
+  }
+
+  void freezer::write_big_integer(native_big_integer const &n)
+  {
+    std::array<u8, 64> small{};
+    native_vector<u8> large;
+    buff(static_cast<char>(n.sign() < 0));
+
+    auto const magnitude{ boost::multiprecision::abs(n) };
+    auto const bits{ magnitude.is_zero() ? 0 : boost::multiprecision::msb(magnitude) + 1 };
+    auto const size{ (bits + 7) / 8 };
+    if(size <= small.size())
+    {
+      boost::multiprecision::export_bits(magnitude, small.begin(), 8, false);
+      write_bytes({ reinterpret_cast<char const *>(small.data()), size });
+      return;
+    }
+
+    boost::multiprecision::export_bits(magnitude, std::back_inserter(large), 8, false);
+    write_bytes({ reinterpret_cast<char const *>(large.data()), large.size() });
+  }
+
+  bool freezer::write_interned(object_ref const o, freeze_tag const ref_tag)
+  {
+    auto const found{ interned.find(o) };
+    if(found != interned.end())
+    {
+      write_tag(ref_tag);
+      write_varint(found->second);
+      return true;
+    }
+
+    interned.emplace(o, static_cast<u32>(interned.size()));
+    return false;
+  }
+
+  void freezer::write_meta(object_ref const meta)
+  {
+    if(meta.is_nil())
+    {
+      return;
+    }
+
+    write_tag(freeze_tag::meta);
+    write(meta);
+  }
+
+  void freezer::drain()
+  {
+    if(sink.is_some() && chunk_size <= buff.size())
+    {
+      sink->write(buff.view());
+      buff.clear();
+    }
+  }
+
+  void freezer::write(object_ref const o)
+  {
+    if(max_depth < ++depth)
+    {
+      throw std::runtime_error{ util::format(
+        "Unable to freeze data which is nested more than {} levels deep.",
+        max_depth) };
+    }
+
+    switch(o.get_type())
+    {
+      case object_type::nil:
+        write_tag(freeze_tag::nil);
+        break;
+      case object_type::boolean:
+        write_tag(expect_object<obj::boolean>(o)->data ? freeze_tag::boolean_true
+                                                        : freeze_tag::boolean_false);
+        break;
+      case object_type::integer:
+      case object_type::small_integer:
+        write_tag(freeze_tag::integer);
+        write_signed(o.to_integer());
+        break;
+      case object_type::real:
+      case object_type::small_real:
+        {
+          write_tag(freeze_tag::real);
+          auto bits{ std::bit_cast<u64>(o.to_real()) };
+          for(usize i{}; i < sizeof(bits); ++i, bits >>= 8)
+          {
+            buff(static_cast<char>(bits & 0xff));
+          }
+        }
+        break;
+      case object_type::big_integer:
+        write_tag(freeze_tag::big_integer);
+        write_big_integer(expect_object<obj::big_integer>(o)->data);
+        break;
+      case object_type::ratio:
+        {
+          auto const r{ expect_object<obj::ratio>(o) };
+          write_tag(freeze_tag::ratio);
+          write_big_integer(r->data.numerator);
+          write_big_integer(r->data.denominator);
+        }
+        break;
+      case object_type::big_decimal:
+        write_tag(freeze_tag::big_decimal);
+        write_bytes(expect_object<obj::big_decimal>(o)->data.str());
+        break;
+      case object_type::persistent_string:
+        write_tag(freeze_tag::string);
+        write_bytes(expect_object<obj::persistent_string>(o)->data);
+        break;
+      case object_type::string_rope:
+        write_tag(freeze_tag::string);
+        write_bytes(o->to_string());
+        break;
+      case object_type::character:
+        write_tag(freeze_tag::character);
+        write_bytes(expect_object<obj::character>(o)->data);
+        break;
+      case object_type::keyword:
+        if(!write_interned(o, freeze_tag::keyword_ref))
+        {
+          auto const k{ expect_object<obj::keyword>(o) };
+          write_tag(freeze_tag::keyword);
+          write_bytes(k->get_namespace());
+          write_bytes(k->get_name());
+        }
+        break;
+      case object_type::symbol:
+        {
+          auto const s{ expect_object<obj::symbol>(o) };
+          write_meta(s->get_meta());
+          if(!write_interned(o, freeze_tag::symbol_ref))
+          {
+            write_tag(freeze_tag::symbol);
+            write_bytes(s->get_namespace());
+            write_bytes(s->get_name());
+          }
+        }
+        break;
+      case object_type::persistent_list:
+        {
+          auto const l{ expect_object<obj::persistent_list>(o) };
+          write_meta(l->get_meta());
+          write_tag(freeze_tag::list);
+          write_varint(l->data.size());
+          for(auto const &e : l->data)
+          {
+            write(e);
+          }
+        }
+        break;
+      case object_type::persistent_vector:
+        {
+          auto const v{ expect_object<obj::persistent_vector>(o) };
+          write_meta(v->get_meta());
+          write_tag(freeze_tag::vector);
+          write_varint(v->data.size());
+          for(auto const &e : v->data)
+          {
+            write(e);
+          }
+        }
+        break;
+      case object_type::persistent_array_map:
+        {
+          auto const m{ expect_object<obj::persistent_array_map>(o) };
+          write_meta(m->get_meta());
+          write_tag(freeze_tag::map);
+          write_varint(m->data.size());
+          for(auto const &[k, v] : m->data)
+          {
+            write(k);
+            write(v);
+          }
+        }
+        break;
+      case object_type::persistent_shape_map:
+        {
+          auto const m{ expect_object<obj::persistent_shape_map>(o) };
+          write_meta(m->get_meta());
+          write_tag(freeze_tag::map);
+          write_varint(m->data.size());
+          for(auto const &e : m->data)
+          {
+            write(e.first);
+            write(e.second);
+          }
+        }
+        break;
+      case object_type::persistent_hash_map:
+        {
+          auto const m{ expect_object<obj::persistent_hash_map>(o) };
+          write_meta(m->get_meta());
+          write_tag(freeze_tag::map);
+          write_varint(m->data.size());
+          for(auto const &e : m->data)
+          {
+            write(e.first);
+            write(e.second);
+          }
+        }
+        break;
+      case object_type::persistent_sorted_map:
+        {
+          auto const m{ expect_object<obj::persistent_sorted_map>(o) };
+          write_meta(m->get_meta());
+          write_tag(freeze_tag::sorted_map);
+          write_varint(m->data.size());
+          for(auto const &e : m->data)
+          {
+            write(e.first);
+            write(e.second);
+          }
+        }
+        break;
+      case object_type::persistent_hash_set:
+        {
+          auto const s{ expect_object<obj::persistent_hash_set>(o) };
+          write_meta(s->get_meta());
+          write_tag(freeze_tag::set);
+          write_varint(s->data.size());
+          for(auto const &e : s->data)
+          {
+            write(e);
+          }
+        }
+        break;
+      case object_type::persistent_sorted_set:
+        {
+          auto const s{ expect_object<obj::persistent_sorted_set>(o) };
+          write_meta(s->get_meta());
+          write_tag(freeze_tag::sorted_set);
+          write_varint(s->data.size());
+          for(auto const &e : s->data)
+          {
+            write(e);
+          }
+        }
+        break;
+      case object_type::inst:
+        write_tag(freeze_tag::inst);
+        write_signed(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       expect_object<obj::inst>(o)->value.time_since_epoch())
+                       .count());
+        break;
+      case object_type::uuid:
+        {
+          write_tag(freeze_tag::uuid);
+          auto const bytes{ expect_object<obj::uuid>(o)->value->as_bytes() };
+          buff(jtl::immutable_string_view{ reinterpret_cast<char const *>(bytes.data()),
+                                           bytes.size() });
+        }
+        break;
+      case object_type::tagged_literal:
+        {
+          auto const t{ expect_object<obj::tagged_literal>(o) };
+          write_tag(freeze_tag::tagged_literal);
+          write(t->tag);
+          write(t->form);
+        }
+        break;
+      default:
+        /* Any other seq, such as a lazy seq or a range, is realized and frozen as a list. */
+        if(is_seq(o))
+        {
+          native_vector<object_ref> items;
+          for(auto it{ seq(o) }; it.is_some(); it = next(it))
+          {
+            items.push_back(first(it));
+          }
+          write_meta(meta(o));
+          write_tag(freeze_tag::list);
+          write_varint(items.size());
+          for(auto const &e : items)
+          {
+            write(e);
+          }
+          break;
+        }
+
+        throw std::runtime_error{ util::format("Unable to freeze a value of type `{}`.",
+                                               object_type_str(o.get_type())) };
+    }
+
+    --depth;
+    drain();
+  }
+
+  void freeze(object_ref const o, jtl::string_builder &buff, obj::file_writer_ref const sink)
+  {
+    buff(jtl::immutable_string_view{ header.data(), header.size() });
+    freezer f{ buff, sink, {}, {} };
+    f.write(o);
+    if(sink.is_some())
+    {
+      sink->write(buff.view());
+      buff.clear();
+    }
+  }
+
+  jtl::immutable_string freeze(object_ref const o)
+  {
+    jtl::string_builder buff;
+    freeze(o, buff, {});
+    return buff.release();
+  }
+
+  /*** Thawing. ***/
+
+  /* Collections are built through transients, or straight into exact size array maps, and
+   * every count is checked against the input size before anything is reserved. */
+  struct thawer
+  {
+    [[noreturn]] void fail(char const * const reason) const;
+    u8 read_byte();
+    u64 read_varint();
+    i64 read_signed();
+    usize read_count(usize const min_item_size);
+    jtl::immutable_string_view read_bytes();
+    native_big_integer read_big_integer();
+    object_ref read_interned(usize const index) const;
+    object_ref read();
+
+    jtl::immutable_string_view input;
+    usize pos{};
+    native_vector<object_ref> interned;
+    usize depth{};
+  };
+
+  void thawer::fail(char const * const reason) const
+  {
+    throw std::runtime_error{ util::format("Unable to thaw at byte {}: {}.", pos, reason) };
+  }
+
+  u8 thawer::read_byte()
+  {
+    if(input.size() <= pos)
+    {
+      fail("unexpected end of input");
+    }
+    return static_cast<u8>(input[pos++]);
+  }
+
+  u64 thawer::read_varint()
+  {
+    u64 ret{};
+    for(u32 shift{}; shift < 64; shift += 7)
+    {
+      auto const b{ read_byte() };
+      ret |= static_cast<u64>(b & 0x7f) << shift;
+      if((b & 0x80) == 0)
+      {
+        return ret;
+      }
+    }
+    fail("varint is too long");
+  }
+
+  i64 thawer::read_signed()
+  {
+    auto const n{ read_varint() };
+    return static_cast<i64>((n >> 1) ^ (~(n & 1) + 1));
+  }
+
+  /* Every item takes at least `min_item_size` bytes, so a count which can't possibly fit in
+   * what's left of the input is rejected before we allocate for it. */
+  usize thawer::read_count(usize const min_item_size)
+  {
+    auto const count{ read_varint() };
+    if((input.size() - pos) / min_item_size < count)
+    {
+      fail("count is larger than the remaining input");
+    }
+    return static_cast<usize>(count);
+  }
+
+  jtl::immutable_string_view thawer::read_bytes()
+  {
+    auto const size{ read_count(1) };
+    jtl::immutable_string_view const ret{ input.data() + pos, size };
+    pos += size;
+    return ret;
+  }
+
+  native_big_integer thawer::read_big_integer()
+  {
+    auto const negative{ read_byte() != 0 };
+    auto const bytes{ read_bytes() };
+    native_big_integer ret;
+    boost::multiprecision::import_bits(ret,
+                                       reinterpret_cast<u8 const *>(bytes.data()),
+                                       reinterpret_cast<u8 const *>(bytes.data() + bytes.size()),
+                                       8,
+                                       false);
+    return negative ? native_big_integer{ -ret } : ret;
+  }
+
+  object_ref thawer::read_interned(usize const index) const
+  {
+    if(interned.size() <= index)
+    {
+      fail("back reference to an unknown keyword or symbol");
+    }
+    return interned[index];
+  }
+
+  object_ref thawer::read()
+  {
+    if(max_depth < ++depth)
+    {
+      fail("data is nested too deeply");
+    }
+
+    object_ref ret;
+    auto const tag{ read_byte() };
+    switch(static_cast<freeze_tag>(tag))
+    {
+      case freeze_tag::nil:
+        ret = jank_nil;
+        break;
+      case freeze_tag::boolean_false:
+        ret = jank_false;
+        break;
+      case freeze_tag::boolean_true:
+        ret = jank_true;
+        break;
+      case freeze_tag::integer:
+        ret = make_box(read_signed());
+        break;
+      case freeze_tag::real:
+        {
+          u64 bits{};
+          for(usize i{}; i < sizeof(bits); ++i)
+          {
+            bits |= static_cast<u64>(read_byte()) << (i * 8);
+          }
+          ret = make_box(std::bit_cast<f64>(bits));
+        }
+        break;
+      case freeze_tag::big_integer:
+        ret = make_box(read_big_integer());
+        break;
+      case freeze_tag::ratio:
+        {
+          auto const numerator{ read_big_integer() };
+          auto const denominator{ read_big_integer() };
+          ret = make_box<obj::ratio>(obj::ratio_data{ numerator, denominator });
+        }
+        break;
+      case freeze_tag::big_decimal:
+        ret = make_box<obj::big_decimal>(jtl::immutable_string{ read_bytes() });
+        break;
+      case freeze_tag::string:
+        ret = make_box<obj::persistent_string>(read_bytes());
+        break;
+      case freeze_tag::character:
+        ret = obj::character::create(read_bytes());
+        break;
+      case freeze_tag::keyword:
+        {
+          jtl::immutable_string const ns{ read_bytes() };
+          jtl::immutable_string const name{ read_bytes() };
+          auto const intern_res(__rt_ctx->intern_keyword(ns, name, true));
+          if(intern_res.is_err())
+          {
+            throw std::runtime_error{ util::format("Unable to thaw keyword: {}",
+                                                   intern_res.expect_err()) };
+          }
+          ret = intern_res.expect_ok();
+          interned.push_back(ret);
+        }
+        break;
+      case freeze_tag::symbol:
+        {
+          jtl::immutable_string const ns{ read_bytes() };
+          jtl::immutable_string const name{ read_bytes() };
+          ret = make_box<obj::symbol>(ns, name);
+          interned.push_back(ret);
+        }
+        break;
+      case freeze_tag::keyword_ref:
+      case freeze_tag::symbol_ref:
+        ret = read_interned(read_varint());
+        break;
+      case freeze_tag::list:
+        {
+          auto const count{ read_count(1) };
+          native_vector<object_ref> items;
+          items.reserve(count);
+          for(usize i{}; i < count; ++i)
+          {
+            items.push_back(read());
+          }
+          ret = items.empty()
+            ? obj::persistent_list::empty().erase()
+            : make_box<obj::persistent_list>(std::in_place, items.rbegin(), items.rend()).erase();
+        }
+        break;
+      case freeze_tag::vector:
+        {
+          auto const count{ read_count(1) };
+          runtime::detail::native_transient_vector items;
+          for(usize i{}; i < count; ++i)
+          {
+            items.push_back(read());
+          }
+          ret = make_box<obj::persistent_vector>(items.persistent());
+        }
+        break;
+      case freeze_tag::map:
+        {
+          auto const count{ read_count(2) };
+          if(count <= obj::persistent_array_map::max_size)
+          {
+            auto const array_box(make_array_box<object_ref>(count * 2));
+            for(usize i{}; i < count * 2; i += 2)
+            {
+              array_box.data[i] = read();
+              array_box.data[i + 1] = read();
+              for(usize k{}; k < i; k += 2)
+              {
+                if(equal(array_box.data[k], array_box.data[i]))
+                {
+                  fail("duplicate map key");
+                }
+              }
+            }
+            ret = make_box<obj::persistent_array_map>(runtime::detail::in_place_unique{},
+                                                      array_box,
+                                                      count * 2);
+            break;
+          }
+          if(count <= obj::persistent_shape_map::max_size)
+          {
+            auto const array_box(make_array_box<object_ref>(count * 2));
+            for(usize i{}; i < count * 2; ++i)
+            {
+              array_box.data[i] = read();
+            }
+            if(obj::persistent_shape_map::can_hold(array_box.data, count * 2))
+            {
+              ret = obj::persistent_shape_map::create_unique({}, array_box.data, count * 2);
+              break;
+            }
+
+            runtime::detail::native_transient_hash_map items;
+            for(usize i{}; i < count * 2; i += 2)
+            {
+              items.set(array_box.data[i], array_box.data[i + 1]);
+            }
+            if(items.size() != count)
+            {
+              fail("duplicate map key");
+            }
+            ret = make_box<obj::persistent_hash_map>(items.persistent());
+            break;
+          }
+
+          runtime::detail::native_transient_hash_map items;
+          for(usize i{}; i < count; ++i)
+          {
+            auto const k{ read() };
+            items.set(k, read());
+          }
+          if(items.size() != count)
+          {
+            fail("duplicate map key");
+          }
+          ret = make_box<obj::persistent_hash_map>(items.persistent());
+        }
+        break;
+      case freeze_tag::sorted_map:
+        {
+          auto const count{ read_count(2) };
+          runtime::detail::native_persistent_sorted_map items;
+          for(usize i{}; i < count; ++i)
+          {
+            auto const k{ read() };
+            items.insert_or_assign(k, read());
+          }
+          if(items.size() != count)
+          {
+            fail("duplicate map key");
+          }
+          ret = make_box<obj::persistent_sorted_map>(std::move(items));
+        }
+        break;
+      case freeze_tag::set:
+        {
+          auto const count{ read_count(1) };
+          runtime::detail::native_transient_hash_set items;
+          for(usize i{}; i < count; ++i)
+          {
+            items.insert(read());
+          }
+          if(items.size() != count)
+          {
+            fail("duplicate set item");
+          }
+          ret = make_box<obj::persistent_hash_set>(items.persistent());
+        }
+        break;
+      case freeze_tag::sorted_set:
+        {
+          auto const count{ read_count(1) };
+          runtime::detail::native_persistent_sorted_set items;
+          for(usize i{}; i < count; ++i)
+          {
+            items.insert(read());
+          }
+          if(items.size() != count)
+          {
+            fail("duplicate set item");
+          }
+          ret = make_box<obj::persistent_sorted_set>(std::move(items));
+        }
+        break;
+      case freeze_tag::inst:
+        ret = make_box<obj::inst>(obj::inst_time_point{
+          std::chrono::duration_cast<obj::inst_time_point::duration>(
+            std::chrono::nanoseconds{ read_signed() }) });
+        break;
+      case freeze_tag::uuid:
+        {
+          std::array<u8, 16> bytes{};
+          for(auto &b : bytes)
+          {
+            b = read_byte();
+          }
+          ret = make_box<obj::uuid>(bytes);
+        }
+        break;
+      case freeze_tag::tagged_literal:
+        {
+          auto const t{ read() };
+          ret = make_box<obj::tagged_literal>(t, read());
+        }
+        break;
+      case freeze_tag::meta:
+        {
+          auto const m{ read() };
+          ret = with_meta(read(), m);
+        }
+        break;
+      default:
+        fail("unknown tag");
+    }
+
+    --depth;
+    return ret;
+  }
+
+  thaw_result thaw(jtl::immutable_string_view const &input)
+  {
+    if(input.size() < header.size()
+       || std::memcmp(input.data(), header.data(), header.size() - 1) != 0)
+    {
+      throw std::runtime_error{ "Unable to thaw: the input isn't frozen jank data." };
+    }
+    if(input[header.size() - 1] != header.back())
+    {
+      throw std::runtime_error{ util::format(
+        "Unable to thaw: the input uses format version {}, but only version {} is supported.",
+        static_cast<int>(input[header.size() - 1]),
+        static_cast<int>(header.back())) };
+    }
+
+    thawer t{ input, header.size(), {}, {} };
+    auto const value{ t.read() };
+    return { value, t.pos };
+  }
+
+  /*** jank entry points. ***/
+
+  obj::persistent_string_ref freeze_str(object_ref const o)
+  {
+    return make_box<obj::persistent_string>(freeze(o));
+  }
+
+  object_ref freeze_to(object_ref const w, object_ref const o)
+  {
+    jtl::string_builder buff;
+    freeze(o, buff, try_object<obj::file_writer>(w));
+    return jank_nil;
+  }
+
+  object_ref thaw_str(object_ref const s)
+  {
+    return thaw(try_object<obj::persistent_string>(s)->data).value;
+  }
+
+  /* Thaws one value from wherever the reader is and leaves the reader just after it. The
+   * file is read straight out of its mapping. */
+  object_ref thaw_from(object_ref const rdr)
+  {
+    auto const reader{ try_object<obj::file_reader>(rdr) };
+    auto const remaining{ reader->read_remaining() };
+    auto const res{ thaw(remaining) };
+    reader->offset -= remaining.size() - res.consumed;
+    return res.value;
+  }
+}
@@ -0,0 +1,163 @@
+#include <jank/runtime/core/io.hpp>
+#include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/core/truthy.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/file_reader.hpp>
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/runtime/obj/buffered_writer.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime
+{
+  static jtl::immutable_string const &expect_path(object_ref const path, char const * const fn)
+  {
+    if(path.get_type() != object_type::persistent_string)
+    {
+      throw std::runtime_error{ util::format(
+        "The `{}` function expects a string representing a file path, not a `{}`.",
+        fn,
+        object_type_str(path.get_type())) };
+    }
+
+    return expect_object<obj::persistent_string>(path)->data;
+  }
+
+  obj::file_reader_ref open_reader(object_ref const path)
+  {
+    auto file(module::loader::read_file(expect_path(path, "reader")));
+    if(file.is_err())
+    {
+      throw file.expect_err();
+    }
+
+    return make_box<obj::file_reader>(jtl::move(file.expect_ok()));
+  }
+
+  obj::file_writer_ref open_writer(object_ref const path, object_ref const append)
+  {
+    return make_box<obj::file_writer>(expect_path(path, "writer"), truthy(append));
+  }
+
+  bool is_reader(object_ref const o)
+  {
+    return o.get_type() == object_type::file_reader;
+  }
+
+  bool is_writer(object_ref const o)
+  {
+    return o.get_type() == object_type::file_writer;
+  }
+
+  object_ref read_line(object_ref const rdr)
+  {
+    return try_object<obj::file_reader>(rdr)->read_line();
+  }
+
+  object_ref read_line_chunk(object_ref const rdr)
+  {
+    return try_object<obj::file_reader>(rdr)->read_line_chunk();
+  }
+
+  object_ref load_reader(object_ref const rdr)
+  {
+    auto const reader{ try_object<obj::file_reader>(rdr) };
+    return __rt_ctx->eval_string(reader->read_remaining()).unwrap_or(jank_nil);
+  }
+
+  object_ref write_string(object_ref const w, object_ref const s)
+  {
+    if(w.get_type() == object_type::buffered_writer)
+    {
+      auto const writer{ expect_object<obj::buffered_writer>(w) };
+      if(s.get_type() == object_type::persistent_string)
+      {
+        writer->write(expect_object<obj::persistent_string>(s)->data);
+      }
+      else if(writer->is_owner())
+      {
+        s.to_string(writer->buff);
+        writer->wrote();
+      }
+      else
+      {
+        writer->write(runtime::to_string(s));
+      }
+      return {};
+    }
+
+    auto const writer{ try_object<obj::file_writer>(w) };
+    if(s.get_type() == object_type::persistent_string)
+    {
+      writer->write(expect_object<obj::persistent_string>(s)->data);
+    }
+    else
+    {
+      writer->write(runtime::to_string(s));
+    }
+    return {};
+  }
+
+  object_ref flush_writer(object_ref const w)
+  {
+    if(w.get_type() == object_type::buffered_writer)
+    {
+      expect_object<obj::buffered_writer>(w)->flush();
+    }
+    else
+    {
+      try_object<obj::file_writer>(w)->flush();
+    }
+    return {};
+  }
+
+  object_ref close_stream(object_ref const o)
+  {
+    switch(o.get_type())
+    {
+      case object_type::file_reader:
+        expect_object<obj::file_reader>(o)->close();
+        break;
+      case object_type::file_writer:
+        expect_object<obj::file_writer>(o)->close();
+        break;
+      /* We don't own the underlying stream, so closing just flushes. */
+      case object_type::buffered_writer:
+        expect_object<obj::buffered_writer>(o)->flush();
+        break;
+      default:
+        throw std::runtime_error{ util::format("Objects of type `{}` can't be closed.",
+                                               object_type_str(o.get_type())) };
+    }
+    return {};
+  }
+
+  obj::persistent_string_ref slurp(object_ref const path)
+  {
+    auto const file(module::loader::read_file(expect_path(path, "slurp")));
+    if(file.is_err())
+    {
+      throw file.expect_err();
+    }
+
+    return make_box<obj::persistent_string>(jtl::immutable_string{ file.expect_ok().view() });
+  }
+
+  object_ref spit(object_ref const path, object_ref const content, object_ref const append)
+  {
+    auto const writer{ make_box<obj::file_writer>(expect_path(path, "spit"), truthy(append)) };
+    try
+    {
+      write_string(writer, content);
+    }
+    catch(...)
+    {
+      writer->close();
+      throw;
+    }
+    writer->close();
+    return {};
+  }
+}
@@ -1,6 +1,9 @@
 #include <algorithm>
+#include <array>
 #include <random>
 
+#include <immer/algorithm.hpp>
+
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/behavior/associatively_writable.hpp>
 #include <jank/runtime/core/call.hpp>
@@ -11,6 +14,8 @@
 #include <jank/runtime/behavior/sequential.hpp>
 #include <jank/runtime/behavior/collection_like.hpp>
 #include <jank/runtime/behavior/map_like.hpp>
+#include <jank/runtime/behavior/kv_reducible.hpp>
+#include <jank/runtime/behavior/reducible.hpp>
 #include <jank/runtime/behavior/transientable.hpp>
 #include <jank/runtime/behavior/stackable.hpp>
 #include <jank/runtime/behavior/chunkable.hpp>
@@ -19,6 +24,7 @@
 #include <jank/runtime/core/equal.hpp>
 #include <jank/runtime/core/meta.hpp>
 #include <jank/runtime/sequence_range.hpp>
+#include <jank/runtime/detail/fork_join_pool.hpp>
 #include <jank/util/fmt/print.hpp>
 
 namespace jank::runtime
@@ -102,6 +108,7 @@ namespace jank::runtime
   {
     return (o.get_type() == object_type::persistent_hash_map
             || o.get_type() == object_type::persistent_array_map
+            || o.get_type() == object_type::persistent_shape_map
             || o.get_type() == object_type::persistent_sorted_map);
   }
 
@@ -465,6 +472,27 @@ namespace jank::runtime
       m);
   }
 
+  object_ref keyword_get(object_ref const kw, detail::shape_slot_cache &cache, object_ref const m)
+  {
+    if(m.get_type() == object_type::persistent_shape_map)
+    {
+      return expect_object<obj::persistent_shape_map>(m)->get(kw, cache, jank_nil);
+    }
+    return get(m, kw);
+  }
+
+  object_ref keyword_get(object_ref const kw,
+                         detail::shape_slot_cache &cache,
+                         object_ref const m,
+                         object_ref const fallback)
+  {
+    if(m.get_type() == object_type::persistent_shape_map)
+    {
+      return expect_object<obj::persistent_shape_map>(m)->get(kw, cache, fallback);
+    }
+    return get(m, kw, fallback);
+  }
+
   object_ref get_in(object_ref const m, object_ref const keys)
   {
     if(m.has_behavior(object_behavior::get))
@@ -809,6 +837,22 @@ namespace jank::runtime
     return buff.release();
   }
 
+  obj::string_rope_ref string_rope(object_ref const args)
+  {
+    static obj::string_rope const empty;
+    return obj::string_rope_ref{ &empty }->append(args);
+  }
+
+  bool is_string_rope(object_ref const o)
+  {
+    return o.get_type() == object_type::string_rope;
+  }
+
+  obj::string_rope_ref rope_append(object_ref const o, object_ref const args)
+  {
+    return try_object<obj::string_rope>(o)->append(args);
+  }
+
   obj::persistent_list_ref list(object_ref const s)
   {
     return obj::persistent_list::create(s);
@@ -819,6 +863,18 @@ namespace jank::runtime
     return obj::persistent_vector::create(s);
   }
 
+  obj::persistent_hash_map_ref zipmap(object_ref const keys, object_ref const vals)
+  {
+    runtime::detail::native_transient_hash_map trans;
+    auto const ks{ make_sequence_range(keys) };
+    auto const vs{ make_sequence_range(vals) };
+    for(auto k{ ks.begin() }, v{ vs.begin() }; k != ks.end() && v != vs.end(); ++k, ++v)
+    {
+      trans.set(*k, *v);
+    }
+    return make_box<obj::persistent_hash_map>(trans.persistent());
+  }
+
   usize sequence_length(object_ref const s)
   {
     return sequence_length(s, std::numeric_limits<size_t>::max());
@@ -892,19 +948,239 @@ namespace jank::runtime
     return r_it == r_range.end();
   }
 
+  object_ref reduce(object_ref const f, object_ref const s)
+  {
+    /* As with Clojure's reducers, a folder reduced without an init starts with (f). */
+    if(s.get_type() == object_type::folder)
+    {
+      return reduce(f, f.call(), s);
+    }
+
+    auto const head{ runtime::seq(s) };
+    if(head.is_nil())
+    {
+      return f.call();
+    }
+    return reduce(f, runtime::first(head), runtime::next(head));
+  }
+
   object_ref reduce(object_ref const f, object_ref const init, object_ref const s)
   {
-    object_ref res{ init };
-    for(auto const &e : make_sequence_range(s))
+    if(s.get_type() == object_type::folder)
     {
-      res = f.call(res, e);
-      if(res.get_type() == object_type::reduced)
-      {
-        res = expect_object<obj::reduced>(res)->val;
-        break;
-      }
+      auto const typed_s{ expect_object<obj::folder>(s) };
+      return reduce(typed_s->xform.call(f), init, typed_s->coll);
+    }
+    if(s.is_nil())
+    {
+      return init;
+    }
+
+    return visit_object(
+      [=](auto const typed_s) -> object_ref {
+        using T = typename jtl::decay_t<decltype(typed_s)>::value_type;
+
+        if constexpr(behavior::reducible<T>)
+        {
+          return typed_s->reduce(f, init);
+        }
+        else
+        {
+          object_ref res{ init };
+          for(auto const &e : make_sequence_range(typed_s))
+          {
+            res = f.call(res, e);
+            if(res.get_type() == object_type::reduced)
+            {
+              res = expect_object<obj::reduced>(res)->val;
+              break;
+            }
+          }
+          return res;
+        }
+      },
+      s);
+  }
+
+  object_ref reduce_kv(object_ref const f, object_ref const init, object_ref const coll)
+  {
+    if(coll.is_nil())
+    {
+      return init;
+    }
+
+    return visit_object(
+      [=](auto const typed_coll) -> object_ref {
+        using T = typename jtl::decay_t<decltype(typed_coll)>::value_type;
+
+        if constexpr(behavior::kv_reducible<T>)
+        {
+          return typed_coll->kv_reduce(f, init);
+        }
+        else
+        {
+          /* Anything else, such as a seq of map entries, takes the slow path. */
+          object_ref res{ init };
+          for(auto const &e : make_sequence_range(typed_coll))
+          {
+            res = f.call(res, runtime::first(e), runtime::second(e));
+            if(res.get_type() == object_type::reduced)
+            {
+              res = expect_object<obj::reduced>(res)->val;
+              break;
+            }
+          }
+          return res;
+        }
+      },
+      coll);
+  }
+
+  object_ref folder(object_ref const coll, object_ref const xform)
+  {
+    return make_box<obj::folder>(coll, xform);
+  }
+
+  /* Folds [start, end) by splitting it in half until each piece is no bigger than n. The
+   * right half is forked onto the pool while this thread carries on with the left half. Each
+   * piece is reduced with its own (combinef) as the initial value and then the halves are
+   * combined with (combinef left right). */
+  template <typename R>
+  static object_ref fold_range(usize const n,
+                               object_ref const combinef,
+                               R const &reduce_range,
+                               usize const start,
+                               usize const end)
+  {
+    if(end - start <= n)
+    {
+      return reduce_range(combinef.call(), start, end);
+    }
+
+    auto &pool{ detail::fork_join_pool::instance() };
+    auto const mid{ start + ((end - start) / 2) };
+    object_ref right;
+    detail::fork_join_pool::job right_job{
+      [&]() { right = fold_range(n, combinef, reduce_range, mid, end); }
+    };
+    pool.fork(right_job);
+
+    object_ref left;
+    try
+    {
+      left = fold_range(n, combinef, reduce_range, start, mid);
+    }
+    catch(...)
+    {
+      /* The job lives on our stack, so we can't leave until it's done. */
+      pool.wait(right_job);
+      throw;
+    }
+    pool.join(right_job);
+
+    return combinef.call(left, right);
+  }
+
+  static object_ref fold_vector(usize const n,
+                                object_ref const combinef,
+                                object_ref const reducef,
+                                obj::persistent_vector_ref const v)
+  {
+    auto const &data{ v->data };
+    return fold_range(
+      n,
+      combinef,
+      [&](object_ref const init, usize const start, usize const end) {
+        object_ref res{ init };
+        /* Walking leaf by leaf avoids a tree lookup per element. */
+        immer::for_each_chunk_p(data.begin() + static_cast<isize>(start),
+                                data.begin() + static_cast<isize>(end),
+                                [&](auto const first, auto const last) {
+                                  for(auto it{ first }; it != last; ++it)
+                                  {
+                                    res = reducef.call(res, *it);
+                                    if(res.get_type() == object_type::reduced)
+                                    {
+                                      res = expect_object<obj::reduced>(res)->val;
+                                      return false;
+                                    }
+                                  }
+                                  return true;
+                                });
+        return res;
+      },
+      0,
+      data.size());
+  }
+
+  static object_ref fold_hash_map(usize const n,
+                                  object_ref const combinef,
+                                  object_ref const reducef,
+                                  obj::persistent_hash_map_ref const m)
+  {
+    /* immer doesn't give us a way to split a map into subtrees, so we gather pointers to the
+     * entries first. That pass is cheap compared to calling reducef for each entry and it
+     * gives us balanced pieces no matter how the hashes are distributed. */
+    native_vector<std::pair<object_ref, object_ref> const *> entries;
+    entries.reserve(m->data.size());
+    for(auto const &entry : m->data)
+    {
+      entries.emplace_back(&entry);
+    }
+
+    return fold_range(
+      n,
+      combinef,
+      [&](object_ref const init, usize const start, usize const end) {
+        object_ref res{ init };
+        for(auto i{ start }; i < end; ++i)
+        {
+          res = reducef.call(res, entries[i]->first, entries[i]->second);
+          if(res.get_type() == object_type::reduced)
+          {
+            return expect_object<obj::reduced>(res)->val;
+          }
+        }
+        return res;
+      },
+      0,
+      entries.size());
+  }
+
+  object_ref fold(object_ref const n,
+                  object_ref const combinef,
+                  object_ref const reducef,
+                  object_ref const coll)
+  {
+    auto const chunk_size{ std::max<i64>(to_int(n), 1) };
+
+    switch(coll.get_type())
+    {
+      case object_type::nil:
+        return combinef.call();
+      case object_type::folder:
+        {
+          auto const typed_coll{ expect_object<obj::folder>(coll) };
+          return fold(n, combinef, typed_coll->xform.call(reducef), typed_coll->coll);
+        }
+      case object_type::persistent_vector:
+        return fold_vector(static_cast<usize>(chunk_size),
+                           combinef,
+                           reducef,
+                           expect_object<obj::persistent_vector>(coll));
+      case object_type::persistent_hash_map:
+        return fold_hash_map(static_cast<usize>(chunk_size),
+                             combinef,
+                             reducef,
+                             expect_object<obj::persistent_hash_map>(coll));
+      /* As with Clojure, other maps are reduced with their keys and values. */
+      case object_type::persistent_array_map:
+      case object_type::persistent_shape_map:
+      case object_type::persistent_sorted_map:
+        return reduce_kv(reducef, combinef.call(), coll);
+      default:
+        return reduce(reducef, combinef.call(), coll);
     }
-    return res;
   }
 
   object_ref reduced(object_ref const o)
@@ -1029,40 +1305,276 @@ namespace jank::runtime
     return obj::repeat::create(n, val);
   }
 
-  object_ref sort(object_ref const coll)
+  /* Below this, sorting in one go is quicker than forking. */
+  static constexpr usize parallel_sort_threshold{ 1 << 15 };
+  /* Below this, the counting passes of a radix sort cost more than they save. */
+  static constexpr usize radix_sort_threshold{ 256 };
+
+  /* A stable merge sort which sorts each half on the fork/join pool and then merges them.
+   * This is only used for orderings which don't call back into jank, since user comparators
+   * may well depend on thread bindings. */
+  template <typename It, typename Less>
+  static void parallel_stable_sort(It const begin, It const end, Less const &less)
   {
-    if(coll.is_nil())
+    auto const size{ static_cast<usize>(end - begin) };
+    auto &pool{ detail::fork_join_pool::instance() };
+    if(size <= parallel_sort_threshold || pool.worker_count() < 2)
     {
-      return obj::persistent_list::empty();
+      std::stable_sort(begin, end, less);
+      return;
     }
 
-    return visit_seqable(
-      [](auto const typed_coll) -> object_ref {
-        native_vector<object_ref> vec;
-        for(auto const e : make_sequence_range(typed_coll))
-        {
-          vec.push_back(e);
-        }
+    auto const mid{ begin + static_cast<isize>(size / 2) };
+    detail::fork_join_pool::job right_job{ [&]() { parallel_stable_sort(mid, end, less); } };
+    pool.fork(right_job);
+
+    try
+    {
+      parallel_stable_sort(begin, mid, less);
+    }
+    catch(...)
+    {
+      /* The job lives on our stack, so we can't leave until it's done. */
+      pool.wait(right_job);
+      throw;
+    }
+    pool.join(right_job);
+
+    std::inplace_merge(begin, mid, end, less);
+  }
+
+  /* An LSD radix sort, a byte at a time. Flipping the sign bit makes the unsigned order
+   * match the signed order. Each pass is stable, so the whole sort is. Passes where every
+   * key has the same byte are skipped, which makes small ranges of keys cheap. */
+  static void radix_sort(native_vector<std::pair<u64, object_ref>> &decorated)
+  {
+    static constexpr u64 sign_bit{ u64{ 1 } << 63 };
+    for(auto &e : decorated)
+    {
+      e.first ^= sign_bit;
+    }
+
+    native_vector<std::pair<u64, object_ref>> scratch(decorated.size());
+    for(usize shift{}; shift < 64; shift += 8)
+    {
+      std::array<usize, 256> counts{};
+      for(auto const &e : decorated)
+      {
+        ++counts[(e.first >> shift) & 0xff];
+      }
+      if(counts[(decorated[0].first >> shift) & 0xff] == decorated.size())
+      {
+        continue;
+      }
+
+      usize offset{};
+      for(auto &count : counts)
+      {
+        auto const n{ count };
+        count = offset;
+        offset += n;
+      }
+      for(auto const &e : decorated)
+      {
+        scratch[counts[(e.first >> shift) & 0xff]++] = e;
+      }
+      std::swap(decorated, scratch);
+    }
+  }
+
+  template <typename K, typename Less>
+  static void sort_by_keys(native_vector<object_ref> &vals,
+                           native_vector<K> const &keys,
+                           Less const &less)
+  {
+    native_vector<std::pair<K, object_ref>> decorated;
+    decorated.reserve(vals.size());
+    for(usize i{}; i < vals.size(); ++i)
+    {
+      decorated.emplace_back(keys[i], vals[i]);
+    }
+
+    parallel_stable_sort(
+      decorated.begin(),
+      decorated.end(),
+      [&](std::pair<K, object_ref> const &l, std::pair<K, object_ref> const &r) {
+        return less(l.first, r.first);
+      });
+
+    for(usize i{}; i < vals.size(); ++i)
+    {
+      vals[i] = decorated[i].second;
+    }
+  }
+
+  /* Sorts `vals` by `compare` on the corresponding `keys`. When every key has the same type,
+   * and it's one we know, we pull the keys out once and sort on those directly, rather than
+   * going through `compare` for every comparison. For a plain `sort`, `keys` and `vals`
+   * are the same vector. */
+  static void sort_by_compare(native_vector<object_ref> &vals,
+                              native_vector<object_ref> const &keys)
+  {
+    if(keys.size() < 2)
+    {
+      return;
+    }
 
-        std::stable_sort(vec.begin(), vec.end(), [](object_ref const a, object_ref const b) {
-          return runtime::compare(a, b) < 0;
+    auto const integer_type{ [](object_type const t) {
+      return t == object_type::small_integer || t == object_type::integer;
+    } };
+    auto const real_type{ [](object_type const t) {
+      return t == object_type::small_real || t == object_type::real;
+    } };
+
+    auto const first_type{ keys[0].get_type() };
+    auto homogeneous{ true };
+    for(auto const k : keys)
+    {
+      auto const t{ k.get_type() };
+      if(t != first_type
+         && !(integer_type(t) && integer_type(first_type))
+         && !(real_type(t) && real_type(first_type)))
+      {
+        homogeneous = false;
+        break;
+      }
+    }
+
+    if(homogeneous && integer_type(first_type))
+    {
+      native_vector<std::pair<u64, object_ref>> decorated;
+      decorated.reserve(vals.size());
+      for(usize i{}; i < vals.size(); ++i)
+      {
+        decorated.emplace_back(static_cast<u64>(keys[i].to_integer()), vals[i]);
+      }
+
+      if(decorated.size() < radix_sort_threshold)
+      {
+        std::stable_sort(decorated.begin(),
+                         decorated.end(),
+                         [](std::pair<u64, object_ref> const &l,
+                            std::pair<u64, object_ref> const &r) {
+                           return static_cast<i64>(l.first) < static_cast<i64>(r.first);
+                         });
+      }
+      else
+      {
+        radix_sort(decorated);
+      }
+
+      for(usize i{}; i < vals.size(); ++i)
+      {
+        vals[i] = decorated[i].second;
+      }
+    }
+    else if(homogeneous && real_type(first_type))
+    {
+      native_vector<f64> reals;
+      reals.reserve(keys.size());
+      for(auto const k : keys)
+      {
+        reals.push_back(k.to_real());
+      }
+      sort_by_keys(vals, reals, [](f64 const l, f64 const r) { return l < r; });
+    }
+    else if(homogeneous && first_type == object_type::persistent_string)
+    {
+      native_vector<obj::persistent_string *> strings;
+      strings.reserve(keys.size());
+      for(auto const k : keys)
+      {
+        strings.push_back(expect_object<obj::persistent_string>(k).ptr());
+      }
+      sort_by_keys(vals,
+                   strings,
+                   [](obj::persistent_string const * const l,
+                      obj::persistent_string const * const r) {
+                     return l->data.compare(r->data) < 0;
+                   });
+    }
+    else if(homogeneous && first_type == object_type::keyword)
+    {
+      native_vector<obj::keyword *> keywords;
+      keywords.reserve(keys.size());
+      for(auto const k : keys)
+      {
+        keywords.push_back(expect_object<obj::keyword>(k).ptr());
+      }
+      sort_by_keys(
+        vals,
+        keywords,
+        [](obj::keyword const * const l, obj::keyword const * const r) {
+          return l->compare(*r) < 0;
         });
+    }
+    else if(&vals == &keys)
+    {
+      parallel_stable_sort(vals.begin(), vals.end(), [](object_ref const l, object_ref const r) {
+        return runtime::compare(l, r) < 0;
+      });
+    }
+    else
+    {
+      sort_by_keys(vals, keys, [](object_ref const l, object_ref const r) {
+        return runtime::compare(l, r) < 0;
+      });
+    }
+  }
 
-        using T = typename jtl::decay_t<decltype(typed_coll)>::value_type;
+  /* Sorts `vals` by calling `comp` on the corresponding `keys`. The result is coerced
+   * as clojure.lang.AFunction/compare would. */
+  static void sort_by_comparator(object_ref const comp,
+                                 native_vector<object_ref> &vals,
+                                 native_vector<object_ref> const &keys)
+  {
+    auto const less{ [=](object_ref const a, object_ref const b) {
+      auto const o(comp.call(a, b));
 
-        if constexpr(behavior::metadatable<T>)
-        {
-          return make_box<obj::native_vector_sequence>(typed_coll->get_meta(), std::move(vec));
-        }
-        else
-        {
-          return make_box<obj::native_vector_sequence>(std::move(vec));
-        }
-      },
-      coll);
+      if(o == jank_true)
+      {
+        return true;
+      }
+      else if(o == jank_false)
+      {
+        return false;
+      }
+      else
+      {
+        return to_int(o) < 0;
+      }
+    } };
+
+    if(&vals == &keys)
+    {
+      std::stable_sort(vals.begin(), vals.end(), less);
+      return;
+    }
+
+    native_vector<std::pair<object_ref, object_ref>> decorated;
+    decorated.reserve(vals.size());
+    for(usize i{}; i < vals.size(); ++i)
+    {
+      decorated.emplace_back(keys[i], vals[i]);
+    }
+
+    std::stable_sort(decorated.begin(),
+                     decorated.end(),
+                     [&](std::pair<object_ref, object_ref> const &l,
+                         std::pair<object_ref, object_ref> const &r) {
+                       return less(l.first, r.first);
+                     });
+
+    for(usize i{}; i < vals.size(); ++i)
+    {
+      vals[i] = decorated[i].second;
+    }
   }
 
-  object_ref sort(object_ref const comp, object_ref const coll)
+  /* Pulls `coll` into a vector, hands it to `sort_fn`, and wraps the result back up in
+   * a sequence which keeps the collection's meta. */
+  template <typename F>
+  static object_ref sort_seqable(object_ref const coll, F const &sort_fn)
   {
     if(coll.is_nil())
     {
@@ -1070,30 +1582,14 @@ namespace jank::runtime
     }
 
     return visit_seqable(
-      [=](auto const typed_coll) -> object_ref {
+      [&](auto const typed_coll) -> object_ref {
         native_vector<object_ref> vec;
         for(auto const e : make_sequence_range(typed_coll))
         {
           vec.push_back(e);
         }
 
-        std::stable_sort(vec.begin(), vec.end(), [=](object_ref const a, object_ref const b) {
-          auto const o(comp.call(a, b));
-
-          // coerce output as clojure.lang.AFunction/compare would
-          if(o == jank_true)
-          {
-            return true;
-          }
-          else if(o == jank_false)
-          {
-            return false;
-          }
-          else
-          {
-            return to_int(o) < 0;
-          }
-        });
+        sort_fn(vec);
 
         using T = typename jtl::decay_t<decltype(typed_coll)>::value_type;
 
@@ -1109,6 +1605,46 @@ namespace jank::runtime
       coll);
   }
 
+  /* Calls `keyfn` once per element, up front, rather than twice per comparison. The keys
+   * are kept in their own vector, so the GC can see them for the whole sort. */
+  static native_vector<object_ref>
+  sort_keys(object_ref const keyfn, native_vector<object_ref> const &vals)
+  {
+    native_vector<object_ref> keys;
+    keys.reserve(vals.size());
+    for(auto const v : vals)
+    {
+      keys.push_back(keyfn.call(v));
+    }
+    return keys;
+  }
+
+  object_ref sort(object_ref const coll)
+  {
+    return sort_seqable(coll, [](native_vector<object_ref> &vec) { sort_by_compare(vec, vec); });
+  }
+
+  object_ref sort(object_ref const comp, object_ref const coll)
+  {
+    return sort_seqable(coll, [=](native_vector<object_ref> &vec) {
+      sort_by_comparator(comp, vec, vec);
+    });
+  }
+
+  object_ref sort_by(object_ref const keyfn, object_ref const coll)
+  {
+    return sort_seqable(coll, [=](native_vector<object_ref> &vec) {
+      sort_by_compare(vec, sort_keys(keyfn, vec));
+    });
+  }
+
+  object_ref sort_by(object_ref const keyfn, object_ref const comp, object_ref const coll)
+  {
+    return sort_seqable(coll, [=](native_vector<object_ref> &vec) {
+      sort_by_comparator(comp, vec, sort_keys(keyfn, vec));
+    });
+  }
+
   object_ref shuffle(object_ref const coll)
   {
     return visit_seqable(
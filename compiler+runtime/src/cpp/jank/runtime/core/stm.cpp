@@ -0,0 +1,139 @@
+#include <jank/runtime/core/stm.hpp>
+#include <jank/runtime/core/call.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/obj/ref.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/detail/transaction.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime
+{
+  static obj::ref_ref expect_ref(object_ref const o, char const * const fn)
+  {
+    if(o.get_type() != object_type::ref)
+    {
+      throw std::runtime_error{ util::format("The `{}` function expects a ref, not a `{}`.",
+                                             fn,
+                                             object_type_str(o.get_type())) };
+    }
+    return expect_object<obj::ref>(o);
+  }
+
+  static detail::transaction &expect_transaction()
+  {
+    auto const tx{ detail::transaction::current() };
+    if(!tx)
+    {
+      throw std::runtime_error{ "No transaction running." };
+    }
+    return *tx;
+  }
+
+  static usize expect_history(object_ref const n)
+  {
+    auto const size{ to_int(n) };
+    if(size < 0)
+    {
+      throw std::runtime_error{ util::format("A ref's history can't be negative: {}", size) };
+    }
+    return static_cast<usize>(size);
+  }
+
+  obj::ref_ref ref(object_ref const o)
+  {
+    return make_box<obj::ref>(o);
+  }
+
+  bool is_ref(object_ref const o)
+  {
+    return o.get_type() == object_type::ref;
+  }
+
+  object_ref run_in_transaction(object_ref const fn)
+  {
+    return detail::transaction::run_in_transaction(fn);
+  }
+
+  bool is_transaction_running()
+  {
+    return detail::transaction::current() != nullptr;
+  }
+
+  object_ref ref_alter(object_ref const r, object_ref const fn, object_ref const args)
+  {
+    auto const typed_r{ expect_ref(r, "alter") };
+    auto &tx{ expect_transaction() };
+    auto const val{ tx.get(typed_r.data) };
+    return tx.set(typed_r.data, args.is_nil() ? fn.call(val) : apply_to(fn, val, args));
+  }
+
+  object_ref ref_commute(object_ref const r, object_ref const fn, object_ref const args)
+  {
+    auto const typed_r{ expect_ref(r, "commute") };
+    return expect_transaction().commute(typed_r.data, fn, args);
+  }
+
+  object_ref ref_set(object_ref const r, object_ref const val)
+  {
+    auto const typed_r{ expect_ref(r, "ref-set") };
+    return expect_transaction().set(typed_r.data, val);
+  }
+
+  object_ref ref_ensure(object_ref const r)
+  {
+    auto const typed_r{ expect_ref(r, "ensure") };
+    auto &tx{ expect_transaction() };
+    tx.ensure(typed_r.data);
+    return tx.get(typed_r.data);
+  }
+
+  i64 ref_history_count(object_ref const r)
+  {
+    return static_cast<i64>(expect_ref(r, "ref-history-count")->history_count());
+  }
+
+  i64 get_ref_min_history(object_ref const r)
+  {
+    return static_cast<i64>(expect_ref(r, "ref-min-history")->min_history.load());
+  }
+
+  object_ref set_ref_min_history(object_ref const r, object_ref const n)
+  {
+    expect_ref(r, "ref-min-history")->min_history.store(expect_history(n));
+    return r;
+  }
+
+  i64 get_ref_max_history(object_ref const r)
+  {
+    return static_cast<i64>(expect_ref(r, "ref-max-history")->max_history.load());
+  }
+
+  object_ref set_ref_max_history(object_ref const r, object_ref const n)
+  {
+    expect_ref(r, "ref-max-history")->max_history.store(expect_history(n));
+    return r;
+  }
+
+  object_ref transaction_stats()
+  {
+    auto const &stats{ detail::transaction::stats() };
+    auto const kw{ [](char const * const name) {
+      return __rt_ctx->intern_keyword(name).expect_ok();
+    } };
+    auto const count{ [](std::atomic<u64> const &n) {
+      return make_box(static_cast<i64>(n.load()));
+    } };
+    return obj::persistent_array_map::create_unique(kw("commits"),
+                                                    count(stats.commits),
+                                                    kw("retries"),
+                                                    count(stats.retries),
+                                                    kw("barges"),
+                                                    count(stats.barges),
+                                                    kw("faults"),
+                                                    count(stats.faults),
+                                                    kw("lock-timeouts"),
+                                                    count(stats.lock_timeouts));
+  }
+}
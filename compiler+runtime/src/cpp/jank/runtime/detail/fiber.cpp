@@ -0,0 +1,360 @@
+/* ucontext is deprecated on macOS, but it's still there if we ask for it. */
+#ifdef __APPLE__
+  #define _XOPEN_SOURCE 600
+  #define _DARWIN_C_SOURCE
+#endif
+
+#include <utility>
+
+#include <jank/runtime/detail/fiber.hpp>
+
+#ifndef JANK_WINDOWS_LIKE
+  #include <sys/mman.h>
+  #include <ucontext.h>
+  #include <unistd.h>
+
+  #include <cxxabi.h>
+#endif
+
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/gc.hpp>
+#include <jank/util/try.hpp>
+
+#include <gc/gc_mark.h>
+
+namespace jank::runtime::detail
+{
+  static thread_local fiber *current_fiber{};
+  static thread_local usize pin_depth{};
+
+  fiber::pin_scope::pin_scope()
+  {
+    ++pin_depth;
+  }
+
+  fiber::pin_scope::~pin_scope()
+  {
+    --pin_depth;
+  }
+
+  fiber *fiber::current()
+  {
+    return pin_depth == 0 ? current_fiber : nullptr;
+  }
+
+#ifdef JANK_WINDOWS_LIKE
+  /* TODO: Fibers on Windows. Until then, go blocks run as plain tasks and never park. */
+  struct fiber_context
+  {
+  };
+
+  fiber::fiber(object_ref const fn)
+    : fn{ fn }
+  {
+  }
+
+  void fiber::spawn(object_ref const fn)
+  {
+    task_pool::instance().submit(fn);
+  }
+
+  object_ref fiber::park()
+  {
+    throw std::runtime_error{ "Fibers aren't supported on this platform." };
+  }
+
+  void fiber::wake(object_ref const)
+  {
+  }
+
+  void fiber::resume()
+  {
+  }
+#else
+  /* Stacks are only committed as they're touched, so this is mostly address space. */
+  static constexpr usize stack_size{ 1024 * 1024 };
+
+  /* The C++ runtime keeps track of caught and uncaught exceptions for each thread. A fiber
+   * which parks within a catch needs to take its caught exception along with it. */
+  struct eh_globals
+  {
+    void *caught{};
+    unsigned int uncaught{};
+  };
+
+  struct fiber_context
+  {
+    ucontext_t own{};
+    /* Where the fiber goes back to when it parks or finishes. */
+    ucontext_t caller{};
+    /* The guard page comes first, then the stack. */
+    char *mapping{};
+    usize mapping_size{};
+    /* Whichever stack the GC won't see on its own, which is the fiber's stack while it's
+     * parked and the worker's stack while the fiber is running on it. */
+    void *scan_lo{};
+    void *scan_hi{};
+    /* The GC's record of the worker's stack, which it has to be told about whenever we
+     * switch stacks. */
+    void *worker_handle{};
+    GC_stack_base worker_stack{};
+    native_list<thread_binding_frame> worker_bindings;
+    eh_globals eh;
+    /* Every fiber which has started, but not yet finished, is linked together, so that the GC
+     * can scan their stacks. Only changed while holding the GC's lock. */
+    fiber *prev{};
+    fiber *next{};
+  };
+
+  struct fiber_registry
+  {
+    fiber *head{};
+  };
+
+  static GC_push_other_roots_proc previous_push_other_roots{};
+
+  /* Called by the GC, while it's holding its lock. */
+  static void GC_CALLBACK push_fiber_stacks();
+
+  static fiber_registry &registry()
+  {
+    /* This is uncollectable, so the GC scans it and keeps every live fiber alive. */
+    static auto * const ret{ []() {
+      previous_push_other_roots = GC_get_push_other_roots();
+      GC_set_push_other_roots(push_fiber_stacks);
+      return new(NoGC) fiber_registry{};
+    }() };
+    return *ret;
+  }
+
+  static void GC_CALLBACK push_fiber_stacks()
+  {
+    if(previous_push_other_roots)
+    {
+      previous_push_other_roots();
+    }
+    for(auto f{ registry().head }; f != nullptr; f = f->ctx->next)
+    {
+      if(f->ctx->scan_lo)
+      {
+        GC_push_all_eager(f->ctx->scan_lo, f->ctx->scan_hi);
+      }
+    }
+  }
+
+  /* Everything below this in the stack is unused, at least by the caller. */
+  [[gnu::noinline]]
+  static void *approx_sp()
+  {
+    char volatile marker{};
+    return const_cast<char *>(&marker);
+  }
+
+  /* This is a separate function so that the thread's globals aren't cached from before a
+   * switch, since the fiber may come back on another thread. */
+  [[gnu::noinline]]
+  static void swap_eh_globals(eh_globals &saved)
+  {
+    auto &globals{ *reinterpret_cast<eh_globals *>(abi::__cxa_get_globals()) };
+    std::swap(globals, saved);
+  }
+
+  static char *stack_top(fiber_context const &c)
+  {
+    return c.mapping + c.mapping_size;
+  }
+
+  /* Switching stacks happens while holding the GC's lock, so that a collection can't find the
+   * thread in between two stacks. The lock is released by whichever side we switch to. */
+  static void switch_to_fiber(fiber_context &c)
+  {
+    GC_alloc_lock();
+    c.scan_lo = approx_sp();
+    c.scan_hi = c.worker_stack.mem_base;
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      GC_stack_base const sb{ stack_top(c) };
+      GC_set_stackbottom(c.worker_handle, &sb);
+    }
+    swapcontext(&c.caller, &c.own);
+    GC_alloc_unlock();
+  }
+
+  static void switch_to_worker(fiber_context &c)
+  {
+    GC_alloc_lock();
+    c.scan_lo = approx_sp();
+    c.scan_hi = stack_top(c);
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      GC_set_stackbottom(c.worker_handle, &c.worker_stack);
+    }
+    swapcontext(&c.own, &c.caller);
+    GC_alloc_unlock();
+  }
+
+  static void run_fiber()
+  {
+    /* We got here from `switch_to_fiber`, which left the lock for us to release. */
+    GC_alloc_unlock();
+
+    /* Nothing is waiting on the fn itself. Go blocks report their result through a channel,
+     * so the best we can do with an exception is report it, like the task pool does. */
+    auto const f{ current_fiber };
+    try
+    {
+      f->fn.call();
+    }
+    catch(object_ref const o)
+    {
+      util::print_exception(o);
+    }
+    catch(std::exception const &e)
+    {
+      util::print_exception(e);
+    }
+    catch(...)
+    {
+      util::print_current_exception();
+    }
+
+    /* This stack is about to be unmapped, so it's dropped from the GC's view for good. */
+    auto &c{ *f->ctx };
+    f->fn = jank_nil;
+    f->st.store(fiber::state::done, std::memory_order_release);
+    GC_alloc_lock();
+    if(c.prev)
+    {
+      c.prev->ctx->next = c.next;
+    }
+    else
+    {
+      registry().head = c.next;
+    }
+    if(c.next)
+    {
+      c.next->ctx->prev = c.prev;
+    }
+    c.scan_lo = nullptr;
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      GC_set_stackbottom(c.worker_handle, &c.worker_stack);
+    }
+    setcontext(&c.caller);
+  }
+
+  fiber::fiber(object_ref const fn)
+    : fn{ fn }
+    , ctx{ new(UseGC) fiber_context{} }
+  {
+    auto const page{ static_cast<usize>(sysconf(_SC_PAGESIZE)) };
+    ctx->mapping_size = stack_size + page;
+    auto const mapping{
+      mmap(nullptr, ctx->mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+    };
+    if(mapping == MAP_FAILED)
+    {
+      throw std::runtime_error{ "Unable to allocate a stack for a fiber." };
+    }
+    ctx->mapping = static_cast<char *>(mapping);
+    /* Running off the end of the stack faults, rather than corrupting whatever is next. */
+    mprotect(ctx->mapping, page, PROT_NONE);
+
+    getcontext(&ctx->own);
+    ctx->own.uc_stack.ss_sp = ctx->mapping + page;
+    ctx->own.uc_stack.ss_size = stack_size;
+    ctx->own.uc_link = nullptr;
+    makecontext(&ctx->own, run_fiber, 0);
+
+    auto &reg{ registry() };
+    GC_alloc_lock();
+    ctx->next = reg.head;
+    if(reg.head)
+    {
+      reg.head->ctx->prev = this;
+    }
+    reg.head = this;
+    GC_alloc_unlock();
+  }
+
+  void fiber::spawn(object_ref const fn)
+  {
+    task_pool::instance().submit(new fiber{ fn });
+  }
+
+  object_ref fiber::park()
+  {
+    /* If we've already been woken, there's no need to leave. */
+    auto expected{ state::woken };
+    if(!st.compare_exchange_strong(expected, state::running, std::memory_order_acquire))
+    {
+      switch_to_worker(*ctx);
+    }
+    auto const ret{ result };
+    result = jank_nil;
+    return ret;
+  }
+
+  void fiber::wake(object_ref const r)
+  {
+    result = r;
+    if(st.exchange(state::woken, std::memory_order_acq_rel) == state::parked)
+    {
+      task_pool::instance().submit(this);
+    }
+  }
+
+  void fiber::resume()
+  {
+    auto &c{ *ctx };
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      c.worker_handle = GC_get_my_stackbottom(&c.worker_stack);
+    }
+    else
+    {
+      /* The GC doesn't know about our workers on macOS, so there's nothing to tell it. We
+       * still need a bound for scanning, though. */
+      c.worker_stack.mem_base = approx_sp();
+    }
+
+    while(true)
+    {
+      /* The fiber's thread state goes in and the worker's comes out, then the reverse once
+       * the fiber is back. */
+      c.worker_bindings = __rt_ctx->take_thread_bindings();
+      __rt_ctx->restore_thread_bindings(jtl::move(bindings));
+      swap_eh_globals(c.eh);
+      current_fiber = this;
+      st.store(state::running, std::memory_order_relaxed);
+
+      switch_to_fiber(c);
+
+      current_fiber = nullptr;
+      swap_eh_globals(c.eh);
+      if(st.load(std::memory_order_acquire) == state::done)
+      {
+        __rt_ctx->take_thread_bindings();
+        __rt_ctx->restore_thread_bindings(jtl::move(c.worker_bindings));
+        munmap(c.mapping, c.mapping_size);
+        c.mapping = nullptr;
+        return;
+      }
+      bindings = __rt_ctx->take_thread_bindings();
+      __rt_ctx->restore_thread_bindings(jtl::move(c.worker_bindings));
+
+      /* Once it's marked as parked, a wake can resume it on another worker, so we must be
+       * done with it by then. If the wake has already come in, we carry on with it here. */
+      auto expected{ state::running };
+      if(st.compare_exchange_strong(expected,
+                                    state::parked,
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
+      {
+        return;
+      }
+    }
+  }
+#endif
+}
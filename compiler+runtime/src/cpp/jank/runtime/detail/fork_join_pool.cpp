@@ -0,0 +1,191 @@
+#include <algorithm>
+
+#include <jank/runtime/detail/fork_join_pool.hpp>
+#include <jank/gc.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::runtime::detail
+{
+  /* Workers know their own index, so they can use their own deque. Any other thread is
+   * treated as an outsider and uses the shared deque. */
+  static thread_local fork_join_pool const *current_pool{};
+  static thread_local usize current_worker{};
+
+  fork_join_pool::job::job(std::function<void()> &&fn)
+    : fn{ jtl::move(fn) }
+  {
+  }
+
+  fork_join_pool::fork_join_pool(usize const worker_count)
+    : queues{ std::make_unique<queue[]>(worker_count + 1) }
+  {
+    workers.reserve(worker_count);
+    for(usize i{}; i < worker_count; ++i)
+    {
+      workers.emplace_back([this, i]() { worker_loop(i); });
+    }
+  }
+
+  fork_join_pool::~fork_join_pool()
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ sleep_mutex };
+      stopping.store(true);
+    }
+    sleep_cv.notify_all();
+    for(auto &worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  fork_join_pool &fork_join_pool::instance()
+  {
+    /* This is intentionally leaked. Workers may be running jank code during static
+     * destruction, which would be a bad time to tear down the runtime from under them. */
+    static auto * const pool{ new fork_join_pool{
+      std::max<usize>(std::thread::hardware_concurrency(), 2) - 1 } };
+    return *pool;
+  }
+
+  usize fork_join_pool::worker_count() const
+  {
+    return workers.size();
+  }
+
+  void fork_join_pool::fork(job &j)
+  {
+    auto const index{ current_pool == this ? current_worker : workers.size() };
+    /* This must be counted before the job is published. Otherwise, a thief could take it
+     * and decrement the count first, which would underflow. */
+    pending.fetch_add(1);
+    {
+      auto &q{ queues[index] };
+      std::lock_guard<std::mutex> const lock{ q.mutex };
+      q.jobs.push_back(&j);
+    }
+    /* Taking the lock, even briefly, ensures a worker can't check for pending work and then
+     * go to sleep after we notify, missing this job. */
+    {
+      std::lock_guard<std::mutex> const lock{ sleep_mutex };
+    }
+    sleep_cv.notify_one();
+  }
+
+  void fork_join_pool::wait(job &j)
+  {
+    while(!j.done.load(std::memory_order_acquire))
+    {
+      if(!run_pending())
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void fork_join_pool::join(job &j)
+  {
+    wait(j);
+    if(j.error)
+    {
+      std::rethrow_exception(j.error);
+    }
+  }
+
+  void fork_join_pool::run(job &j)
+  {
+    try
+    {
+      j.fn();
+    }
+    catch(...)
+    {
+      j.error = std::current_exception();
+    }
+    j.done.store(true, std::memory_order_release);
+  }
+
+  fork_join_pool::job *fork_join_pool::find_job()
+  {
+    if(pending.load() == 0)
+    {
+      return nullptr;
+    }
+
+    auto const count{ workers.size() + 1 };
+    auto const own{ current_pool == this ? current_worker : workers.size() };
+
+    /* Our own work comes first and we take the most recent, since it's the smallest and
+     * its data is most likely to still be in cache. */
+    {
+      auto &q{ queues[own] };
+      std::lock_guard<std::mutex> const lock{ q.mutex };
+      if(!q.jobs.empty())
+      {
+        auto const j{ q.jobs.back() };
+        q.jobs.pop_back();
+        pending.fetch_sub(1);
+        return j;
+      }
+    }
+
+    /* Otherwise, we steal the oldest work from someone else. */
+    for(usize offset{ 1 }; offset < count; ++offset)
+    {
+      auto &q{ queues[(own + offset) % count] };
+      std::lock_guard<std::mutex> const lock{ q.mutex };
+      if(!q.jobs.empty())
+      {
+        auto const j{ q.jobs.front() };
+        q.jobs.pop_front();
+        pending.fetch_sub(1);
+        return j;
+      }
+    }
+
+    return nullptr;
+  }
+
+  bool fork_join_pool::run_pending()
+  {
+    auto const j{ find_job() };
+    if(!j)
+    {
+      return false;
+    }
+    run(*j);
+    return true;
+  }
+
+  void fork_join_pool::worker_loop(usize const index)
+  {
+    /* Workers run jank code, so they need to be known to the GC. See `future` for the
+     * macOS caveat. */
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      GC_stack_base sb{};
+      GC_get_stack_base(&sb);
+      GC_register_my_thread(&sb);
+    }
+    util::scope_exit const unregister{ []() {
+      if constexpr(jtl::current_platform != jtl::platform::macos_like)
+      {
+        GC_unregister_my_thread();
+      }
+    } };
+
+    current_pool = this;
+    current_worker = index;
+
+    while(!stopping.load())
+    {
+      if(run_pending())
+      {
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock{ sleep_mutex };
+      sleep_cv.wait(lock, [this]() { return stopping.load() || pending.load() != 0; });
+    }
+  }
+}
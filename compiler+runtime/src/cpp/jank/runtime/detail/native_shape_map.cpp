@@ -0,0 +1,127 @@
+#include <jank/runtime/detail/native_shape_map.hpp>
+
+namespace jank::runtime::detail
+{
+  static u32 next_shape_id()
+  {
+    /* Zero is left for empty call site caches. */
+    static std::atomic<u32> next_id{ 1 };
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  map_shape::map_shape(map_shape const * const parent, object_ref const key)
+    : id{ next_shape_id() }
+    , size{ static_cast<u8>(parent->size + 1) }
+    , keys{ new(UseGC) object_ref[size] }
+  {
+    std::copy(parent->keys, parent->keys + parent->size, keys);
+    keys[parent->size] = key;
+  }
+
+  map_shape const *map_shape::root()
+  {
+    static map_shape const * const ret{ [] {
+      auto const shape{ new map_shape{} };
+      shape->id = next_shape_id();
+      return shape;
+    }() };
+    return ret;
+  }
+
+  map_shape const *map_shape::with_key(object_ref const key) const
+  {
+    jank_debug_assert(key.get_type() == object_type::keyword);
+    jank_debug_assert(size < max_size);
+
+    {
+      auto const locked_transitions{ transitions.rlock() };
+      auto const found{ locked_transitions->find(key.raw()) };
+      if(found != locked_transitions->end())
+      {
+        return found->second;
+      }
+    }
+
+    /* Another thread may have added the same key since we checked, in which case we use
+     * theirs, so that there's only ever one shape for each list of keys. */
+    auto locked_transitions{ transitions.wlock() };
+    auto const found{ locked_transitions->find(key.raw()) };
+    if(found != locked_transitions->end())
+    {
+      return found->second;
+    }
+    auto const ret{ new map_shape{ this, key } };
+    locked_transitions->emplace(key.raw(), ret);
+    return ret;
+  }
+
+  native_shape_map::native_shape_map(map_shape const * const shape, object_ref * const values)
+    : shape{ shape }
+    , values{ values }
+  {
+  }
+
+  native_shape_map::iterator::iterator(map_shape const * const shape,
+                                       object_ref const * const values,
+                                       u8 const index)
+    : shape{ shape }
+    , values{ values }
+    , index{ index }
+  {
+  }
+
+  native_shape_map::iterator::value_type native_shape_map::iterator::operator*() const
+  {
+    return { shape->keys[index], values[index] };
+  }
+
+  native_shape_map::iterator &native_shape_map::iterator::operator++()
+  {
+    ++index;
+    return *this;
+  }
+
+  bool native_shape_map::iterator::operator!=(iterator const &rhs) const
+  {
+    return values != rhs.values || index != rhs.index;
+  }
+
+  bool native_shape_map::iterator::operator==(iterator const &rhs) const
+  {
+    return !(*this != rhs);
+  }
+
+  native_shape_map::iterator &
+  native_shape_map::iterator::operator=(native_shape_map::iterator const &rhs)
+  {
+    if(this == &rhs)
+    {
+      return *this;
+    }
+
+    shape = rhs.shape;
+    values = rhs.values;
+    index = rhs.index;
+    return *this;
+  }
+
+  native_shape_map::const_iterator native_shape_map::begin() const
+  {
+    return { shape, values, 0 };
+  }
+
+  native_shape_map::const_iterator native_shape_map::end() const
+  {
+    return { shape, values, shape->size };
+  }
+
+  u8 native_shape_map::size() const
+  {
+    return shape->size;
+  }
+
+  bool native_shape_map::empty() const
+  {
+    return shape->size == 0;
+  }
+}
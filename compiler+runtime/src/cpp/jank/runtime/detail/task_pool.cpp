@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <thread>
+
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/runtime/detail/fiber.hpp>
+#include <jank/runtime/object.hpp>
+#include <jank/gc.hpp>
+#include <jank/util/scope_exit.hpp>
+#include <jank/util/try.hpp>
+
+namespace jank::runtime::detail
+{
+  /* Blocking only needs compensating for when it happens on one of our own workers. */
+  static thread_local task_pool *current_pool{};
+
+  task_pool::blocking_scope::blocking_scope()
+    : pool{ current_pool }
+  {
+    if(!pool)
+    {
+      return;
+    }
+
+    /* We count ourselves out of the pool. If that leaves it short, a spare takes our
+     * place, unless there are already as many spares as we allow. */
+    auto const now_blocked{ pool->blocked.fetch_add(1) + 1 };
+    auto const live{ pool->live.load() };
+    if(live - now_blocked < pool->target && live < pool->target + max_spares)
+    {
+      pool->spawn_worker();
+    }
+  }
+
+  task_pool::blocking_scope::~blocking_scope()
+  {
+    if(!pool)
+    {
+      return;
+    }
+
+    pool->blocked.fetch_sub(1);
+    /* There may be one worker too many now, so wake a sleeper to retire. */
+    pool->epoch.fetch_add(1);
+    pool->epoch.notify_one();
+  }
+
+  task_pool::task_pool(usize const worker_count, bool const elastic)
+    : target{ worker_count }
+    , elastic{ elastic }
+    , ring{ 4096 }
+  {
+    for(usize i{}; i < worker_count; ++i)
+    {
+      spawn_worker();
+    }
+  }
+
+  task_pool &task_pool::instance()
+  {
+    /* This is intentionally leaked, for the same reasons as the fork_join_pool. It's also
+     * uncollectable, so the GC scans it for queued tasks. */
+    static auto * const pool{ new(NoGC) task_pool{
+      std::max<usize>(std::thread::hardware_concurrency(), 2),
+      false } };
+    return *pool;
+  }
+
+  task_pool &task_pool::elastic_instance()
+  {
+    static auto * const pool{ new(NoGC) task_pool{ 0, true } };
+    return *pool;
+  }
+
+  usize task_pool::worker_count() const
+  {
+    return target;
+  }
+
+  void task_pool::submit(object_ref const fn)
+  {
+    push({ fn, {}, false });
+  }
+
+  void task_pool::submit(object_ref const fn, object_ref const arg)
+  {
+    push({ fn, arg, true });
+  }
+
+  void task_pool::submit(fiber * const f)
+  {
+    push({ {}, {}, false, f });
+  }
+
+  void task_pool::push(task const &t)
+  {
+    if(!ring.try_push(t))
+    {
+      std::lock_guard<std::mutex> const lock{ overflow_mutex };
+      overflow.push_back(t);
+      overflow_size.fetch_add(1);
+    }
+
+    /* A worker which is about to sleep has already loaded the old epoch, so it'll see
+     * this change and not sleep after all. */
+    epoch.fetch_add(1);
+    if(sleeping.load() != 0)
+    {
+      epoch.notify_one();
+    }
+    else if(elastic)
+    {
+      spawn_worker();
+    }
+  }
+
+  void task_pool::spawn_worker()
+  {
+    live.fetch_add(1);
+    std::thread{ [this]() { worker_loop(); } }.detach();
+  }
+
+  bool task_pool::try_retire()
+  {
+    auto current{ live.load() };
+    while(current - blocked.load() > target)
+    {
+      if(live.compare_exchange_weak(current, current - 1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void task_pool::run(task const &t)
+  {
+    /* Fibers handle their own exceptions. */
+    if(t.f)
+    {
+      t.f->resume();
+      return;
+    }
+
+    /* Nobody is waiting on a task to see what it threw, so the best we can do is report
+     * it and keep the worker going. */
+    try
+    {
+      if(t.has_arg)
+      {
+        t.fn.call(t.arg);
+      }
+      else
+      {
+        t.fn.call();
+      }
+    }
+    catch(object_ref const o)
+    {
+      util::print_exception(o);
+    }
+    catch(std::exception const &e)
+    {
+      util::print_exception(e);
+    }
+    catch(...)
+    {
+      util::print_current_exception();
+    }
+  }
+
+  bool task_pool::run_pending()
+  {
+    task t;
+    if(!ring.try_pop(t))
+    {
+      if(overflow_size.load() == 0)
+      {
+        return false;
+      }
+
+      std::lock_guard<std::mutex> const lock{ overflow_mutex };
+      if(overflow.empty())
+      {
+        return false;
+      }
+      t = overflow.front();
+      overflow.pop_front();
+      overflow_size.fetch_sub(1);
+    }
+    run(t);
+    return true;
+  }
+
+  void task_pool::worker_loop()
+  {
+    /* Workers run jank code, so they need to be known to the GC. See `future` for the
+     * macOS caveat. */
+    if constexpr(jtl::current_platform != jtl::platform::macos_like)
+    {
+      GC_stack_base sb{};
+      GC_get_stack_base(&sb);
+      GC_register_my_thread(&sb);
+    }
+    util::scope_exit const unregister{ []() {
+      if constexpr(jtl::current_platform != jtl::platform::macos_like)
+      {
+        GC_unregister_my_thread();
+      }
+    } };
+
+    current_pool = this;
+
+    while(true)
+    {
+      auto const seen{ epoch.load() };
+      if(run_pending())
+      {
+        /* Spares standing in for blocked workers step aside as soon as they can. Elastic
+         * workers stick around until they run dry. */
+        if(!elastic && try_retire())
+        {
+          return;
+        }
+        continue;
+      }
+      if(try_retire())
+      {
+        return;
+      }
+
+      sleeping.fetch_add(1);
+      epoch.wait(seen);
+      sleeping.fetch_sub(1);
+    }
+  }
+}
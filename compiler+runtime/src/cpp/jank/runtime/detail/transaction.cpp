@@ -0,0 +1,420 @@
+#include <random>
+#include <thread>
+
+#include <jank/runtime/detail/transaction.hpp>
+#include <jank/runtime/detail/fiber.hpp>
+#include <jank/runtime/core/call.hpp>
+#include <jank/util/scope_exit.hpp>
+
+namespace jank::runtime::detail
+{
+  namespace
+  {
+    /* Thrown to abandon the current attempt. This is never seen outside of `run`. */
+    struct retry_ex
+    {
+    };
+  }
+
+  static thread_local transaction *current_transaction{};
+  /* Every read and commit takes a new point from this clock. */
+  static std::atomic<u64> last_point{};
+
+  transaction_info *transaction_info::create(u64 const start_point)
+  {
+    auto const ret{ new(PointerFreeGC) transaction_info{} };
+    ret->start_point = start_point;
+    return ret;
+  }
+
+  bool transaction_info::is_running() const
+  {
+    auto const s{ status.load() };
+    return s == transaction_status::running || s == transaction_status::committing;
+  }
+
+  void transaction_info::stop(transaction_status const s)
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      status.store(s);
+    }
+    cv.notify_all();
+  }
+
+  void transaction_info::wait_for(std::chrono::milliseconds const timeout)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    cv.wait_for(lock, timeout, [this]() { return !is_running(); });
+  }
+
+  transaction *transaction::current()
+  {
+    return current_transaction;
+  }
+
+  transaction_stats &transaction::stats()
+  {
+    static transaction_stats s;
+    return s;
+  }
+
+  object_ref transaction::run_in_transaction(object_ref const fn)
+  {
+    if(current_transaction)
+    {
+      return fn.call();
+    }
+
+    transaction tx;
+    current_transaction = &tx;
+    /* The transaction is thread local, so we can't move threads until it's done. */
+    fiber::pin_scope const pin;
+    util::scope_exit const reset{ []() { current_transaction = nullptr; } };
+    return tx.run(fn);
+  }
+
+  /* Spreads out transactions which keep colliding. The first few retries just yield, since
+   * most conflicts clear up right away. */
+  static void backoff(usize const attempt)
+  {
+    if(attempt < 4)
+    {
+      std::this_thread::yield();
+      return;
+    }
+
+    thread_local std::mt19937 gen{ std::random_device{}() };
+    usize const cap_us{ 1ull << std::min<usize>(attempt, 10) };
+    std::uniform_int_distribution<usize> dist{ 0, cap_us };
+    std::this_thread::sleep_for(std::chrono::microseconds{ dist(gen) });
+  }
+
+  object_ref transaction::run(object_ref const fn)
+  {
+    for(usize i{}; i < retry_limit; ++i)
+    {
+      bool done{};
+      object_ref ret;
+
+      try
+      {
+        util::scope_exit const cleanup{ [&]() {
+          for(auto it{ locked.rbegin() }; it != locked.rend(); ++it)
+          {
+            (*it)->lock.unlock();
+          }
+          locked.clear();
+          for(auto const r : ensures)
+          {
+            r->lock.unlock_shared();
+          }
+          ensures.clear();
+          stop(done ? transaction_status::committed : transaction_status::retry);
+        } };
+
+        read_point = ++last_point;
+        if(i == 0)
+        {
+          start_point = read_point;
+          start_time = std::chrono::steady_clock::now();
+        }
+        info = transaction_info::create(start_point);
+
+        ret = fn.call();
+
+        auto expected{ transaction_status::running };
+        if(info->status.compare_exchange_strong(expected, transaction_status::committing))
+        {
+          commit();
+          done = true;
+        }
+      }
+      catch(retry_ex const &)
+      {
+      }
+
+      if(!done)
+      {
+        ++stats().retries;
+        notifies.clear();
+        sends.clear();
+        backoff(i);
+        continue;
+      }
+
+      ++stats().commits;
+      auto const changed{ std::move(notifies) };
+      notifies.clear();
+      for(auto const &n : changed)
+      {
+        n.r->notify_watches(n.old_val, n.new_val);
+      }
+
+      auto const held{ std::move(sends) };
+      sends.clear();
+      for(auto const &h : held)
+      {
+        obj::agent::dispatch_action(h.a, h.act);
+      }
+      return ret;
+    }
+
+    throw std::runtime_error{ "Transaction failed after reaching retry limit." };
+  }
+
+  bool transaction::is_running() const
+  {
+    return info && info->is_running();
+  }
+
+  void transaction::stop(transaction_status const s)
+  {
+    if(info)
+    {
+      info->stop(s);
+      info = nullptr;
+      vals.clear();
+      sets.clear();
+      commutes.clear();
+    }
+  }
+
+  object_ref transaction::get(obj::ref * const r)
+  {
+    if(!is_running())
+    {
+      throw retry_ex{};
+    }
+
+    auto const found{ vals.find(r) };
+    if(found != vals.end())
+    {
+      return found->second;
+    }
+
+    {
+      /* Ensured refs are already read locked by us until the transaction is done. Locking
+       * them again on the same thread is undefined. */
+      std::shared_lock<std::shared_timed_mutex> l{ r->lock, std::defer_lock };
+      if(!ensures.contains(r))
+      {
+        l.lock();
+      }
+      for(auto const &tv : r->history)
+      {
+        if(tv.point <= read_point)
+        {
+          return tv.val;
+        }
+      }
+    }
+
+    /* Every value we have is newer than our snapshot. Let the ref know it should keep
+     * more history and try again with a newer snapshot. */
+    ++r->faults;
+    ++stats().faults;
+    throw retry_ex{};
+  }
+
+  object_ref transaction::set(obj::ref * const r, object_ref const val)
+  {
+    if(!is_running())
+    {
+      throw retry_ex{};
+    }
+    if(commutes.contains(r))
+    {
+      throw std::runtime_error{ "Can't set a ref after commuting it in the same transaction." };
+    }
+
+    if(!sets.contains(r))
+    {
+      sets.insert(r);
+      claim(r);
+    }
+    vals[r] = val;
+    return val;
+  }
+
+  object_ref transaction::commute(obj::ref * const r, object_ref const fn, object_ref const args)
+  {
+    if(!is_running())
+    {
+      throw retry_ex{};
+    }
+
+    if(!vals.contains(r))
+    {
+      vals[r] = ensures.contains(r) ? r->history.front().val : r->current_val();
+    }
+    commutes[r].push_back({ fn, args });
+
+    auto const ret{ args.is_nil() ? fn.call(vals[r]) : apply_to(fn, vals[r], args) };
+    vals[r] = ret;
+    return ret;
+  }
+
+  void transaction::ensure(obj::ref * const r)
+  {
+    if(!is_running())
+    {
+      throw retry_ex{};
+    }
+    if(ensures.contains(r))
+    {
+      return;
+    }
+
+    /* The read lock is held until the transaction is done, which keeps anyone else from
+     * committing to the ref in the meantime. */
+    if(!r->lock.try_lock_shared_for(lock_wait))
+    {
+      ++stats().lock_timeouts;
+      throw retry_ex{};
+    }
+    if(r->history.front().point > read_point)
+    {
+      r->lock.unlock_shared();
+      throw retry_ex{};
+    }
+
+    auto const other{ r->tinfo };
+    if(other && other->is_running())
+    {
+      r->lock.unlock_shared();
+      if(other != info)
+      {
+        block_and_bail(other);
+      }
+      /* We've already claimed it, which is stronger than ensuring it. */
+      return;
+    }
+    ensures.insert(r);
+  }
+
+  void transaction::hold_send(obj::agent_ref const a, obj::agent::action const &act)
+  {
+    sends.push_back({ a, act });
+  }
+
+  object_ref transaction::claim(obj::ref * const r)
+  {
+    release_if_ensured(r);
+    lock_for_write(r);
+    std::unique_lock<std::shared_timed_mutex> l{ r->lock, std::adopt_lock };
+
+    /* Someone committed after our snapshot, so whatever we've read is stale. */
+    if(r->history.front().point > read_point)
+    {
+      throw retry_ex{};
+    }
+
+    auto const other{ r->tinfo };
+    if(other && other != info && other->is_running() && !barge(other))
+    {
+      l.unlock();
+      block_and_bail(other);
+    }
+
+    r->tinfo = info;
+    return r->history.front().val;
+  }
+
+  void transaction::release_if_ensured(obj::ref * const r)
+  {
+    if(ensures.erase(r))
+    {
+      r->lock.unlock_shared();
+    }
+  }
+
+  void transaction::lock_for_write(obj::ref * const r)
+  {
+    if(!r->lock.try_lock_for(lock_wait))
+    {
+      ++stats().lock_timeouts;
+      throw retry_ex{};
+    }
+  }
+
+  /* Only an older transaction which has been running for a while can barge, and only
+   * while the other one hasn't started committing. */
+  bool transaction::barge(transaction_info * const other)
+  {
+    if(std::chrono::steady_clock::now() - start_time < barge_wait
+       || start_point >= other->start_point)
+    {
+      return false;
+    }
+
+    auto expected{ transaction_status::running };
+    if(!other->status.compare_exchange_strong(expected, transaction_status::killed))
+    {
+      return false;
+    }
+    other->stop(transaction_status::killed);
+    ++stats().barges;
+    return true;
+  }
+
+  void transaction::block_and_bail(transaction_info * const other)
+  {
+    stop(transaction_status::retry);
+    other->wait_for(lock_wait);
+    throw retry_ex{};
+  }
+
+  void transaction::commit()
+  {
+    for(auto &[r, fns] : commutes)
+    {
+      if(sets.contains(r))
+      {
+        continue;
+      }
+
+      bool const was_ensured{ ensures.contains(r) };
+      release_if_ensured(r);
+      lock_for_write(r);
+      locked.push_back(r);
+
+      if(was_ensured && r->history.front().point > read_point)
+      {
+        throw retry_ex{};
+      }
+
+      auto const other{ r->tinfo };
+      if(other && other != info && other->is_running() && !barge(other))
+      {
+        throw retry_ex{};
+      }
+
+      /* Rerun every commute against the latest value. */
+      auto val{ r->history.front().val };
+      for(auto const &f : fns)
+      {
+        val = f.args.is_nil() ? f.fn.call(val) : apply_to(f.fn, val, f.args);
+      }
+      vals[r] = val;
+    }
+
+    for(auto const r : sets)
+    {
+      lock_for_write(r);
+      locked.push_back(r);
+    }
+
+    for(auto const &[r, val] : vals)
+    {
+      r->validate(val);
+    }
+
+    auto const commit_point{ ++last_point };
+    for(auto const &[r, val] : vals)
+    {
+      notifies.push_back({ r, r->history.front().val, val });
+      r->commit(val, commit_point);
+    }
+  }
+}
@@ -200,6 +200,12 @@ namespace jank::runtime::module
       file_view{ path, HANDLES(hFile, hMapping), head, static_cast<size_t>(fileSize.QuadPart) });
 #else
     auto const file_size(std::filesystem::file_size(path.c_str()));
+    /* Empty files can't be mapped, but they're trivial to read. */
+    if(file_size == 0)
+    {
+      return ok(file_view{ path, jtl::immutable_string{} });
+    }
+
     /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) */
     auto const fd(::open(path.c_str(), O_RDONLY));
     if(fd < 0)
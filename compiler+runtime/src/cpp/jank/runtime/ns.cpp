@@ -31,9 +31,17 @@ namespace jank::runtime
       unqualified_sym = make_box<obj::symbol>("", sym->name);
     }
 
-    /* TODO: Read lock, then upgrade as needed? Benchmark. */
-    auto locked_vars(vars.wlock());
-    object_ref const * const found_var((*locked_vars)->data.find(unqualified_sym));
+    /* Most interning is for vars which already exist, such as when loading a module, so we
+     * check the current snapshot before taking the write lock. */
+    if(object_ref const * const found_var(vars.load()->data.find(unqualified_sym));
+       found_var && found_var->is_some())
+    {
+      return expect_object<var>(*found_var);
+    }
+
+    auto const locked_vars(vars.wlock());
+    auto const current_vars(locked_vars.get());
+    object_ref const * const found_var(current_vars->data.find(unqualified_sym));
     if(found_var && found_var->is_some())
     {
       /* TODO: Why not store var_ref instead? Relying on expect_object is not good. */
@@ -41,8 +49,8 @@ namespace jank::runtime
     }
 
     auto const new_var(make_box<var>(runtime::detail::untagged(this), unqualified_sym));
-    *locked_vars
-      = make_box<obj::persistent_hash_map>((*locked_vars)->data.set(unqualified_sym, new_var));
+    locked_vars.publish(
+      make_box<obj::persistent_hash_map>(current_vars->data.set(unqualified_sym, new_var)));
     return new_var;
   }
 
@@ -70,9 +78,9 @@ namespace jank::runtime
       unqualified_sym = make_box<obj::symbol>("", sym->name);
     }
 
-    /* TODO: Read lock, then upgrade as needed? Benchmark. */
-    auto locked_vars(vars.wlock());
-    object_ref const * const found_var((*locked_vars)->data.find(unqualified_sym));
+    auto const locked_vars(vars.wlock());
+    auto const current_vars(locked_vars.get());
+    object_ref const * const found_var(current_vars->data.find(unqualified_sym));
     bool redefined{};
     if(found_var && found_var->is_some())
     {
@@ -96,8 +104,8 @@ namespace jank::runtime
                      name->to_string(),
                      new_var->to_code_string()));
     }
-    *locked_vars
-      = make_box<obj::persistent_hash_map>((*locked_vars)->data.set(unqualified_sym, new_var));
+    locked_vars.publish(
+      make_box<obj::persistent_hash_map>(current_vars->data.set(unqualified_sym, new_var)));
     return new_var;
   }
 
@@ -108,8 +116,8 @@ namespace jank::runtime
       return err(util::format("Can't unintern namespace-qualified symbol: {}", sym->to_string()));
     }
 
-    auto locked_vars(vars.wlock());
-    *locked_vars = make_box<obj::persistent_hash_map>((*locked_vars)->data.erase(sym));
+    auto const locked_vars(vars.wlock());
+    locked_vars.publish(make_box<obj::persistent_hash_map>(locked_vars.get()->data.erase(sym)));
     return ok();
   }
 
@@ -121,8 +129,21 @@ namespace jank::runtime
       return __rt_ctx->find_var(qualified_sym);
     }
 
-    auto const locked_vars(vars.rlock());
-    auto const found((*locked_vars)->data.find(sym));
+    auto const found(vars.load()->data.find(sym));
+    if(!found)
+    {
+      return {};
+    }
+
+    return { expect_object<var>(*found) };
+  }
+
+  var_ref ns::find_var(jtl::immutable_string_view const &name) const
+  {
+    /* This symbol never leaves this function, so it can live on the stack. The strings are
+     * small enough to be stored inline for nearly all var names. */
+    obj::symbol const sym{ "", name };
+    auto const found(vars.load()->data.find(&sym));
     if(!found)
     {
       return {};
@@ -134,8 +155,9 @@ namespace jank::runtime
   jtl::result<void, jtl::immutable_string>
   ns::add_alias(obj::symbol_ref const sym, ns_ref const nsp)
   {
-    auto locked_aliases(aliases.wlock());
-    auto const found((*locked_aliases)->data.find(sym));
+    auto const locked_aliases(aliases.wlock());
+    auto const current_aliases(locked_aliases.get());
+    auto const found(current_aliases->data.find(sym));
     if(found)
     {
       auto const existing(expect_object<ns>(*found));
@@ -149,20 +171,20 @@ namespace jank::runtime
       }
       return ok();
     }
-    *locked_aliases = make_box<obj::persistent_hash_map>((*locked_aliases)->data.set(sym, nsp));
+    locked_aliases.publish(make_box<obj::persistent_hash_map>(current_aliases->data.set(sym, nsp)));
     return ok();
   }
 
   void ns::remove_alias(obj::symbol_ref const sym)
   {
-    auto locked_aliases(aliases.wlock());
-    *locked_aliases = make_box<obj::persistent_hash_map>((*locked_aliases)->data.erase(sym));
+    auto const locked_aliases(aliases.wlock());
+    locked_aliases.publish(
+      make_box<obj::persistent_hash_map>(locked_aliases.get()->data.erase(sym)));
   }
 
   ns_ref ns::find_alias(obj::symbol_ref const sym) const
   {
-    auto locked_aliases(aliases.rlock());
-    auto const found((*locked_aliases)->data.find(sym));
+    auto const found(aliases.load()->data.find(sym));
     if(found)
     {
       return expect_object<ns>(*found);
@@ -172,8 +194,9 @@ namespace jank::runtime
 
   jtl::result<void, jtl::immutable_string> ns::refer(obj::symbol_ref const sym, var_ref const var)
   {
-    auto locked_vars(vars.wlock());
-    if(auto const found{ (*locked_vars)->data.find(sym) };
+    auto const locked_vars(vars.wlock());
+    auto const current_vars(locked_vars.get());
+    if(auto const found{ current_vars->data.find(sym) };
        found && found->get_type() == object_type::var)
     {
       auto const found_var(expect_object<runtime::var>(*found));
@@ -186,7 +209,7 @@ namespace jank::runtime
                                 to_string()));
       }
     }
-    *locked_vars = make_box<obj::persistent_hash_map>((*locked_vars)->data.set(sym, var));
+    locked_vars.publish(make_box<obj::persistent_hash_map>(current_vars->data.set(sym, var)));
     return ok();
   }
 
@@ -199,8 +222,7 @@ namespace jank::runtime
 
   obj::persistent_hash_map_ref ns::get_mappings() const
   {
-    auto const locked_vars(vars.rlock());
-    return *locked_vars;
+    return vars.load();
   }
 
   bool ns::equal(object const &o) const
@@ -0,0 +1,400 @@
+#include <thread>
+
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/call.hpp>
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/runtime/detail/transaction.hpp>
+#include <jank/gc.hpp>
+
+namespace jank::runtime::obj
+{
+  namespace
+  {
+    struct held_send
+    {
+      agent_ref a;
+      agent::action act;
+    };
+  }
+
+  /* Sends made during an action are held here until the action commits. */
+  static thread_local native_vector<held_send> *held_sends{};
+  static thread_local agent const *current_agent{};
+  static std::atomic_bool shut_down{};
+
+  agent::await_latch *agent::await_latch::create(usize const count)
+  {
+    auto const ret{ new(PointerFreeGC) await_latch{} };
+    ret->remaining = count;
+    return ret;
+  }
+
+  void agent::await_latch::count_down()
+  {
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      --remaining;
+    }
+    cv.notify_all();
+  }
+
+  void agent::await_latch::wait()
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    cv.wait(lock, [this]() { return remaining == 0; });
+  }
+
+  bool agent::await_latch::wait_for(std::chrono::milliseconds const timeout)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    return cv.wait_for(lock, timeout, [this]() { return remaining == 0; });
+  }
+
+  agent::agent(object_ref const o)
+    : object{ obj_type, obj_behaviors }
+    , val{ o.raw() }
+    , watches{ persistent_hash_map::empty() }
+  {
+  }
+
+  object_ref agent::deref()
+  {
+    return val.load();
+  }
+
+  object_ref agent::with_meta(object_ref const)
+  {
+    throw std::runtime_error{ "Objects of type `agent` do not support `with-meta`." };
+  }
+
+  object_ref agent::get_meta() const
+  {
+    return meta.get();
+  }
+
+  void agent::set_meta(object_ref const o)
+  {
+    auto const new_meta(behavior::detail::validate_meta(o));
+    meta.set(new_meta);
+  }
+
+  static void notify_watches(agent_ref const a, object_ref const old_val, object_ref const new_val)
+  {
+    auto const locked_watches(a->watches.rlock());
+    for(auto const &entry : (*locked_watches)->data)
+    {
+      auto const fn(entry.second);
+      if(fn.is_some())
+      {
+        fn.call(entry.first, a, old_val, new_val);
+      }
+    }
+  }
+
+  static void do_validate(object_ref const vf, object_ref const val)
+  {
+    if(vf.is_some() && !truthy(vf.call(val)))
+    {
+      throw std::runtime_error{ "The `agent` validator rejected the provided value." };
+    }
+  }
+
+  void agent::set_validator(object_ref const vf)
+  {
+    do_validate(vf, deref());
+    auto locked_validator(validator.wlock());
+    *locked_validator = vf;
+  }
+
+  object_ref agent::get_validator() const
+  {
+    auto const locked_validator(validator.rlock());
+    return *locked_validator;
+  }
+
+  void agent::add_watch(object_ref const key, object_ref const fn)
+  {
+    auto locked_watches(watches.wlock());
+    *locked_watches = (*locked_watches)->assoc(key, fn);
+  }
+
+  void agent::remove_watch(object_ref const key)
+  {
+    auto locked_watches(watches.wlock());
+    *locked_watches = (*locked_watches)->dissoc(key);
+  }
+
+  void agent::validate(object_ref const val)
+  {
+    auto const locked_validator(validator.rlock());
+    do_validate(*locked_validator, val);
+  }
+
+  void agent::dispatch(agent_ref const a, action const &act)
+  {
+    if(shut_down.load())
+    {
+      throw std::runtime_error{ "Agents have been shut down." };
+    }
+    if(a->failed.load())
+    {
+      throw std::runtime_error{ "The agent is failed and needs to be restarted." };
+    }
+    dispatch_action(a, act);
+  }
+
+  void agent::dispatch_action(agent_ref const a, action const &act)
+  {
+    auto const tx{ runtime::detail::transaction::current() };
+    if(tx)
+    {
+      tx->hold_send(a, act);
+      return;
+    }
+    if(held_sends)
+    {
+      held_sends->push_back({ a, act });
+      return;
+    }
+    a->enqueue(act);
+  }
+
+  usize agent::release_pending_sends()
+  {
+    if(!held_sends)
+    {
+      return 0;
+    }
+
+    auto const count{ held_sends->size() };
+    for(auto const &h : *held_sends)
+    {
+      h.a->enqueue(h.act);
+    }
+    held_sends->clear();
+    return count;
+  }
+
+  agent const *agent::running()
+  {
+    return current_agent;
+  }
+
+  void agent::shutdown()
+  {
+    shut_down.store(true);
+  }
+
+  static object_ref drain_agent(object_ref const a)
+  {
+    expect_object<agent>(a)->drain(agent_executor::send);
+    return {};
+  }
+
+  static object_ref drain_agent_off(object_ref const a)
+  {
+    expect_object<agent>(a)->drain(agent_executor::send_off);
+    return {};
+  }
+
+  void agent::schedule(agent_executor const executor)
+  {
+    if(executor == agent_executor::send)
+    {
+      runtime::detail::task_pool::instance().submit(
+        make_box<native_function_wrapper>(&drain_agent),
+        runtime::detail::untagged(this));
+    }
+    else
+    {
+      runtime::detail::task_pool::elastic_instance().submit(
+        make_box<native_function_wrapper>(&drain_agent_off),
+        runtime::detail::untagged(this));
+    }
+  }
+
+  agent::action agent::take()
+  {
+    if(next_action.is_some())
+    {
+      auto const ret{ next_action.unwrap() };
+      next_action = jtl::none;
+      return ret;
+    }
+
+    action ret;
+    /* The count says there's an action, but its push may not be linked in just yet. */
+    while(!queue.try_pop(ret))
+    {
+      std::this_thread::yield();
+    }
+    return ret;
+  }
+
+  void agent::enqueue(action const &a)
+  {
+    queue.push(a);
+    if(pending.fetch_add(1, std::memory_order_acq_rel) == 0)
+    {
+      schedule(a.executor);
+    }
+  }
+
+  void agent::drain(agent_executor const on)
+  {
+    for(usize ran{}; ran < batch_size; ++ran)
+    {
+      {
+        std::lock_guard<std::mutex> const lock{ error_mutex };
+        if(error.is_some())
+        {
+          suspended = true;
+          return;
+        }
+      }
+
+      auto const a{ take() };
+      /* A send-off may block, so it must never tie up the fixed pool. Awaits don't run any
+       * code, so they can go anywhere. */
+      if(a.executor != on && !a.latch)
+      {
+        next_action = a;
+        schedule(a.executor);
+        return;
+      }
+
+      run(a);
+      if(pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        return;
+      }
+    }
+
+    /* There's more to do, but other agents get a turn at the pool first. */
+    next_action = take();
+    schedule(next_action.unwrap().executor);
+  }
+
+  bool agent::run(action const &a)
+  {
+    if(a.latch)
+    {
+      a.latch->count_down();
+      return true;
+    }
+
+    native_vector<held_send> held;
+    auto const prev_held{ held_sends };
+    auto const prev_agent{ current_agent };
+    held_sends = &held;
+    current_agent = this;
+
+    object_ref err;
+    bool ok{};
+    try
+    {
+      auto const old_val{ deref() };
+      auto const next{ a.args.is_nil() ? a.fn.call(old_val) : apply_to(a.fn, old_val, a.args) };
+      validate(next);
+      val.store(next.raw());
+      notify_watches(runtime::detail::untagged(this), old_val, next);
+      ok = true;
+    }
+    catch(object_ref const e)
+    {
+      err = e;
+    }
+    catch(std::exception const &e)
+    {
+      err = make_box(e.what());
+    }
+    catch(...)
+    {
+      err = make_box("Unknown exception.");
+    }
+
+    held_sends = prev_held;
+    current_agent = prev_agent;
+
+    if(ok)
+    {
+      for(auto const &h : held)
+      {
+        h.a->enqueue(h.act);
+      }
+      return true;
+    }
+
+    /* Anything sent by a failed action is discarded. */
+    auto const handler{ *error_handler.rlock() };
+    if(handler.is_some())
+    {
+      try
+      {
+        handler.call(runtime::detail::untagged(this), err);
+      }
+      catch(...)
+      {
+        /* Like Clojure, anything thrown by the handler itself is ignored. */
+      }
+    }
+
+    if(error_mode.load() == agent_error_mode::continue_)
+    {
+      return true;
+    }
+
+    std::lock_guard<std::mutex> const lock{ error_mutex };
+    error = err;
+    failed.store(true);
+    return false;
+  }
+
+  object_ref agent::get_error() const
+  {
+    std::lock_guard<std::mutex> const lock{ error_mutex };
+    return error;
+  }
+
+  void agent::restart(object_ref const new_state, bool const clear_actions)
+  {
+    std::unique_lock<std::mutex> lock{ error_mutex };
+    if(error.is_nil())
+    {
+      throw std::runtime_error{ "The agent doesn't need to be restarted." };
+    }
+
+    validate(new_state);
+    val.store(new_state.raw());
+    error = {};
+    failed.store(false);
+
+    /* If nothing was queued when the agent failed, the drain has already finished. */
+    if(!suspended)
+    {
+      return;
+    }
+    suspended = false;
+
+    /* Otherwise, the suspended drain still owns the queue, so we do too, until we
+     * either discard everything or hand it back to a new drain. */
+    if(clear_actions)
+    {
+      do
+      {
+        auto const a{ take() };
+        if(a.latch)
+        {
+          a.latch->count_down();
+        }
+      } while(pending.fetch_sub(1, std::memory_order_acq_rel) != 1);
+      return;
+    }
+
+    lock.unlock();
+    next_action = take();
+    schedule(next_action.unwrap().executor);
+  }
+}
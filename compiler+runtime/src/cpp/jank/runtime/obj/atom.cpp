@@ -3,6 +3,7 @@
 #include <jank/runtime/obj/atom.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/detail/backoff.hpp>
 #include <jank/util/fmt.hpp>
 
 namespace jank::runtime::obj
@@ -42,6 +43,11 @@ namespace jank::runtime::obj
 
   static void notify_watches(atom_ref const a, object_ref const old_val, object_ref const new_val)
   {
+    if(!a->has_watches.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
     auto const locked_watches(a->watches.rlock());
     for(auto const &entry : (*locked_watches)->data)
     {
@@ -65,6 +71,7 @@ namespace jank::runtime::obj
   persistent_vector_ref atom::reset_vals(object_ref const o)
   {
     validate(o);
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -74,12 +81,14 @@ namespace jank::runtime::obj
         auto ret{ make_box<persistent_vector>(std::in_place, v, o) };
         return ret;
       }
+      backoff.pause();
     }
   }
 
   /* NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap,bugprone-exception-escape) */
   object_ref atom::swap(object_ref const fn)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -90,12 +99,14 @@ namespace jank::runtime::obj
         notify_watches(runtime::detail::untagged(this), v, next);
         return next;
       }
+      backoff.pause();
     }
   }
 
   /* NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap,bugprone-exception-escape) */
   object_ref atom::swap(object_ref const fn, object_ref const a1)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -106,12 +117,14 @@ namespace jank::runtime::obj
         notify_watches(runtime::detail::untagged(this), v, next);
         return next;
       }
+      backoff.pause();
     }
   }
 
   /* NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap,bugprone-exception-escape) */
   object_ref atom::swap(object_ref const fn, object_ref const a1, object_ref const a2)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -122,6 +135,7 @@ namespace jank::runtime::obj
         notify_watches(runtime::detail::untagged(this), v, next);
         return next;
       }
+      backoff.pause();
     }
   }
 
@@ -129,6 +143,7 @@ namespace jank::runtime::obj
   /* NOLINTNEXTLINE(cppcoreguidelines-noexcept-swap,bugprone-exception-escape) */
   atom::swap(object_ref const fn, object_ref const a1, object_ref const a2, object_ref const rest)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -140,11 +155,13 @@ namespace jank::runtime::obj
         notify_watches(runtime::detail::untagged(this), v, next);
         return next;
       }
+      backoff.pause();
     }
   }
 
   persistent_vector_ref atom::swap_vals(object_ref const fn)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -156,11 +173,13 @@ namespace jank::runtime::obj
         auto ret{ make_box<persistent_vector>(std::in_place, v, next) };
         return ret;
       }
+      backoff.pause();
     }
   }
 
   persistent_vector_ref atom::swap_vals(object_ref const fn, object_ref const a1)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -172,12 +191,14 @@ namespace jank::runtime::obj
         auto ret{ make_box<persistent_vector>(std::in_place, v, next) };
         return ret;
       }
+      backoff.pause();
     }
   }
 
   persistent_vector_ref
   atom::swap_vals(object_ref const fn, object_ref const a1, object_ref const a2)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -189,6 +210,7 @@ namespace jank::runtime::obj
         auto ret{ make_box<persistent_vector>(std::in_place, v, next) };
         return ret;
       }
+      backoff.pause();
     }
   }
 
@@ -197,6 +219,7 @@ namespace jank::runtime::obj
                                         object_ref const a2,
                                         object_ref const rest)
   {
+    runtime::detail::backoff backoff;
     while(true)
     {
       auto v(val.load());
@@ -209,6 +232,7 @@ namespace jank::runtime::obj
         auto ret{ make_box<persistent_vector>(std::in_place, v, next) };
         return ret;
       }
+      backoff.pause();
     }
   }
 
@@ -238,6 +262,7 @@ namespace jank::runtime::obj
     do_validate(vf, deref());
     auto locked_validator(validator.wlock());
     *locked_validator = vf;
+    has_validator.store(vf.is_some(), std::memory_order_release);
   }
 
   object_ref atom::get_validator() const
@@ -250,16 +275,23 @@ namespace jank::runtime::obj
   {
     auto locked_watches(watches.wlock());
     *locked_watches = (*locked_watches)->assoc(key, fn);
+    has_watches.store(true, std::memory_order_release);
   }
 
   void atom::remove_watch(object_ref const key)
   {
     auto locked_watches(watches.wlock());
     *locked_watches = (*locked_watches)->dissoc(key);
+    has_watches.store((*locked_watches)->count() != 0, std::memory_order_release);
   }
 
   void atom::validate(object_ref const val)
   {
+    if(!has_validator.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
     auto const locked_validator(validator.rlock());
     do_validate(*locked_validator, val);
   }
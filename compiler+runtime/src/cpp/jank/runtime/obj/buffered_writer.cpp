@@ -0,0 +1,137 @@
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <jank/runtime/obj/buffered_writer.hpp>
+#include <jank/util/fmt.hpp>
+
+#ifndef JANK_WINDOWS_LIKE
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+
+namespace jank::runtime::obj
+{
+  buffered_writer::buffered_writer(std::FILE * const file)
+    : buffered_writer{ file, default_capacity, default_flush_interval }
+  {
+  }
+
+  buffered_writer::buffered_writer(std::FILE * const file,
+                                   usize const capacity,
+                                   std::chrono::milliseconds const flush_interval)
+    : object{ obj_type, obj_behaviors }
+    , file{ file }
+    , buff{ capacity }
+    , capacity{ capacity }
+    , flush_interval{ flush_interval }
+    , last_flush{ std::chrono::steady_clock::now() }
+  {
+  }
+
+  void buffered_writer::write(jtl::immutable_string_view const &s)
+  {
+    if(!is_owner())
+    {
+      std::fwrite(s.data(), 1, s.size(), file);
+      return;
+    }
+    if(buff.size() + s.size() <= capacity)
+    {
+      buff(s);
+      wrote();
+      return;
+    }
+
+    /* Large writes don't go through the buffer at all. Instead, we hand both the buffer and
+     * the new data to the kernel in one vectored write. */
+#ifdef JANK_WINDOWS_LIKE
+    std::fwrite(buff.data(), 1, buff.size(), file);
+    std::fwrite(s.data(), 1, s.size(), file);
+    std::fflush(file);
+#else
+    /* Anything which went straight to the FILE* needs to land first. */
+    std::fflush(file);
+
+    /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): iovec isn't const-correct. */
+    std::array<iovec, 2> iov{
+      { { buff.data(), buff.size() }, { const_cast<char *>(s.data()), s.size() } }
+    };
+    auto const fd{ fileno(file) };
+    usize remaining{ buff.size() + s.size() };
+    usize index{};
+    while(remaining > 0)
+    {
+      auto const written{ ::writev(fd, iov.data() + index, static_cast<int>(iov.size() - index)) };
+      if(written < 0)
+      {
+        if(errno == EINTR)
+        {
+          continue;
+        }
+        /* There's no telling how much of the buffer made it out, so it's dropped. */
+        auto const error{ errno };
+        buff.clear();
+        throw std::runtime_error{ util::format("Unable to write: {}", std::strerror(error)) };
+      }
+
+      remaining -= static_cast<usize>(written);
+      auto consumed{ static_cast<usize>(written) };
+      while(index < iov.size() && consumed >= iov[index].iov_len)
+      {
+        consumed -= iov[index].iov_len;
+        ++index;
+      }
+      if(index < iov.size())
+      {
+        iov[index].iov_base = static_cast<char *>(iov[index].iov_base) + consumed;
+        iov[index].iov_len -= consumed;
+      }
+    }
+#endif
+    buff.clear();
+    last_flush = std::chrono::steady_clock::now();
+  }
+
+  void buffered_writer::write(char const c)
+  {
+    if(!is_owner())
+    {
+      std::fputc(c, file);
+      return;
+    }
+    buff(c);
+    wrote();
+  }
+
+  void buffered_writer::wrote()
+  {
+    if(capacity <= buff.size()
+       || flush_interval <= std::chrono::steady_clock::now() - last_flush)
+    {
+      flush();
+    }
+  }
+
+  void buffered_writer::flush()
+  {
+    /* Whatever the owner has buffered is theirs to flush. */
+    if(!is_owner())
+    {
+      std::fflush(file);
+      return;
+    }
+    if(!buff.empty())
+    {
+      std::fwrite(buff.data(), 1, buff.size(), file);
+      buff.clear();
+    }
+    std::fflush(file);
+    last_flush = std::chrono::steady_clock::now();
+  }
+
+  bool buffered_writer::is_owner() const
+  {
+    return owner == std::this_thread::get_id();
+  }
+}
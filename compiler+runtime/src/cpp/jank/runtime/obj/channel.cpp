@@ -0,0 +1,393 @@
+#include <jank/runtime/obj/channel.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/detail/fiber.hpp>
+#include <jank/runtime/detail/task_pool.hpp>
+#include <jank/gc.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  channel::guard *channel::guard::create()
+  {
+    static std::atomic<u64> next_id{};
+    auto const ret{ new(PointerFreeGC) guard{} };
+    ret->id = next_id.fetch_add(1, std::memory_order_relaxed);
+    return ret;
+  }
+
+  bool channel::guard::lock()
+  {
+    while(true)
+    {
+      auto expected{ state::active };
+      if(st.compare_exchange_weak(expected, state::locked, std::memory_order_acquire))
+      {
+        return true;
+      }
+      if(expected == state::done)
+      {
+        return false;
+      }
+      /* Another channel is in the middle of completing this handler. That's only ever a
+       * few instructions, so we spin. */
+    }
+  }
+
+  void channel::guard::unlock()
+  {
+    st.store(state::active, std::memory_order_release);
+  }
+
+  void channel::guard::commit()
+  {
+    st.store(state::done, std::memory_order_release);
+  }
+
+  bool channel::guard::is_done() const
+  {
+    return st.load(std::memory_order_acquire) == state::done;
+  }
+
+  enum class pair_lock : u8
+  {
+    locked,
+    parked_done,
+    incoming_done
+  };
+
+  /* Locks the guard of a parked handler along with the guard of the incoming take or put,
+   * which may be null for `offer` and `poll`. */
+  static pair_lock lock_pair(channel::guard * const parked, channel::guard * const incoming)
+  {
+    if(!incoming)
+    {
+      return parked->lock() ? pair_lock::locked : pair_lock::parked_done;
+    }
+
+    auto const parked_first{ parked->id < incoming->id };
+    auto const first{ parked_first ? parked : incoming };
+    auto const second{ parked_first ? incoming : parked };
+    if(!first->lock())
+    {
+      return parked_first ? pair_lock::parked_done : pair_lock::incoming_done;
+    }
+    if(!second->lock())
+    {
+      first->unlock();
+      return parked_first ? pair_lock::incoming_done : pair_lock::parked_done;
+    }
+    return pair_lock::locked;
+  }
+
+  /* Removes and returns the first parked handler which can complete along with the incoming
+   * one, committing both of their guards. Handlers which have already completed elsewhere
+   * are dropped along the way. If there's no match because the incoming take or put has
+   * completed elsewhere, incoming_done is set. */
+  static jtl::option<channel::handler> pop_match(native_deque<channel::handler> &parked,
+                                                 channel::guard * const incoming,
+                                                 bool &incoming_done)
+  {
+    for(auto it{ parked.begin() }; it != parked.end();)
+    {
+      /* A take and a put from the same `alts` can't complete each other. */
+      if(it->g == incoming)
+      {
+        ++it;
+        continue;
+      }
+
+      switch(lock_pair(it->g, incoming))
+      {
+        case pair_lock::parked_done:
+          it = parked.erase(it);
+          break;
+        case pair_lock::incoming_done:
+          incoming_done = true;
+          return jtl::none;
+        case pair_lock::locked:
+          {
+            it->g->commit();
+            if(incoming)
+            {
+              incoming->commit();
+            }
+            auto const ret{ *it };
+            parked.erase(it);
+            return ret;
+          }
+      }
+    }
+    return jtl::none;
+  }
+
+  channel::channel(channel_buffer const kind, usize const capacity)
+    : object{ obj_type, obj_behaviors }
+    , kind{ kind }
+    , capacity{ kind == channel_buffer::none ? 0 : capacity }
+  {
+  }
+
+  bool channel::accepts_put() const
+  {
+    return buffer.size() < capacity || kind == channel_buffer::dropping
+      || kind == channel_buffer::sliding;
+  }
+
+  void channel::buffer_put(object_ref const val)
+  {
+    if(buffer.size() < capacity)
+    {
+      buffer.push_back(val);
+    }
+    else if(kind == channel_buffer::sliding)
+    {
+      buffer.pop_front();
+      buffer.push_back(val);
+    }
+    /* Otherwise, the buffer is dropping and full, so the value is dropped. */
+  }
+
+  void channel::refill(native_vector<completion> &done)
+  {
+    while(!putters.empty() && buffer.size() < capacity)
+    {
+      auto const p{ putters.front() };
+      putters.pop_front();
+      if(p.g->lock())
+      {
+        p.g->commit();
+        buffer.push_back(p.val);
+        done.push_back({ p, jank_true });
+      }
+    }
+  }
+
+  void channel::park(native_deque<handler> &parked,
+                     handler const &h,
+                     usize &dirty,
+                     char const * const what)
+  {
+    /* Otherwise, a handler which completed elsewhere would only be dropped once a matching
+     * op came along, which may be never. A loop of `alts` over a quiet channel would then
+     * leave one behind each time around. */
+    if(++dirty > max_dirty || max_pending <= parked.size())
+    {
+      dirty = 0;
+      std::erase_if(parked, [](handler const &p) { return p.g->is_done(); });
+    }
+    if(max_pending <= parked.size())
+    {
+      throw std::runtime_error{ util::format(
+        "No more than {} pending {} are allowed on a single channel. Consider using a "
+        "windowed buffer.",
+        max_pending,
+        what) };
+    }
+    parked.push_back(h);
+  }
+
+  void channel::complete_all(native_vector<completion> const &done)
+  {
+    for(auto const &c : done)
+    {
+      if(c.h.callback.is_nil() && !c.h.fiber)
+      {
+        continue;
+      }
+
+      auto const result{ c.h.port.is_nil()
+                           ? c.result
+                           : make_box<persistent_vector>(std::in_place, c.result, c.h.port) };
+      if(c.h.fiber)
+      {
+        c.h.fiber->wake(result);
+      }
+      /* Promises are how blocking takes and puts wait, so they don't need to be deferred. */
+      else if(c.h.callback.get_type() == object_type::promise)
+      {
+        c.h.callback.call(result);
+      }
+      else
+      {
+        runtime::detail::task_pool::instance().submit(c.h.callback, result);
+      }
+    }
+  }
+
+  bool channel::put(handler const &h)
+  {
+    native_vector<completion> done;
+    bool accepted{ true };
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(closed)
+      {
+        accepted = false;
+        if(h.g->lock())
+        {
+          h.g->commit();
+          done.push_back({ h, jank_false });
+        }
+      }
+      else
+      {
+        /* Parked takes mean the buffer is empty, so a take gets the value directly. */
+        bool h_done{};
+        auto const taker{ pop_match(takers, h.g, h_done) };
+        if(taker.is_some())
+        {
+          done.push_back({ taker.unwrap(), h.val });
+          done.push_back({ h, jank_true });
+        }
+        else if(!h_done)
+        {
+          if(accepts_put())
+          {
+            if(h.g->lock())
+            {
+              h.g->commit();
+              buffer_put(h.val);
+              done.push_back({ h, jank_true });
+            }
+          }
+          else
+          {
+            park(putters, h, dirty_puts, "puts");
+          }
+        }
+      }
+    }
+    complete_all(done);
+    return accepted;
+  }
+
+  void channel::take(handler const &h)
+  {
+    native_vector<completion> done;
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(!buffer.empty())
+      {
+        if(h.g->lock())
+        {
+          h.g->commit();
+          done.push_back({ h, buffer.front() });
+          buffer.pop_front();
+          refill(done);
+        }
+      }
+      else
+      {
+        bool h_done{};
+        auto const putter{ pop_match(putters, h.g, h_done) };
+        if(putter.is_some())
+        {
+          done.push_back({ h, putter.unwrap().val });
+          done.push_back({ putter.unwrap(), jank_true });
+        }
+        else if(!h_done)
+        {
+          if(closed)
+          {
+            if(h.g->lock())
+            {
+              h.g->commit();
+              done.push_back({ h, {} });
+            }
+          }
+          else
+          {
+            park(takers, h, dirty_takes, "takes");
+          }
+        }
+      }
+    }
+    complete_all(done);
+  }
+
+  bool channel::offer(object_ref const val)
+  {
+    native_vector<completion> done;
+    bool accepted{};
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(!closed)
+      {
+        bool unused{};
+        auto const taker{ pop_match(takers, nullptr, unused) };
+        if(taker.is_some())
+        {
+          done.push_back({ taker.unwrap(), val });
+          accepted = true;
+        }
+        else if(accepts_put())
+        {
+          buffer_put(val);
+          accepted = true;
+        }
+      }
+    }
+    complete_all(done);
+    return accepted;
+  }
+
+  object_ref channel::poll()
+  {
+    native_vector<completion> done;
+    object_ref ret;
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(!buffer.empty())
+      {
+        ret = buffer.front();
+        buffer.pop_front();
+        refill(done);
+      }
+      else
+      {
+        bool unused{};
+        auto const putter{ pop_match(putters, nullptr, unused) };
+        if(putter.is_some())
+        {
+          ret = putter.unwrap().val;
+          done.push_back({ putter.unwrap(), jank_true });
+        }
+      }
+    }
+    complete_all(done);
+    return ret;
+  }
+
+  void channel::close()
+  {
+    native_vector<completion> done;
+    {
+      std::lock_guard<std::mutex> const lock{ mutex };
+      if(closed)
+      {
+        return;
+      }
+      closed = true;
+
+      /* Parked takes mean there's nothing left to take, so they get nil. Parked puts stay
+       * where they are, to be taken like anything else that was put before closing. */
+      for(auto const &t : takers)
+      {
+        if(t.g->lock())
+        {
+          t.g->commit();
+          done.push_back({ t, {} });
+        }
+      }
+      takers.clear();
+    }
+    complete_all(done);
+  }
+
+  bool channel::is_closed() const
+  {
+    std::lock_guard<std::mutex> const lock{ mutex };
+    return closed;
+  }
+}
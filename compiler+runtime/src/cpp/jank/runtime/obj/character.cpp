@@ -1,3 +1,5 @@
+#include <array>
+#include <atomic>
 #include <cwchar>
 
 #include <jtl/utf8.hpp>
@@ -60,6 +62,76 @@ namespace jank::runtime::obj
   {
   }
 
+  /* All code points which are encoded in one or two bytes of UTF-8. */
+  static constexpr usize cached_codepoints{ 0x800 };
+
+  /* The cache is filled lazily, since most programs only ever see a handful of these. Two
+   * threads may race to box the same character, in which case one box just goes unused. */
+  static character_ref cached(usize const codepoint, jtl::immutable_string_view const &bytes)
+  {
+    static std::array<std::atomic<character *>, cached_codepoints> cache{};
+
+    auto &slot{ cache[codepoint] };
+    auto existing{ slot.load(std::memory_order_acquire) };
+    if(existing)
+    {
+      return existing;
+    }
+
+    auto const fresh{ make_box<character>(jtl::immutable_string{ bytes }) };
+    if(slot.compare_exchange_strong(existing,
+                                    fresh.ptr(),
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
+    {
+      return fresh;
+    }
+    return existing;
+  }
+
+  character_ref character::create(char const ch)
+  {
+    auto const byte{ static_cast<unsigned char>(ch) };
+    if(byte < 0x80)
+    {
+      return cached(byte, { &ch, 1 });
+    }
+    return make_box<character>(ch);
+  }
+
+  character_ref character::create(jtl::immutable_string_view const &bytes)
+  {
+    if(bytes.size() == 1)
+    {
+      return create(bytes[0]);
+    }
+    if(bytes.size() == 2)
+    {
+      auto const lead{ static_cast<unsigned char>(bytes[0]) };
+      auto const cont{ static_cast<unsigned char>(bytes[1]) };
+      if((lead & 0xE0) == 0xC0 && (cont & 0xC0) == 0x80)
+      {
+        auto const codepoint{ (static_cast<usize>(lead & 0x1F) << 6) | (cont & 0x3F) };
+        /* Overlong encodings aren't canonical, so they don't get to share. */
+        if(0x80 <= codepoint)
+        {
+          return cached(codepoint, bytes);
+        }
+      }
+    }
+    return make_box<character>(jtl::immutable_string{ bytes });
+  }
+
+  character_ref character::create(i64 const codepoint)
+  {
+    if(0 <= codepoint && codepoint < static_cast<i64>(cached_codepoints))
+    {
+      auto const bytes{ jtl::to_char(codepoint) };
+      return create(bytes.view());
+    }
+    return make_box<character>(codepoint);
+  }
+
   bool character::equal(object const &o) const
   {
     if(o.type != object_type::character)
@@ -1,5 +1,6 @@
 #include <jank/runtime/obj/detail/base_persistent_map.hpp>
 #include <jank/runtime/behavior/map_like.hpp>
+#include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/seq.hpp>
@@ -216,9 +217,28 @@ namespace jank::runtime::obj::detail
     meta.set(new_meta);
   }
 
+  template <typename PT, typename ST, typename V>
+  object_ref
+  base_persistent_map<PT, ST, V>::kv_reduce(object_ref const f, object_ref const init) const
+  {
+    object_ref res{ init };
+    for(auto const &entry : static_cast<PT const *>(this)->data)
+    {
+      res = f.call(res, entry.first, entry.second);
+      if(res.get_type() == object_type::reduced)
+      {
+        return expect_object<reduced>(res)->val;
+      }
+    }
+    return res;
+  }
+
   template struct base_persistent_map<persistent_array_map,
                                       persistent_array_map_sequence,
                                       runtime::detail::native_array_map>;
+  template struct base_persistent_map<persistent_shape_map,
+                                      persistent_shape_map_sequence,
+                                      runtime::detail::native_shape_map>;
   template struct base_persistent_map<persistent_hash_map,
                                       persistent_hash_map_sequence,
                                       runtime::detail::native_persistent_hash_map>;
@@ -0,0 +1,106 @@
+#include <cstring>
+
+#include <jank/runtime/obj/file_reader.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  file_reader::file_reader(module::file_view &&view)
+    : object{ obj_type, obj_behaviors }
+    , view{ jtl::move(view) }
+  {
+  }
+
+  jtl::option<jtl::immutable_string_view> file_reader::next_line()
+  {
+    if(closed)
+    {
+      throw std::runtime_error{ util::format("The reader for `{}` is already closed.",
+                                             view.file_path()) };
+    }
+
+    auto const size{ view.size() };
+    if(offset >= size)
+    {
+      return none;
+    }
+
+    auto const start{ view.data() + offset };
+    auto const remaining{ size - offset };
+    auto const newline{ static_cast<char const *>(std::memchr(start, '\n', remaining)) };
+    auto length{ newline ? static_cast<usize>(newline - start) : remaining };
+    offset += newline ? length + 1 : length;
+
+    /* Like Java's BufferedReader, we support both \n and \r\n line endings. */
+    if(length > 0 && start[length - 1] == '\r')
+    {
+      --length;
+    }
+
+    return jtl::immutable_string_view{ start, length };
+  }
+
+  object_ref file_reader::read_line()
+  {
+    auto const line{ next_line() };
+    if(line.is_none())
+    {
+      return {};
+    }
+    return make_box<persistent_string>(jtl::immutable_string{ line.unwrap() });
+  }
+
+  object_ref file_reader::read_line_chunk()
+  {
+    native_vector<object_ref> lines;
+    lines.reserve(chunk_size);
+    for(usize i{}; i < chunk_size; ++i)
+    {
+      auto const line{ next_line() };
+      if(line.is_none())
+      {
+        break;
+      }
+      lines.emplace_back(make_box<persistent_string>(jtl::immutable_string{ line.unwrap() }));
+    }
+
+    if(lines.empty())
+    {
+      return {};
+    }
+    return make_box<array_chunk>(jtl::move(lines), 0);
+  }
+
+  jtl::immutable_string_view file_reader::read_remaining()
+  {
+    auto const ret{ peek_remaining() };
+    offset = view.size();
+    return ret;
+  }
+
+  jtl::immutable_string_view file_reader::peek_remaining() const
+  {
+    if(closed)
+    {
+      throw std::runtime_error{ util::format("The reader for `{}` is already closed.",
+                                             view.file_path()) };
+    }
+
+    return { view.data() + offset, view.size() - offset };
+  }
+
+  void file_reader::close()
+  {
+    if(closed)
+    {
+      return;
+    }
+    /* Moving an empty view in unmaps the file. */
+    view = module::file_view{};
+    offset = 0;
+    closed = true;
+  }
+}
@@ -0,0 +1,76 @@
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  file_writer::file_writer(jtl::immutable_string const &path, bool const append)
+    : object{ obj_type, obj_behaviors }
+    , path{ path }
+    /* NOLINTNEXTLINE(cppcoreguidelines-owning-memory) */
+    , file{ std::fopen(path.c_str(), append ? "ab" : "wb") }
+  {
+    if(!file)
+    {
+      throw std::runtime_error{ util::format("Unable to open `{}` for writing: {}",
+                                             path,
+                                             std::strerror(errno)) };
+    }
+
+    /* stdio holds onto this until the stream is closed, which may not happen until exit, so
+     * it can't come from the GC. */
+    /* NOLINTNEXTLINE(cppcoreguidelines-no-malloc) */
+    buffer = static_cast<char *>(std::malloc(buffer_size));
+    if(buffer)
+    {
+      std::setvbuf(file, buffer, _IOFBF, buffer_size);
+    }
+  }
+
+  void file_writer::write(jtl::immutable_string_view const &s)
+  {
+    if(!file)
+    {
+      throw std::runtime_error{ util::format("The writer for `{}` is already closed.", path) };
+    }
+
+    if(std::fwrite(s.data(), 1, s.size(), file) != s.size())
+    {
+      throw std::runtime_error{ util::format("Unable to write to `{}`: {}",
+                                             path,
+                                             std::strerror(errno)) };
+    }
+  }
+
+  void file_writer::flush()
+  {
+    if(file)
+    {
+      std::fflush(file);
+    }
+  }
+
+  void file_writer::close()
+  {
+    if(!file)
+    {
+      return;
+    }
+
+    /* NOLINTNEXTLINE(cppcoreguidelines-owning-memory) */
+    auto const res{ std::fclose(file) };
+    file = nullptr;
+    /* NOLINTNEXTLINE(cppcoreguidelines-no-malloc) */
+    std::free(buffer);
+    buffer = nullptr;
+    if(res != 0)
+    {
+      throw std::runtime_error{ util::format("Unable to close `{}`: {}",
+                                             path,
+                                             std::strerror(errno)) };
+    }
+  }
+}
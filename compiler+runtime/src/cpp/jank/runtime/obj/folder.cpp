@@ -0,0 +1,11 @@
+#include <jank/runtime/obj/folder.hpp>
+
+namespace jank::runtime::obj
+{
+  folder::folder(object_ref const coll, object_ref const xform)
+    : object{ obj_type, obj_behaviors }
+    , coll{ coll }
+    , xform{ xform }
+  {
+  }
+}
@@ -15,6 +15,12 @@ namespace jank::runtime::obj
   {
   }
 
+  inst::inst(inst_time_point const &value)
+    : object{ obj_type, obj_behaviors }
+    , value{ value }
+  {
+  }
+
 #ifdef _LIBCPP_VERSION
   /* The current version of libc++ within LLVM does not implement
    * std::chrono::parse() (a C++20 feature). Until it is added or an alternative
@@ -1,4 +1,5 @@
 #include <jank/runtime/obj/integer_range.hpp>
+#include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/core/math.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/seq.hpp>
@@ -202,4 +203,19 @@ namespace jank::runtime::obj
 
     return static_cast<size_t>((diff + offset + s) / s);
   }
+
+  object_ref integer_range::reduce(object_ref const f, object_ref const init) const
+  {
+    object_ref res{ init };
+    auto n{ count() };
+    for(auto i{ start }; n > 0; i += step, --n)
+    {
+      res = f.call(res, make_box(i));
+      if(res.get_type() == object_type::reduced)
+      {
+        return expect_object<reduced>(res)->val;
+      }
+    }
+    return res;
+  }
 }
@@ -1,4 +1,3 @@
-#include <jank/runtime/obj/native_array_sequence.hpp>
 #include <jank/runtime/obj/jit_variadic_closure.hpp>
 #include <jank/runtime/obj/native_function_wrapper.hpp>
 #include <jank/runtime/obj/keyword.hpp>
@@ -75,7 +74,7 @@ namespace jank::runtime::obj
 
   object_ref jit_variadic_closure::call() const
   {
-    switch(arity_flags)
+    switch(arity_flags & ~variadic_rest_unused_flag)
     {
       case mask_variadic_arity(0):
         return do_call(arity_1, this, object_ref{});
@@ -92,7 +91,7 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1 }));
       case mask_variadic_arity(1):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -110,9 +109,9 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2 }));
       case mask_variadic_arity(2):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -131,11 +130,11 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3 }));
       case mask_variadic_arity(3):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -156,13 +155,13 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4 }));
       case mask_variadic_arity(4):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -184,15 +183,15 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4, a5));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4, a5));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5, this, a1, a2, a3, a4, make_box<obj::native_array_sequence>(a5));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5 }));
       case mask_variadic_arity(5):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -215,17 +214,17 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4, a5, a6));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5, a6));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5, this, a1, a2, a3, a4, make_box<obj::native_array_sequence>(a5, a6));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6, this, a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6 }));
       case mask_variadic_arity(6):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -249,54 +248,19 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1,
-                       this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2,
-                       this,
-                       a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3,
-                       this,
-                       a1,
-                       a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6, a7 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6, a7 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       make_box<obj::native_array_sequence>(a6, a7));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6, a7 }));
       case mask_variadic_arity(6):
-        return do_call(arity_7,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       make_box<obj::native_array_sequence>(a7));
+        return do_call(arity_7, this, a1, a2, a3, a4, a5, a6, pack_rest(arity_flags, { a7 }));
       case mask_variadic_arity(7):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -321,65 +285,21 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1,
-                       this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2,
-                       this,
-                       a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3,
-                       this,
-                       a1,
-                       a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6, a7, a8 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6, a7, a8 }));
       case mask_variadic_arity(6):
-        return do_call(arity_7,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       make_box<obj::native_array_sequence>(a7, a8));
+        return do_call(arity_7, this, a1, a2, a3, a4, a5, a6, pack_rest(arity_flags, { a7, a8 }));
       case mask_variadic_arity(7):
-        return do_call(arity_8,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       a7,
-                       make_box<obj::native_array_sequence>(a8));
+        return do_call(arity_8, this, a1, a2, a3, a4, a5, a6, a7, pack_rest(arity_flags, { a8 }));
       case mask_variadic_arity(8):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -407,25 +327,25 @@ namespace jank::runtime::obj
       case mask_variadic_arity(0):
         return do_call(arity_1,
                        this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(1):
         return do_call(arity_2,
                        this,
                        a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(2):
         return do_call(arity_3,
                        this,
                        a1,
                        a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(3):
         return do_call(arity_4,
                        this,
                        a1,
                        a2,
                        a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(4):
         return do_call(arity_5,
                        this,
@@ -433,7 +353,7 @@ namespace jank::runtime::obj
                        a2,
                        a3,
                        a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(5):
         return do_call(arity_6,
                        this,
@@ -442,7 +362,7 @@ namespace jank::runtime::obj
                        a3,
                        a4,
                        a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a6, a7, a8, a9 }));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -452,7 +372,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       make_box<obj::native_array_sequence>(a7, a8, a9));
+                       pack_rest(arity_flags, { a7, a8, a9 }));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -463,7 +383,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       make_box<obj::native_array_sequence>(a8, a9));
+                       pack_rest(arity_flags, { a8, a9 }));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -475,7 +395,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       make_box<obj::native_array_sequence>(a9));
+                       pack_rest(arity_flags, { a9 }));
       case mask_variadic_arity(9):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -502,28 +422,27 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(
-          arity_1,
-          this,
-          make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
+        return do_call(arity_1,
+                       this,
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(1):
         return do_call(arity_2,
                        this,
                        a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(2):
         return do_call(arity_3,
                        this,
                        a1,
                        a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(3):
         return do_call(arity_4,
                        this,
                        a1,
                        a2,
                        a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(4):
         return do_call(arity_5,
                        this,
@@ -531,7 +450,7 @@ namespace jank::runtime::obj
                        a2,
                        a3,
                        a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(5):
         return do_call(arity_6,
                        this,
@@ -540,7 +459,7 @@ namespace jank::runtime::obj
                        a3,
                        a4,
                        a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -550,7 +469,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       make_box<obj::native_array_sequence>(a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a7, a8, a9, a10 }));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -561,7 +480,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       make_box<obj::native_array_sequence>(a8, a9, a10));
+                       pack_rest(arity_flags, { a8, a9, a10 }));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -573,7 +492,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       make_box<obj::native_array_sequence>(a9, a10));
+                       pack_rest(arity_flags, { a9, a10 }));
       case mask_variadic_arity(9):
         return do_call(arity_10,
                        this,
@@ -586,7 +505,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       make_box<obj::native_array_sequence>(a10));
+                       pack_rest(arity_flags, { a10 }));
       case mask_variadic_arity(10):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -601,7 +520,7 @@ namespace jank::runtime::obj
                          a7,
                          a8,
                          a9,
-                         make_box<obj::native_array_sequence>(a10));
+                         pack_rest(arity_flags, { a10 }));
         }
       default:
         return do_call(arity_10, this, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
@@ -622,57 +541,47 @@ namespace jank::runtime::obj
   {
     auto const mask(extract_variadic_arity_mask(arity_flags));
 
-    static auto const concat{ __rt_ctx->intern_var("clojure.core/concat*").expect_ok()->deref() };
-
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(
-          arity_1,
-          this,
-          concat.call(make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10),
-                      more));
+        return do_call(arity_1,
+                       this,
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(1):
-        return do_call(
-          arity_2,
-          this,
-          a1,
-          concat.call(make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9, a10),
-                      more));
+        return do_call(arity_2,
+                       this,
+                       a1,
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(2):
-        return do_call(
-          arity_3,
-          this,
-          a1,
-          a2,
-          concat.call(make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_3,
+                       this,
+                       a1,
+                       a2,
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(3):
-        return do_call(
-          arity_4,
-          this,
-          a1,
-          a2,
-          a3,
-          concat.call(make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_4,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(4):
-        return do_call(
-          arity_5,
-          this,
-          a1,
-          a2,
-          a3,
-          a4,
-          concat.call(make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_5,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       a4,
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(5):
-        return do_call(
-          arity_6,
-          this,
-          a1,
-          a2,
-          a3,
-          a4,
-          a5,
-          concat.call(make_box<obj::native_array_sequence>(a6, a7, a8, a9, a10), more));
+        return do_call(arity_6,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       a4,
+                       a5,
+                       pack_rest(arity_flags, { a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -682,7 +591,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       concat.call(make_box<obj::native_array_sequence>(a7, a8, a9, a10), more));
+                       pack_rest(arity_flags, { a7, a8, a9, a10 }, more));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -693,7 +602,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       concat.call(make_box<obj::native_array_sequence>(a8, a9, a10), more));
+                       pack_rest(arity_flags, { a8, a9, a10 }, more));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -705,7 +614,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       concat.call(make_box<obj::native_array_sequence>(a9, a10), more));
+                       pack_rest(arity_flags, { a9, a10 }, more));
       case mask_variadic_arity(9):
         return do_call(arity_10,
                        this,
@@ -718,7 +627,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       concat.call(make_box<obj::native_array_sequence>(a10), more));
+                       pack_rest(arity_flags, { a10 }, more));
       case mask_variadic_arity(10):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -733,7 +642,7 @@ namespace jank::runtime::obj
                          a7,
                          a8,
                          a9,
-                         concat.call(make_box<obj::native_array_sequence>(a10), more));
+                         pack_rest(arity_flags, { a10 }, more));
         }
       default:
         return do_call(arity_10,
@@ -747,7 +656,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       concat.call(make_box<obj::native_array_sequence>(a10), more));
+                       pack_rest(arity_flags, { a10 }, more));
     }
   }
 }
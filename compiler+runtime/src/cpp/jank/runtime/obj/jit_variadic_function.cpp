@@ -3,7 +3,6 @@
 #include <jank/runtime/obj/nil.hpp>
 #include <jank/runtime/obj/persistent_string.hpp>
 #include <jank/runtime/obj/keyword.hpp>
-#include <jank/runtime/obj/native_array_sequence.hpp>
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/call.hpp>
 #include <jank/runtime/context.hpp>
@@ -73,7 +72,7 @@ namespace jank::runtime::obj
 
   object_ref jit_variadic_function::call() const
   {
-    switch(arity_flags)
+    switch(arity_flags & ~variadic_rest_unused_flag)
     {
       case mask_variadic_arity(0):
         return do_call(arity_1, this, object_ref{});
@@ -90,7 +89,7 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1 }));
       case mask_variadic_arity(1):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -108,9 +107,9 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2 }));
       case mask_variadic_arity(2):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -129,11 +128,11 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3 }));
       case mask_variadic_arity(3):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -154,13 +153,13 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4 }));
       case mask_variadic_arity(4):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -182,15 +181,15 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4, a5));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4, a5));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5, this, a1, a2, a3, a4, make_box<obj::native_array_sequence>(a5));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5 }));
       case mask_variadic_arity(5):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -213,17 +212,17 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1, this, make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2, this, a1, make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3, this, a1, a2, make_box<obj::native_array_sequence>(a3, a4, a5, a6));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4, this, a1, a2, a3, make_box<obj::native_array_sequence>(a4, a5, a6));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5, this, a1, a2, a3, a4, make_box<obj::native_array_sequence>(a5, a6));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6, this, a1, a2, a3, a4, a5, make_box<obj::native_array_sequence>(a6));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6 }));
       case mask_variadic_arity(6):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -247,54 +246,19 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1,
-                       this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2,
-                       this,
-                       a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3,
-                       this,
-                       a1,
-                       a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6, a7 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6, a7 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6, a7 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       make_box<obj::native_array_sequence>(a6, a7));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6, a7 }));
       case mask_variadic_arity(6):
-        return do_call(arity_7,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       make_box<obj::native_array_sequence>(a7));
+        return do_call(arity_7, this, a1, a2, a3, a4, a5, a6, pack_rest(arity_flags, { a7 }));
       case mask_variadic_arity(7):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -319,65 +283,21 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(arity_1,
-                       this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8));
+        return do_call(arity_1, this, pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(1):
-        return do_call(arity_2,
-                       this,
-                       a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8));
+        return do_call(arity_2, this, a1, pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(2):
-        return do_call(arity_3,
-                       this,
-                       a1,
-                       a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8));
+        return do_call(arity_3, this, a1, a2, pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(3):
-        return do_call(arity_4,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8));
+        return do_call(arity_4, this, a1, a2, a3, pack_rest(arity_flags, { a4, a5, a6, a7, a8 }));
       case mask_variadic_arity(4):
-        return do_call(arity_5,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8));
+        return do_call(arity_5, this, a1, a2, a3, a4, pack_rest(arity_flags, { a5, a6, a7, a8 }));
       case mask_variadic_arity(5):
-        return do_call(arity_6,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8));
+        return do_call(arity_6, this, a1, a2, a3, a4, a5, pack_rest(arity_flags, { a6, a7, a8 }));
       case mask_variadic_arity(6):
-        return do_call(arity_7,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       make_box<obj::native_array_sequence>(a7, a8));
+        return do_call(arity_7, this, a1, a2, a3, a4, a5, a6, pack_rest(arity_flags, { a7, a8 }));
       case mask_variadic_arity(7):
-        return do_call(arity_8,
-                       this,
-                       a1,
-                       a2,
-                       a3,
-                       a4,
-                       a5,
-                       a6,
-                       a7,
-                       make_box<obj::native_array_sequence>(a8));
+        return do_call(arity_8, this, a1, a2, a3, a4, a5, a6, a7, pack_rest(arity_flags, { a8 }));
       case mask_variadic_arity(8):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -405,25 +325,25 @@ namespace jank::runtime::obj
       case mask_variadic_arity(0):
         return do_call(arity_1,
                        this,
-                       make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(1):
         return do_call(arity_2,
                        this,
                        a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(2):
         return do_call(arity_3,
                        this,
                        a1,
                        a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(3):
         return do_call(arity_4,
                        this,
                        a1,
                        a2,
                        a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(4):
         return do_call(arity_5,
                        this,
@@ -431,7 +351,7 @@ namespace jank::runtime::obj
                        a2,
                        a3,
                        a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9 }));
       case mask_variadic_arity(5):
         return do_call(arity_6,
                        this,
@@ -440,7 +360,7 @@ namespace jank::runtime::obj
                        a3,
                        a4,
                        a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8, a9));
+                       pack_rest(arity_flags, { a6, a7, a8, a9 }));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -450,7 +370,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       make_box<obj::native_array_sequence>(a7, a8, a9));
+                       pack_rest(arity_flags, { a7, a8, a9 }));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -461,7 +381,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       make_box<obj::native_array_sequence>(a8, a9));
+                       pack_rest(arity_flags, { a8, a9 }));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -473,7 +393,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       make_box<obj::native_array_sequence>(a9));
+                       pack_rest(arity_flags, { a9 }));
       case mask_variadic_arity(9):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -500,28 +420,27 @@ namespace jank::runtime::obj
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(
-          arity_1,
-          this,
-          make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
+        return do_call(arity_1,
+                       this,
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(1):
         return do_call(arity_2,
                        this,
                        a1,
-                       make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(2):
         return do_call(arity_3,
                        this,
                        a1,
                        a2,
-                       make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(3):
         return do_call(arity_4,
                        this,
                        a1,
                        a2,
                        a3,
-                       make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(4):
         return do_call(arity_5,
                        this,
@@ -529,7 +448,7 @@ namespace jank::runtime::obj
                        a2,
                        a3,
                        a4,
-                       make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(5):
         return do_call(arity_6,
                        this,
@@ -538,7 +457,7 @@ namespace jank::runtime::obj
                        a3,
                        a4,
                        a5,
-                       make_box<obj::native_array_sequence>(a6, a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a6, a7, a8, a9, a10 }));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -548,7 +467,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       make_box<obj::native_array_sequence>(a7, a8, a9, a10));
+                       pack_rest(arity_flags, { a7, a8, a9, a10 }));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -559,7 +478,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       make_box<obj::native_array_sequence>(a8, a9, a10));
+                       pack_rest(arity_flags, { a8, a9, a10 }));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -571,7 +490,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       make_box<obj::native_array_sequence>(a9, a10));
+                       pack_rest(arity_flags, { a9, a10 }));
       case mask_variadic_arity(9):
         return do_call(arity_10,
                        this,
@@ -584,7 +503,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       make_box<obj::native_array_sequence>(a10));
+                       pack_rest(arity_flags, { a10 }));
       case mask_variadic_arity(10):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -599,7 +518,7 @@ namespace jank::runtime::obj
                          a7,
                          a8,
                          a9,
-                         make_box<obj::native_array_sequence>(a10));
+                         pack_rest(arity_flags, { a10 }));
         }
       default:
         return do_call(arity_10, this, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
@@ -620,57 +539,47 @@ namespace jank::runtime::obj
   {
     auto const mask(extract_variadic_arity_mask(arity_flags));
 
-    static auto const concat{ __rt_ctx->intern_var("clojure.core/concat*").expect_ok()->deref() };
-
     switch(mask)
     {
       case mask_variadic_arity(0):
-        return do_call(
-          arity_1,
-          this,
-          concat.call(make_box<obj::native_array_sequence>(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10),
-                      more));
+        return do_call(arity_1,
+                       this,
+                       pack_rest(arity_flags, { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(1):
-        return do_call(
-          arity_2,
-          this,
-          a1,
-          concat.call(make_box<obj::native_array_sequence>(a2, a3, a4, a5, a6, a7, a8, a9, a10),
-                      more));
+        return do_call(arity_2,
+                       this,
+                       a1,
+                       pack_rest(arity_flags, { a2, a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(2):
-        return do_call(
-          arity_3,
-          this,
-          a1,
-          a2,
-          concat.call(make_box<obj::native_array_sequence>(a3, a4, a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_3,
+                       this,
+                       a1,
+                       a2,
+                       pack_rest(arity_flags, { a3, a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(3):
-        return do_call(
-          arity_4,
-          this,
-          a1,
-          a2,
-          a3,
-          concat.call(make_box<obj::native_array_sequence>(a4, a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_4,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       pack_rest(arity_flags, { a4, a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(4):
-        return do_call(
-          arity_5,
-          this,
-          a1,
-          a2,
-          a3,
-          a4,
-          concat.call(make_box<obj::native_array_sequence>(a5, a6, a7, a8, a9, a10), more));
+        return do_call(arity_5,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       a4,
+                       pack_rest(arity_flags, { a5, a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(5):
-        return do_call(
-          arity_6,
-          this,
-          a1,
-          a2,
-          a3,
-          a4,
-          a5,
-          concat.call(make_box<obj::native_array_sequence>(a6, a7, a8, a9, a10), more));
+        return do_call(arity_6,
+                       this,
+                       a1,
+                       a2,
+                       a3,
+                       a4,
+                       a5,
+                       pack_rest(arity_flags, { a6, a7, a8, a9, a10 }, more));
       case mask_variadic_arity(6):
         return do_call(arity_7,
                        this,
@@ -680,7 +589,7 @@ namespace jank::runtime::obj
                        a4,
                        a5,
                        a6,
-                       concat.call(make_box<obj::native_array_sequence>(a7, a8, a9, a10), more));
+                       pack_rest(arity_flags, { a7, a8, a9, a10 }, more));
       case mask_variadic_arity(7):
         return do_call(arity_8,
                        this,
@@ -691,7 +600,7 @@ namespace jank::runtime::obj
                        a5,
                        a6,
                        a7,
-                       concat.call(make_box<obj::native_array_sequence>(a8, a9, a10), more));
+                       pack_rest(arity_flags, { a8, a9, a10 }, more));
       case mask_variadic_arity(8):
         return do_call(arity_9,
                        this,
@@ -703,7 +612,7 @@ namespace jank::runtime::obj
                        a6,
                        a7,
                        a8,
-                       concat.call(make_box<obj::native_array_sequence>(a9, a10), more));
+                       pack_rest(arity_flags, { a9, a10 }, more));
       case mask_variadic_arity(9):
         return do_call(arity_10,
                        this,
@@ -716,7 +625,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       concat.call(make_box<obj::native_array_sequence>(a10), more));
+                       pack_rest(arity_flags, { a10 }, more));
       case mask_variadic_arity(10):
         if(!is_variadic_ambiguous(arity_flags))
         {
@@ -731,7 +640,7 @@ namespace jank::runtime::obj
                          a7,
                          a8,
                          a9,
-                         concat.call(make_box<obj::native_array_sequence>(a10), more));
+                         pack_rest(arity_flags, { a10 }, more));
         }
       default:
         return do_call(arity_10,
@@ -745,7 +654,7 @@ namespace jank::runtime::obj
                        a7,
                        a8,
                        a9,
-                       concat.call(make_box<obj::native_array_sequence>(a10), more));
+                       pack_rest(arity_flags, { a10 }, more));
     }
   }
 }
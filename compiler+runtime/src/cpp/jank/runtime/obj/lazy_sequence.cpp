@@ -7,6 +7,7 @@
 #include <jank/runtime/rtti.hpp>
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/to_string.hpp>
+#include <jank/runtime/detail/fiber.hpp>
 #include <jank/util/fmt/print.hpp>
 
 namespace jank::runtime::obj
@@ -19,6 +20,7 @@ namespace jank::runtime::obj
   lazy_sequence::lazy_sequence(object_ref const fn)
     : object{ obj_type, obj_behaviors }
     , fn{ fn }
+    , state{ realization_state::unrealized }
   {
     jank_debug_assert(fn.is_some());
   }
@@ -27,12 +29,12 @@ namespace jank::runtime::obj
     : object{ obj_type, obj_behaviors }
     , fn{ fn }
     , s{ sequence }
+    , state{ fn.is_some() ? realization_state::unrealized : realization_state::realized }
   {
   }
 
   object_ref lazy_sequence::seq() const
   {
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
     return realize();
   }
 
@@ -44,8 +46,7 @@ namespace jank::runtime::obj
       return {};
     }
 
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    auto const r(s.fresh_seq());
+    auto const r(ret.fresh_seq());
     jank_debug_assert(r.is_some());
     return make_box<lazy_sequence>(jank_nil, r);
   }
@@ -57,9 +58,7 @@ namespace jank::runtime::obj
     {
       return ret;
     }
-
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    return runtime::first(s);
+    return runtime::first(ret);
   }
 
   object_ref lazy_sequence::next() const
@@ -69,10 +68,7 @@ namespace jank::runtime::obj
     {
       return {};
     }
-
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    auto const n(runtime::next(s));
-    return n;
+    return runtime::next(ret);
   }
 
   bool lazy_sequence::equal(object const &o) const
@@ -112,58 +108,147 @@ namespace jank::runtime::obj
 
   object_ref lazy_sequence::realize() const
   {
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    force();
-    if(sv.is_some())
+    if(state.load(std::memory_order_acquire) == realization_state::realized)
     {
-      auto ls{ sv };
-      sv = jank_nil;
-      if(ls.is_some() && ls.get_type() == object_type::lazy_sequence)
-      {
-        ls = unwrap(ls);
-      }
-      s = ls.seq();
+      return s;
     }
-    return s;
+    return realize_slow();
   }
 
-  /* XXX: Must be locked when called. */
-  void lazy_sequence::force() const
+  /* Each thread keeps a stack of the lazy sequences it's realizing, so that a sequence which
+   * needs itself in order to be realized is an error, rather than a deadlock. The frames live
+   * on the stack of `realize_slow`. */
+  struct realization_frame
   {
-    if(fn.is_some())
+    lazy_sequence const *head{};
+    realization_frame const *prev{};
+  };
+
+  static thread_local realization_frame const *current_frame{};
+
+  static bool is_realizing_on_this_thread(lazy_sequence const * const ls)
+  {
+    for(auto frame{ current_frame }; frame != nullptr; frame = frame->prev)
     {
-      sv = fn.call();
-      fn = jank_nil;
+      for(auto cell{ frame->head };;)
+      {
+        if(cell == ls)
+        {
+          return true;
+        }
+        if(cell->s.get_type() != object_type::lazy_sequence)
+        {
+          break;
+        }
+        cell = expect_object<lazy_sequence>(cell->s).data;
+      }
     }
+    return false;
   }
 
-  object_ref lazy_sequence::sval() const
+  /* Moves this sequence from unrealized to realizing, waiting on any other thread which is
+   * realizing it. Returns false if it's already realized. */
+  bool lazy_sequence::claim() const
   {
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    if(fn.is_some())
+    auto expected{ realization_state::unrealized };
+    while(!state.compare_exchange_weak(expected,
+                                       realization_state::realizing,
+                                       std::memory_order_acquire))
     {
-      force();
+      if(expected == realization_state::realized)
+      {
+        return false;
+      }
+      if(expected == realization_state::realizing)
+      {
+        if(is_realizing_on_this_thread(this))
+        {
+          throw std::runtime_error{ "A lazy sequence depends on its own realization." };
+        }
+        state.wait(realization_state::realizing, std::memory_order_acquire);
+      }
+      expected = realization_state::unrealized;
     }
-    if(sv.is_some())
+    return true;
+  }
+
+  /* Ends the realization of this sequence and of each nested sequence claimed along with it,
+   * up to `tail`. If realization failed, they go back to being unrealized, so that the next
+   * access tries again. */
+  void lazy_sequence::publish(lazy_sequence const * const tail,
+                              object_ref const result,
+                              realization_state const to) const
+  {
+    for(auto cell{ this };;)
     {
-      return sv;
+      auto const next{ cell == tail ? nullptr : expect_object<lazy_sequence>(cell->s).data };
+      cell->s = result;
+      if(to == realization_state::realized)
+      {
+        cell->fn = jank_nil;
+      }
+      cell->state.store(to, std::memory_order_release);
+      cell->state.notify_all();
+      if(next == nullptr)
+      {
+        break;
+      }
+      cell = next;
     }
-    return s;
   }
 
-  object_ref lazy_sequence::unwrap(object_ref ls) const
+  object_ref lazy_sequence::realize_slow() const
   {
-    while(ls.is_some() && ls.get_type() == object_type::lazy_sequence)
+    if(!claim())
+    {
+      return s;
+    }
+
+    realization_frame const frame{ this, current_frame };
+    current_frame = &frame;
+    /* The frames are thread local, so we can't move threads until we're done. */
+    runtime::detail::fiber::pin_scope const pin;
+
+    /* A lazy sequence may give back another lazy sequence, which may give back another and so
+     * on. Rather than realizing each of those recursively, we claim them as we go and they
+     * all end up with the same seq. Claimed sequences are linked through `s` until then. */
+    auto tail{ this };
+    object_ref ret;
+    try
     {
-      ls = expect_object<lazy_sequence>(ls)->sval();
+      auto ls{ fn.call() };
+      while(ls.is_some() && ls.get_type() == object_type::lazy_sequence)
+      {
+        auto const inner{ expect_object<lazy_sequence>(ls) };
+        if(!inner->claim())
+        {
+          ls = inner->s;
+          break;
+        }
+        tail->s = ls;
+        tail = inner.data;
+        ls = inner->fn.call();
+      }
+      if(ls.is_some())
+      {
+        ret = ls.seq();
+      }
     }
-    return ls;
+    catch(...)
+    {
+      current_frame = frame.prev;
+      publish(tail, jank_nil, realization_state::unrealized);
+      throw;
+    }
+
+    current_frame = frame.prev;
+    publish(tail, ret, realization_state::realized);
+    return ret;
   }
 
   bool lazy_sequence::is_realized() const
   {
-    std::lock_guard<std::recursive_mutex> const lock{ mutex };
-    return fn.is_nil() || sv.is_some();
+    return state.load(std::memory_order_acquire) == realization_state::realized;
   }
 
   lazy_sequence_ref lazy_sequence::with_meta(object_ref const m) const
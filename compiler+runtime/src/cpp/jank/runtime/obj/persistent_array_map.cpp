@@ -1,5 +1,6 @@
 #include <jank/runtime/obj/persistent_array_map.hpp>
 #include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_shape_map.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/transient_array_map.hpp>
 #include <jank/runtime/obj/transient_hash_map.hpp>
@@ -78,6 +79,12 @@ namespace jank::runtime::obj
      * TODO: Benchmark if it's faster to have this behavior or to check first. */
     if(data.size() == runtime::detail::native_array_map::max_size)
     {
+      /* Maps with only keyword keys are usually records of some sort, which keep growing
+       * with the same keys. Shape maps keep lookups on those cheap. */
+      if(persistent_shape_map::can_hold(data, key))
+      {
+        return persistent_shape_map::create(meta, data, key, val);
+      }
       return make_box<persistent_hash_map>(meta, data, key, val);
     }
     else
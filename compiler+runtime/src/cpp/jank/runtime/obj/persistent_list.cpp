@@ -1,4 +1,5 @@
 #include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/seq_ext.hpp>
@@ -116,6 +117,20 @@ namespace jank::runtime::obj
     return data.size();
   }
 
+  object_ref persistent_list::reduce(object_ref const f, object_ref const init) const
+  {
+    object_ref res{ init };
+    for(auto const &e : data)
+    {
+      res = f.call(res, e);
+      if(res.get_type() == object_type::reduced)
+      {
+        return expect_object<reduced>(res)->val;
+      }
+    }
+    return res;
+  }
+
   persistent_list_ref persistent_list::conj(object_ref const head) const
   {
     auto l(data.conj(head));
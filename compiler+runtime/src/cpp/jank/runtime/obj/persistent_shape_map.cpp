@@ -0,0 +1,190 @@
+#include <jank/runtime/obj/persistent_shape_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/transient_hash_map.hpp>
+#include <jank/runtime/obj/nil.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+
+namespace jank::runtime::obj
+{
+  persistent_shape_map::persistent_shape_map(value_type &&d)
+    : data{ std::move(d) }
+  {
+  }
+
+  persistent_shape_map::persistent_shape_map(value_type const &d)
+    : data{ d }
+  {
+  }
+
+  persistent_shape_map::persistent_shape_map(object_ref const meta, value_type &&d)
+    : parent_type{ meta }
+    , data{ std::move(d) }
+  {
+  }
+
+  persistent_shape_map::persistent_shape_map(lazy_meta const &meta, value_type &&d)
+    : parent_type{ meta }
+    , data{ std::move(d) }
+  {
+  }
+
+  bool persistent_shape_map::can_hold(object_ref const * const kvs, usize const length)
+  {
+    if(length > max_size * 2)
+    {
+      return false;
+    }
+    for(usize i{}; i < length; i += 2)
+    {
+      if(kvs[i].get_type() != object_type::keyword)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool persistent_shape_map::can_hold(runtime::detail::native_array_map const &m,
+                                      object_ref const key)
+  {
+    return key.get_type() == object_type::keyword && can_hold(m.data, m.length);
+  }
+
+  persistent_shape_map_ref persistent_shape_map::create_unique(object_ref const meta,
+                                                               object_ref const * const kvs,
+                                                               usize const length)
+  {
+    jank_debug_assert(can_hold(kvs, length));
+
+    auto shape{ runtime::detail::map_shape::root() };
+    auto const values{ make_array_box<object_ref>(length / 2) };
+    for(usize i{}; i < length; i += 2)
+    {
+      if(shape->index_of(kvs[i]) >= 0)
+      {
+        throw std::runtime_error{ util::format("Duplicate key: {}", kvs[i].to_code_string()) };
+      }
+      shape = shape->with_key(kvs[i]);
+      values.data[i / 2] = kvs[i + 1];
+    }
+    return make_box<persistent_shape_map>(meta, value_type{ shape, values.data });
+  }
+
+  persistent_shape_map_ref persistent_shape_map::create(lazy_meta const &meta,
+                                                        runtime::detail::native_array_map const &m,
+                                                        object_ref const key,
+                                                        object_ref const val)
+  {
+    jank_debug_assert(can_hold(m, key));
+
+    auto shape{ runtime::detail::map_shape::root() };
+    auto const values{ make_array_box<object_ref>(m.size() + 1) };
+    u8 size{};
+    for(auto const &e : m)
+    {
+      shape = shape->with_key(e.first);
+      values.data[size++] = e.first == key ? val : e.second;
+    }
+    if(shape->index_of(key) < 0)
+    {
+      shape = shape->with_key(key);
+      values.data[size] = val;
+    }
+    return make_box<persistent_shape_map>(meta, value_type{ shape, values.data });
+  }
+
+  object_ref persistent_shape_map::find(object_ref const key) const
+  {
+    auto const res(data.find(key));
+    if(res.is_some())
+    {
+      return make_box<persistent_vector>(std::in_place, key, res.unwrap());
+    }
+    return {};
+  }
+
+  bool persistent_shape_map::contains(object_ref const key) const
+  {
+    return data.shape->index_of(key) >= 0;
+  }
+
+  object_ref persistent_shape_map::assoc(object_ref const key, object_ref const val) const
+  {
+    auto const size{ data.size() };
+    auto const slot{ data.shape->index_of(key) };
+
+    /* Updating an existing key keeps the shape, so only the values are copied. */
+    if(slot >= 0)
+    {
+      auto const values{ make_array_box<object_ref>(size) };
+      std::copy(data.values, data.values + size, values.data);
+      values.data[slot] = val;
+      return make_box<persistent_shape_map>(meta, value_type{ data.shape, values.data });
+    }
+
+    if(key.get_type() == object_type::keyword && size < max_size)
+    {
+      auto const values{ make_array_box<object_ref>(size + 1) };
+      std::copy(data.values, data.values + size, values.data);
+      values.data[size] = val;
+      return make_box<persistent_shape_map>(
+        meta,
+        value_type{ data.shape->with_key(key), values.data });
+    }
+
+    runtime::detail::native_transient_hash_map transient;
+    for(auto const &e : data)
+    {
+      transient.set(e.first, e.second);
+    }
+    transient.set(key, val);
+    return make_box<persistent_hash_map>(meta, transient.persistent());
+  }
+
+  persistent_shape_map_ref persistent_shape_map::dissoc(object_ref const key) const
+  {
+    auto const slot{ data.shape->index_of(key) };
+    if(slot < 0)
+    {
+      return this;
+    }
+
+    /* The remaining keys keep their order, so maps which drop the same key still end up
+     * sharing a shape. */
+    auto shape{ runtime::detail::map_shape::root() };
+    auto const values{ make_array_box<object_ref>(data.size() - 1) };
+    u8 size{};
+    for(u8 i{}; i < data.size(); ++i)
+    {
+      if(i == slot)
+      {
+        continue;
+      }
+      shape = shape->with_key(data.shape->keys[i]);
+      values.data[size++] = data.values[i];
+    }
+    return make_box<persistent_shape_map>(meta, value_type{ shape, values.data });
+  }
+
+  object_ref persistent_shape_map::call(object_ref const o) const
+  {
+    return get(o);
+  }
+
+  object_ref persistent_shape_map::call(object_ref const o, object_ref const fallback) const
+  {
+    return get(o, fallback);
+  }
+
+  transient_hash_map_ref persistent_shape_map::to_transient() const
+  {
+    runtime::detail::native_transient_hash_map transient;
+    for(auto const &e : data)
+    {
+      transient.set(e.first, e.second);
+    }
+    return make_box<transient_hash_map>(std::move(transient));
+  }
+}
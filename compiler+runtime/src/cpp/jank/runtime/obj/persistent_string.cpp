@@ -84,7 +84,7 @@ namespace jank::runtime::obj
       {
         return fallback;
       }
-      return make_box<character>(data[i]);
+      return character::create(data[i]);
     }
     else
     {
@@ -115,7 +115,7 @@ namespace jank::runtime::obj
           util::format("The index `{}` is out of bounds for this `persistent_string`.", i)
         };
       }
-      return make_box<character>(data[i]);
+      return character::create(data[i]);
     }
     else
     {
@@ -101,7 +101,7 @@ namespace jank::runtime::obj
   object_ref persistent_string_sequence::first() const
   {
     auto const size(jtl::next_char_size(str->data, index));
-    return make_box<character>(str->data.substr(index, size));
+    return character::create(jtl::immutable_string_view{ str->data.data() + index, size });
   }
 
   object_ref persistent_string_sequence::next() const
@@ -1,5 +1,6 @@
 #include <jank/runtime/obj/persistent_vector.hpp>
 #include <jank/runtime/obj/transient_vector.hpp>
+#include <jank/runtime/obj/reduced.hpp>
 #include <jank/runtime/visit.hpp>
 #include <jank/runtime/core/equal.hpp>
 #include <jank/runtime/core/seq.hpp>
@@ -191,6 +192,35 @@ namespace jank::runtime::obj
     return make_box<transient_vector>(data);
   }
 
+  object_ref persistent_vector::kv_reduce(object_ref const f, object_ref const init) const
+  {
+    object_ref res{ init };
+    usize i{};
+    for(auto const &e : data)
+    {
+      res = f.call(res, make_box(i++), e);
+      if(res.get_type() == object_type::reduced)
+      {
+        return expect_object<reduced>(res)->val;
+      }
+    }
+    return res;
+  }
+
+  object_ref persistent_vector::reduce(object_ref const f, object_ref const init) const
+  {
+    object_ref res{ init };
+    for(auto const &e : data)
+    {
+      res = f.call(res, e);
+      if(res.get_type() == object_type::reduced)
+      {
+        return expect_object<reduced>(res)->val;
+      }
+    }
+    return res;
+  }
+
   persistent_vector_ref persistent_vector::with_meta(object_ref const m) const
   {
     auto const meta(behavior::detail::validate_meta(m));
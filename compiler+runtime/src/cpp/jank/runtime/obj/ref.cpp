@@ -0,0 +1,126 @@
+#include <jank/runtime/obj/ref.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/detail/transaction.hpp>
+
+namespace jank::runtime::obj
+{
+  static std::atomic<u64> next_id{};
+
+  ref::ref(object_ref const o)
+    : object{ obj_type, obj_behaviors }
+    , id{ next_id.fetch_add(1) }
+    , watches{ persistent_hash_map::empty() }
+  {
+    history.push_front({ o, 0 });
+  }
+
+  object_ref ref::deref()
+  {
+    auto const tx{ runtime::detail::transaction::current() };
+    if(tx)
+    {
+      return tx->get(this);
+    }
+    return current_val();
+  }
+
+  object_ref ref::with_meta(object_ref const)
+  {
+    throw std::runtime_error{ "Objects of type `ref` do not support `with-meta`." };
+  }
+
+  object_ref ref::get_meta() const
+  {
+    return meta.get();
+  }
+
+  void ref::set_meta(object_ref const o)
+  {
+    auto const new_meta(behavior::detail::validate_meta(o));
+    meta.set(new_meta);
+  }
+
+  static void do_validate(object_ref const vf, object_ref const val)
+  {
+    if(vf.is_some() && !truthy(vf.call(val)))
+    {
+      throw std::runtime_error{ "The `ref` validator rejected the provided value." };
+    }
+  }
+
+  void ref::set_validator(object_ref const vf)
+  {
+    do_validate(vf, current_val());
+    auto locked_validator(validator.wlock());
+    *locked_validator = vf;
+  }
+
+  object_ref ref::get_validator() const
+  {
+    auto const locked_validator(validator.rlock());
+    return *locked_validator;
+  }
+
+  void ref::add_watch(object_ref const key, object_ref const fn)
+  {
+    auto locked_watches(watches.wlock());
+    *locked_watches = (*locked_watches)->assoc(key, fn);
+  }
+
+  void ref::remove_watch(object_ref const key)
+  {
+    auto locked_watches(watches.wlock());
+    *locked_watches = (*locked_watches)->dissoc(key);
+  }
+
+  void ref::validate(object_ref const val)
+  {
+    auto const locked_validator(validator.rlock());
+    do_validate(*locked_validator, val);
+  }
+
+  void ref::notify_watches(object_ref const old_val, object_ref const new_val)
+  {
+    auto const locked_watches(watches.rlock());
+    for(auto const &entry : (*locked_watches)->data)
+    {
+      auto const fn(entry.second);
+      if(fn.is_some())
+      {
+        fn.call(entry.first, runtime::detail::untagged(this), old_val, new_val);
+      }
+    }
+  }
+
+  object_ref ref::current_val()
+  {
+    std::shared_lock<std::shared_timed_mutex> const l{ lock };
+    return history.front().val;
+  }
+
+  usize ref::history_count()
+  {
+    std::shared_lock<std::shared_timed_mutex> const l{ lock };
+    return history.size() - 1;
+  }
+
+  void ref::commit(object_ref const val, u64 const point)
+  {
+    auto const count{ history.size() - 1 };
+    if((faults.load() > 0 && count < max_history.load()) || count < min_history.load())
+    {
+      faults.store(0);
+    }
+    else
+    {
+      /* Recycle the oldest value. This also trims the history down, if the max was
+       * lowered since. */
+      history.pop_back();
+      while(!history.empty() && history.size() > max_history.load())
+      {
+        history.pop_back();
+      }
+    }
+    history.push_front({ val, point });
+  }
+}
@@ -0,0 +1,128 @@
+#include <jank/runtime/obj/string_rope.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/sequence_range.hpp>
+
+namespace jank::runtime::obj
+{
+  string_rope::string_rope()
+    : object{ obj_type, obj_behaviors }
+  {
+  }
+
+  string_rope::string_rope(jtl::immutable_string const &piece)
+    : object{ obj_type, obj_behaviors }
+    , piece{ piece }
+    , size{ piece.size() }
+  {
+  }
+
+  string_rope::string_rope(string_rope_ref const prev, jtl::immutable_string const &piece)
+    : object{ obj_type, obj_behaviors }
+    , prev{ prev }
+    , piece{ piece }
+    , size{ prev->size + piece.size() }
+  {
+  }
+
+  bool string_rope::equal(object const &o) const
+  {
+    if(o.type != object_type::string_rope)
+    {
+      return false;
+    }
+
+    auto const r(expect_object<string_rope>(runtime::detail::untagged(&o)));
+    return size == r->size && flatten()->data == r->flatten()->data;
+  }
+
+  jtl::immutable_string string_rope::to_string() const
+  {
+    return flatten()->data;
+  }
+
+  void string_rope::to_string(jtl::string_builder &buff) const
+  {
+    buff(flatten()->data);
+  }
+
+  jtl::immutable_string string_rope::to_code_string() const
+  {
+    return flatten()->to_code_string();
+  }
+
+  uhash string_rope::to_hash() const
+  {
+    return flatten()->to_hash();
+  }
+
+  usize string_rope::count() const
+  {
+    return size;
+  }
+
+  string_rope_ref string_rope::append(object_ref const args) const
+  {
+    jtl::string_builder buff;
+    for(auto const &e : make_sequence_range(args))
+    {
+      if(e.is_nil())
+      {
+        continue;
+      }
+      e.to_string(buff);
+    }
+
+    if(buff.empty())
+    {
+      return this;
+    }
+    return make_box<string_rope>(this, buff.release());
+  }
+
+  persistent_string_ref string_rope::flatten() const
+  {
+    if(auto const existing{ flattened.load(std::memory_order_acquire) }; existing)
+    {
+      return existing;
+    }
+
+    /* Walk back to the closest rope which has already been flattened, if any. Everything
+     * after it is then copied once, front to back. */
+    native_vector<string_rope const *> pending;
+    string_rope const *base{};
+    for(string_rope const *node{ this }; node;)
+    {
+      if(node->flattened.load(std::memory_order_acquire))
+      {
+        base = node;
+        break;
+      }
+      pending.push_back(node);
+      node = node->prev.is_some() ? node->prev.ptr() : nullptr;
+    }
+
+    jtl::string_builder buff;
+    buff.reserve(size);
+    if(base)
+    {
+      buff(base->flattened.load(std::memory_order_acquire)->data);
+    }
+    for(auto it{ pending.rbegin() }; it != pending.rend(); ++it)
+    {
+      buff((*it)->piece);
+    }
+
+    auto const ret{ make_box<persistent_string>(buff.release()) };
+    persistent_string *expected{};
+    if(!flattened.compare_exchange_strong(expected,
+                                          ret.ptr(),
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire))
+    {
+      return expected;
+    }
+    return ret;
+  }
+}
@@ -0,0 +1,68 @@
+#include <jank/runtime/obj/striped_counter.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+namespace jank::runtime::obj
+{
+  /* Threads are handed stripes round robin, the first time they add to any counter. */
+  static usize thread_stripe()
+  {
+    static std::atomic<usize> next{};
+    thread_local usize const stripe{ next.fetch_add(1, std::memory_order_relaxed)
+                                     % striped_counter::stripe_count };
+    return stripe;
+  }
+
+  striped_counter::striped_counter()
+    : object{ obj_type, obj_behaviors }
+  {
+  }
+
+  object_ref striped_counter::deref()
+  {
+    return make_box(sum());
+  }
+
+  void striped_counter::add(i64 const n)
+  {
+    if(!contended.load(std::memory_order_relaxed))
+    {
+      auto b{ base.load(std::memory_order_relaxed) };
+      if(base.compare_exchange_strong(b, b + n, std::memory_order_relaxed))
+      {
+        return;
+      }
+      contended.store(true, std::memory_order_relaxed);
+    }
+
+    stripes[thread_stripe()].count.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  i64 striped_counter::sum() const
+  {
+    auto ret{ base.load(std::memory_order_relaxed) };
+    for(auto const &s : stripes)
+    {
+      ret += s.count.load(std::memory_order_relaxed);
+    }
+    return ret;
+  }
+
+  void striped_counter::reset()
+  {
+    base.store(0, std::memory_order_relaxed);
+    for(auto &s : stripes)
+    {
+      s.count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  i64 striped_counter::sum_then_reset()
+  {
+    auto ret{ base.exchange(0, std::memory_order_relaxed) };
+    for(auto &s : stripes)
+    {
+      ret += s.count.exchange(0, std::memory_order_relaxed);
+    }
+    return ret;
+  }
+}
@@ -39,6 +39,12 @@ namespace jank::runtime::obj
   {
   }
 
+  uuid::uuid(std::array<u8, 16> const &bytes)
+    : object{ obj_type, obj_behaviors }
+    , value{ jtl::make_ref<uuids::uuid>(bytes.begin(), bytes.end()) }
+  {
+  }
+
   bool uuid::equal(object const &o) const
   {
     if(o.type != object_type::uuid)
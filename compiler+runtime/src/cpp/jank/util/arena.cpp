@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <new>
+
+#include <jank/util/arena.hpp>
+
+namespace jank::util
+{
+  /* Most chunks are this size. Anything which doesn't fit into a quarter of it gets a
+   * chunk to itself, so we don't waste the rest of the current one. */
+  static constexpr usize chunk_size{ 64 * 1024 };
+
+  /* Chunks are linked together through a small header, which also keeps each one
+   * reachable from the arena. */
+  struct arena::chunk
+  {
+    chunk *prev{};
+  };
+
+  static thread_local arena *current_arena{};
+
+  arena::~arena()
+  {
+    while(head)
+    {
+      auto * const prev{ head->prev };
+      /* NOLINTNEXTLINE(cppcoreguidelines-no-malloc) */
+      GC_free(head);
+      head = prev;
+    }
+  }
+
+  arena::chunk *arena::allocate_chunk(usize const size)
+  {
+    /* NOLINTNEXTLINE(cppcoreguidelines-no-malloc) */
+    auto * const c{ static_cast<chunk *>(GC_malloc(sizeof(chunk) + size)) };
+    if(!c)
+    {
+      throw std::bad_alloc{};
+    }
+    return c;
+  }
+
+  void *arena::allocate(usize const size, usize const alignment)
+  {
+    /* GC_malloc gives us memory aligned well enough for anything the compiler builds,
+     * so a dedicated chunk only needs its header rounded up. */
+    if(size > chunk_size / 4)
+    {
+      auto const header{ (sizeof(chunk) + alignment - 1) & ~(alignment - 1) };
+      auto * const c{ allocate_chunk(header - sizeof(chunk) + size) };
+      /* Keep bumping from the current chunk by slotting this one in behind it. */
+      if(head)
+      {
+        c->prev = head->prev;
+        head->prev = c;
+      }
+      else
+      {
+        head = c;
+      }
+      return reinterpret_cast<char *>(c) + header;
+    }
+
+    auto const aligned{ (reinterpret_cast<uptr>(cursor) + alignment - 1) & ~(alignment - 1) };
+    if(!cursor || aligned + size > reinterpret_cast<uptr>(end))
+    {
+      auto * const c{ allocate_chunk(chunk_size) };
+      c->prev = head;
+      head = c;
+      cursor = reinterpret_cast<char *>(c + 1);
+      end = cursor + chunk_size;
+      return allocate(size, alignment);
+    }
+
+    cursor = reinterpret_cast<char *>(aligned + size);
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  arena *arena::current()
+  {
+    return current_arena;
+  }
+
+  arena::scope::scope(arena &a)
+    : previous{ current_arena }
+  {
+    current_arena = &a;
+  }
+
+  arena::scope::~scope()
+  {
+    current_arena = previous;
+  }
+
+  arena::escape::escape()
+    : previous{ current_arena }
+  {
+    current_arena = nullptr;
+  }
+
+  arena::escape::~escape()
+  {
+    current_arena = previous;
+  }
+
+  void *arena_allocated::operator new(usize const size, GCPlacement const placement)
+  {
+    auto * const a{ arena::current() };
+    if(a)
+    {
+      return a->allocate(size, alignof(std::max_align_t));
+    }
+    return ::operator new(size, placement);
+  }
+
+  void arena_allocated::operator delete(void * const data, GCPlacement const)
+  {
+    /* Arena memory goes with the arena. */
+    if(!arena::current())
+    {
+      /* NOLINTNEXTLINE(cppcoreguidelines-no-malloc) */
+      GC_free(data);
+    }
+  }
+}
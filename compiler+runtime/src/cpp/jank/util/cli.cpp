@@ -130,6 +130,11 @@ OPTIONS
   -O,     --optimization <0 - 3>
                               The optimization level to use for AOT compilation.
   -Odirect-call               Elides the dereferencing of vars for improved performance. (not yet implemented)
+  -Ofuse-seq-chains           Fuses map/filter/remove/take chains ending in reduce into a single
+                              loop. Enabled at -O2 and above. Disable with -Ono-fuse-seq-chains.
+  -Ocall-site-caches          Gives each dynamic call site a cache of the callee it has seen,
+                              guarding a direct call to it. Enabled at -O2 and above. Disable
+                              with -Ono-call-site-caches.
           --eagerness <lazy, eager> [default: lazy]
                               How eagerly to JIT compile functions.
           --runtime <static, dynamic> [default: static]
@@ -176,6 +181,8 @@ OPTIONS
     jtl::option<bool> remove_nops;
 
     /*** O2 ***/
+    jtl::option<bool> fuse_seq_chains;
+    jtl::option<bool> call_site_caches;
 
     /*** O3 ***/
     jtl::option<bool> hoist_var_derefs;
@@ -189,6 +196,8 @@ OPTIONS
       {   "hoist-literals",   &options_scratchpad::hoist_literals },
       {      "remove-nops",      &options_scratchpad::remove_nops },
       { "hoist-var-derefs", &options_scratchpad::hoist_var_derefs },
+      {  "fuse-seq-chains",  &options_scratchpad::fuse_seq_chains },
+      { "call-site-caches", &options_scratchpad::call_site_caches },
       {      "direct-call",      &options_scratchpad::direct_call },
   };
 
@@ -209,6 +218,8 @@ OPTIONS
         opts.hoist_var_derefs = scratch.hoist_var_derefs.unwrap_or(true);
         [[fallthrough]];
       case 2:
+        opts.fuse_seq_chains = scratch.fuse_seq_chains.unwrap_or(true);
+        opts.call_site_caches = scratch.call_site_caches.unwrap_or(true);
         [[fallthrough]];
       case 1:
         opts.hoist_literals = scratch.hoist_literals.unwrap_or(true);
@@ -141,6 +141,7 @@ namespace jank::util
   {
     static native_set<jtl::immutable_string> const core_libs{
       "clojure_core",
+      "clojure_core_async",
       "clojure_core_reducers",
       "clojure_core_protocols",
       "clojure_data",
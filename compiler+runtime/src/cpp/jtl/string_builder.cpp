@@ -304,6 +304,16 @@ namespace jtl
     return *this;
   }
 
+  string_builder &string_builder::operator()(jtl::immutable_string_view const &d) &
+  {
+    auto const required{ d.size() };
+    maybe_realloc(*this, required);
+
+    write(*this, d.data(), required);
+
+    return *this;
+  }
+
   string_builder &string_builder::operator()(terminal::text_style const s) &
   {
     if(!terminal::is_stdout_interactive())
@@ -0,0 +1,113 @@
+#include <array>
+#include <cstdio>
+
+#include <clojure/data/json_native.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/obj/big_integer.hpp>
+#include <jank/runtime/obj/opaque_box.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace clojure::data::json_native
+{
+  TEST_SUITE("clojure.data.json")
+  {
+    TEST_CASE("read scalars")
+    {
+      read_options const opts;
+      CHECK(equal(read_str("null", opts), jank_nil));
+      CHECK(equal(read_str(" true ", opts), jank_true));
+      CHECK(equal(read_str("-42", opts), make_box(-42)));
+      CHECK(equal(read_str("1.5e2", opts), make_box(150.0)));
+      CHECK(equal(read_str("99999999999999999999", opts),
+                  make_box<obj::big_integer>(jtl::immutable_string{ "99999999999999999999" })));
+      CHECK(equal(read_str(R"("a\"b\u00e9\ud83d\ude00")", opts),
+                  make_box("a\"b\xC3\xA9\xF0\x9F\x98\x80")));
+      CHECK_THROWS(read_str("01", opts));
+      CHECK_THROWS(read_str("[1,]", opts));
+      CHECK_THROWS(read_str("\"abc", opts));
+      CHECK_THROWS(read_str("", opts));
+      CHECK(equal(read_str("", { .eof_error = false, .eof_value = make_box(1) }), make_box(1)));
+    }
+    TEST_CASE("read collections")
+    {
+      read_options const opts;
+      CHECK(equal(read_str(R"([1, [], {}, "x"])", opts),
+                  make_box<obj::persistent_vector>(std::in_place,
+                                                   make_box(1),
+                                                   obj::persistent_vector::empty(),
+                                                   obj::persistent_array_map::empty(),
+                                                   make_box("x"))));
+
+      auto const small{ read_str(R"({"a": 1, "b": 2, "a": 3})", opts) };
+      CHECK_EQ(small.get_type(), object_type::persistent_array_map);
+      CHECK(equal(small,
+                  obj::persistent_array_map::create_unique(make_box("a"),
+                                                           make_box(3),
+                                                           make_box("b"),
+                                                           make_box(2))));
+
+      auto const large{ read_str(
+        R"({"a":1,"b":2,"c":3,"d":4,"e":5,"f":6,"g":7,"h":8,"i":9,"a":10})",
+        opts) };
+      CHECK_EQ(large.get_type(), object_type::persistent_hash_map);
+      CHECK_EQ(expect_object<obj::persistent_hash_map>(large)->data.size(), 9);
+      CHECK(equal(expect_object<obj::persistent_hash_map>(large)->get(make_box("a")),
+                  make_box(10)));
+    }
+    TEST_CASE("read keyword keys")
+    {
+      read_options opts;
+      opts.keyword_keys = true;
+      auto const v{ expect_object<obj::persistent_vector>(
+        read_str(R"([{"id": 1}, {"id": 2}])", opts)) };
+      auto const id{ __rt_ctx->intern_keyword("id").expect_ok() };
+      CHECK(equal(v->data[0], obj::persistent_array_map::create_unique(id, make_box(1))));
+      CHECK(equal(v->data[1], obj::persistent_array_map::create_unique(id, make_box(2))));
+    }
+    TEST_CASE("write")
+    {
+      write_options opts;
+      auto const data{ obj::persistent_array_map::create_unique(
+        __rt_ctx->intern_keyword("a").expect_ok(),
+        make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box(2.5), jank_nil),
+        make_box("b"),
+        make_box("q\"\n\x01")) };
+      CHECK_EQ(write_str(data, opts), R"({"a":[1,2.5,null],"b":"q\"\n\u0001"})");
+
+      opts.indent = true;
+      CHECK_EQ(write_str(data, opts),
+               "{\n  \"a\": [\n    1,\n    2.5,\n    null\n  ],\n  \"b\": \"q\\\"\\n\\u0001\"\n}");
+      CHECK_EQ(write_str(obj::persistent_vector::empty(), opts), "[]");
+    }
+    TEST_CASE("write to *out*")
+    {
+      write_options const opts;
+      auto const data{
+        make_box<obj::persistent_vector>(std::in_place, make_box(1), make_box("a"))
+      };
+
+      /* The default `*out*` is a boxed FILE*. */
+      CHECK_NOTHROW(write(data, __rt_ctx->current_out_var->deref(), opts));
+
+      auto const file{ std::tmpfile() };
+      REQUIRE(file);
+      auto const stream{ try_object<obj::opaque_box>(__rt_ctx->stream_var->deref()) };
+      auto const out{ make_box<obj::opaque_box>(file, stream->canonical_type) };
+      write(data, out, opts);
+      std::fflush(file);
+      std::rewind(file);
+      std::array<char, 64> buff{};
+      auto const size{ std::fread(buff.data(), 1, buff.size(), file) };
+      std::fclose(file);
+      CHECK_EQ(jtl::immutable_string{ buff.data(), size }, R"([1,"a"])");
+    }
+  }
+}
@@ -0,0 +1,91 @@
+#include <jank/nrepl/bencode.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::nrepl::bencode
+{
+  using namespace jank::runtime;
+
+  TEST_SUITE("nrepl::bencode")
+  {
+    TEST_CASE("decode")
+    {
+      decoder d;
+      d.feed("d2:op4:eval4:code7:(+ 1 2)2:idi7ee");
+      auto const msg{ d.next() };
+      REQUIRE(msg.is_some());
+      CHECK(equal(msg.unwrap(),
+                  obj::persistent_array_map::create_unique(make_box("op"),
+                                                           make_box("eval"),
+                                                           make_box("code"),
+                                                           make_box("(+ 1 2)"),
+                                                           make_box("id"),
+                                                           make_box(7))));
+      CHECK(d.next().is_none());
+      CHECK_EQ(0, d.buffered());
+    }
+
+    TEST_CASE("incremental")
+    {
+      decoder d;
+      d.feed("l5:hel");
+      CHECK(d.next().is_none());
+      d.feed("lo");
+      CHECK(d.next().is_none());
+      d.feed("i-3ee4:");
+      auto const list{ d.next() };
+      REQUIRE(list.is_some());
+      CHECK(equal(list.unwrap(),
+                  make_box<obj::persistent_vector>(std::in_place, make_box("hello"), make_box(-3))));
+
+      /* What's left over is the start of the next value. */
+      CHECK_EQ(2, d.buffered());
+      d.feed("done");
+      CHECK(equal(d.next().unwrap(), make_box("done")));
+    }
+
+    TEST_CASE("invalid")
+    {
+      decoder d;
+      d.feed("ixe");
+      CHECK_THROWS(d.next());
+
+      /* A length prefix which never ends is rejected, rather than buffered forever. */
+      decoder unterminated;
+      unterminated.feed("123456789012345678901");
+      CHECK_THROWS(unterminated.next());
+
+      decoder partial;
+      partial.feed("12345");
+      CHECK(partial.next().is_none());
+    }
+
+    TEST_CASE("encode")
+    {
+      auto const msg{ obj::persistent_array_map::create_unique(
+        __rt_ctx->intern_keyword("status").expect_ok(),
+        make_box<obj::persistent_vector>(std::in_place,
+                                         __rt_ctx->intern_keyword("done").expect_ok()),
+        make_box("value"),
+        make_box("λ"),
+        make_box("n"),
+        make_box(42)) };
+      CHECK(equal(encode(msg), make_box("d6:statusl4:donee5:value2:λ1:ni42ee")));
+      CHECK_THROWS(encode(jank_nil));
+
+      /* Bencode only has integers, so reals are sent as strings. */
+      CHECK(equal(encode(make_box(1.5)), make_box("3:1.5")));
+
+      /* Byte strings are measured in bytes, not characters. */
+      CHECK(equal(decode(make_box("2:λrest")),
+                  make_box<obj::persistent_vector>(std::in_place, make_box("λ"), make_box("rest"))));
+    }
+  }
+}
@@ -0,0 +1,106 @@
+#include <string>
+
+#include <jank/read/edn.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/visit.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::read::edn
+{
+  using namespace jank::runtime;
+
+  TEST_SUITE("edn")
+  {
+    TEST_CASE("Scalars")
+    {
+      options const opts;
+      CHECK(equal(read("nil", opts).value, jank_nil));
+      CHECK(equal(read("  42 ", opts).value, make_box(42)));
+      CHECK(equal(read("\"a\\nb\"", opts).value, make_box("a\nb")));
+      CHECK(equal(read("\\a", opts).value, make_box('a')));
+      CHECK(equal(read(":foo/bar", opts).value,
+                  __rt_ctx->intern_keyword("foo", "bar").expect_ok()));
+      CHECK(equal(read("foo/bar", opts).value, make_box<obj::symbol>("foo", "bar")));
+      CHECK_THROWS(read("", opts));
+      CHECK(equal(read("", { .eof = make_box(1), .eof_throw = false }).value, make_box(1)));
+    }
+    TEST_CASE("Collections")
+    {
+      options const opts;
+      CHECK(equal(read("[1 (2 3) #{4} {:a 5}]", opts).value,
+                  make_box<obj::persistent_vector>(
+                    std::in_place,
+                    make_box(1),
+                    make_box<obj::persistent_list>(std::in_place, make_box(2), make_box(3)),
+                    make_box<obj::persistent_hash_set>(std::in_place, make_box(4)),
+                    obj::persistent_array_map::create_unique(
+                      __rt_ctx->intern_keyword("a").expect_ok(),
+                      make_box(5)))));
+
+      auto const large{ read("{:a 1 :b 2 :c 3 :d 4 :e 5 :f 6 :g 7 :h 8 :i 9}", opts).value };
+      CHECK_EQ(large.get_type(), object_type::persistent_hash_map);
+      CHECK_EQ(sequence_length(large), 9);
+
+      CHECK_THROWS(read("{:a 1 :a 2}", opts));
+      CHECK_THROWS(read("#{1 1}", opts));
+      CHECK_THROWS(read("{:a}", opts));
+    }
+    TEST_CASE("No source meta")
+    {
+      options const opts;
+      CHECK(meta(read("[1 2]", opts).value).is_nil());
+      CHECK(equal(meta(read("^:private [1 2]", opts).value),
+                  obj::persistent_array_map::create_unique(
+                    __rt_ctx->intern_keyword("private").expect_ok(),
+                    jank_true)));
+    }
+    TEST_CASE("Code isn't data")
+    {
+      options const opts;
+      CHECK_THROWS(read("'foo", opts));
+      CHECK_THROWS(read("`foo", opts));
+      CHECK_THROWS(read("#(inc %)", opts));
+      CHECK_THROWS(read("::foo", opts));
+      CHECK_THROWS(read("#unknown 1", opts));
+    }
+    TEST_CASE("Tags")
+    {
+      options opts;
+      opts.default_fn = make_box<obj::native_function_wrapper>(
+        std::function<object_ref(object_ref const, object_ref const)>{
+          [](object_ref const, object_ref const value) { return value; } });
+      CHECK(equal(read("#unknown 1", opts).value, make_box(1)));
+      CHECK_EQ(read("#inst \"2020-01-01T00:00:00Z\"", opts).value.get_type(), object_type::inst);
+    }
+    TEST_CASE("Nesting limit")
+    {
+      options const opts;
+      /* Far deeper than the native stack could take, if we let it. */
+      std::string const deep(100'000, '[');
+      CHECK_THROWS(read(jtl::immutable_string_view{ deep.data(), deep.size() }, opts));
+
+      std::string const meta(100'000, '^');
+      CHECK_THROWS(read(jtl::immutable_string_view{ meta.data(), meta.size() }, opts));
+
+      /* Plenty of nesting is still fine. */
+      std::string const ok{ std::string(64, '[') + std::string(64, ']') };
+      CHECK_EQ(read(jtl::immutable_string_view{ ok.data(), ok.size() }, opts).consumed, 128);
+    }
+    TEST_CASE("Consumed")
+    {
+      options const opts;
+      jtl::immutable_string_view const input{ "[1 2] :next" };
+      auto const res{ read(input, opts) };
+      CHECK_EQ(res.consumed, 5);
+      CHECK(equal(read(input.substr(res.consumed), opts).value,
+                  __rt_ctx->intern_keyword("next").expect_ok()));
+    }
+  }
+}
@@ -0,0 +1,76 @@
+#include <jank/runtime/core/call_site.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/obj/jit_function.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/keyword.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::detail
+{
+  static object_ref inc(object_ref const, object_ref const n)
+  {
+    return promoting_add(n, make_box(1));
+  }
+
+  static object_ref dec(object_ref const, object_ref const n)
+  {
+    return promoting_add(n, make_box(-1));
+  }
+
+  static obj::jit_function_ref make_fn(object_ref (*f)(object_ref, object_ref))
+  {
+    auto const ret{ make_box<obj::jit_function>() };
+    ret->arity_1 = f;
+    return ret;
+  }
+
+  TEST_SUITE("call_site_cache")
+  {
+    TEST_CASE("Monomorphic")
+    {
+      auto &cache{ call_site_cache::create() };
+      auto const fn{ make_fn(&inc) };
+      /* The first call fills the cache, every call after it takes the guarded direct path. */
+      for(i64 i{}; i < 4; ++i)
+      {
+        CHECK(equal(dynamic_call(cache, fn, make_box(i)), make_box(i + 1)));
+      }
+      CHECK(cache.callee.load() == fn.erase().raw());
+      CHECK(!cache.megamorphic.load());
+    }
+    TEST_CASE("Guard failure")
+    {
+      auto &cache{ call_site_cache::create() };
+      auto const a{ make_fn(&inc) };
+      auto const b{ make_fn(&dec) };
+      CHECK(equal(dynamic_call(cache, a, make_box(1)), make_box(2)));
+      CHECK(equal(dynamic_call(cache, a, make_box(1)), make_box(2)));
+      CHECK(equal(dynamic_call(cache, b, make_box(1)), make_box(0)));
+      CHECK(equal(dynamic_call(cache, b, make_box(1)), make_box(0)));
+    }
+    TEST_CASE("Megamorphic")
+    {
+      auto &cache{ call_site_cache::create() };
+      for(u32 i{}; i <= call_site_cache::max_misses; ++i)
+      {
+        CHECK(equal(dynamic_call(cache, make_fn(&inc), make_box(1)), make_box(2)));
+      }
+      CHECK(cache.megamorphic.load());
+      CHECK(equal(dynamic_call(cache, make_fn(&dec), make_box(1)), make_box(0)));
+    }
+    TEST_CASE("Map callee")
+    {
+      auto &cache{ call_site_cache::create() };
+      auto const k{ __rt_ctx->intern_keyword("a").expect_ok() };
+      auto const m{ obj::persistent_array_map::create_unique(k, make_box(1)) };
+      CHECK(equal(dynamic_call(cache, m, k), make_box(1)));
+      CHECK(equal(dynamic_call(cache, m, k), make_box(1)));
+      CHECK(equal(dynamic_call(cache, m, make_box(2), make_box(3)), make_box(3)));
+    }
+  }
+}
@@ -0,0 +1,202 @@
+#include <jank/runtime/core/freeze.hpp>
+#include <jank/read/edn.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/meta.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/obj/big_integer.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/obj/persistent_hash_set.hpp>
+#include <jank/runtime/obj/persistent_sorted_map.hpp>
+#include <jank/runtime/obj/persistent_sorted_set.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/range.hpp>
+#include <jank/runtime/obj/tagged_literal.hpp>
+#include <jank/runtime/obj/uuid.hpp>
+#include <jank/runtime/visit.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  static object_ref read_edn(jtl::immutable_string_view const &s)
+  {
+    return read::edn::read(s, {}).value;
+  }
+
+  static object_ref round_trip(object_ref const o)
+  {
+    auto const frozen{ freeze(o) };
+    auto const res{ thaw(frozen) };
+    CHECK_EQ(res.consumed, frozen.size());
+    return res.value;
+  }
+
+  /* Frozen input for a collection of the same type as `empty`, which holds `items` exactly
+   * as they're given, even if they repeat. This is how corrupt input looks. */
+  static jtl::immutable_string
+  frozen_coll(object_ref const empty, i64 const count, native_vector<i64> const &items)
+  {
+    /* That's the header, the tag, and a one byte count of zero. */
+    auto const frozen_empty{ freeze(empty) };
+    auto const header_size{ frozen_empty.size() - 2 };
+    jtl::string_builder sb;
+    sb(frozen_empty.substr(0, header_size + 1));
+    sb(static_cast<char>(count));
+    for(auto const i : items)
+    {
+      sb(freeze(make_box(i)).substr(header_size));
+    }
+    return sb.release();
+  }
+
+  TEST_SUITE("freeze")
+  {
+    TEST_CASE("Scalars")
+    {
+      for(auto const s : { "nil",
+                           "true",
+                           "false",
+                           "0",
+                           "-1",
+                           "9223372036854775807",
+                           "-9223372036854775808",
+                           "1.5",
+                           "-0.0",
+                           "##Inf",
+                           "123456789012345678901234567890N",
+                           "-123456789012345678901234567890N",
+                           "-22/7",
+                           "3.14159265358979323846264338327950288M",
+                           "\"\"",
+                           "\"caf\xC3\xA9\"",
+                           "\\a",
+                           ":a",
+                           ":foo/bar",
+                           "baz",
+                           "foo/baz" })
+      {
+        auto const o{ read_edn(s) };
+        auto const thawed{ round_trip(o) };
+        CHECK_EQ(thawed.get_type(), o.get_type());
+        CHECK(equal(thawed, o));
+      }
+
+      auto const nan{ round_trip(read_edn("##NaN")) };
+      CHECK(std::isnan(nan.to_real()));
+
+      auto const id{ make_box<obj::uuid>() };
+      CHECK(equal(round_trip(id), id));
+      auto const big{ make_box<obj::big_integer>(
+        jtl::immutable_string{ "1" + std::string(300, '0') }) };
+      CHECK(equal(round_trip(big), big));
+    }
+    TEST_CASE("Collections")
+    {
+      auto const o{ read_edn(R"([() [] {} #{} (1 (2)) [:a [:b]] {:a 1 "b" [2]}
+                                 {:a 1 :b 2 :c 3 :d 4 :e 5 :f 6 :g 7 :h 8 :i 9}
+                                 #{:x :y #{:z}}])") };
+      CHECK(equal(round_trip(o), o));
+
+      auto const tagged{ make_box<obj::tagged_literal>(make_box<obj::symbol>("foo", "bar"),
+                                                       read_edn("[1 2]")) };
+      CHECK(equal(round_trip(tagged), tagged));
+
+      auto const sorted{ obj::persistent_sorted_map::create_from_seq(
+        read_edn(R"([3 "c" 1 "a"])")) };
+      auto const thawed{ round_trip(sorted) };
+      CHECK_EQ(thawed.get_type(), object_type::persistent_sorted_map);
+      CHECK(equal(thawed, sorted));
+
+      /* Sorted collections only have the default ordering, which thaw restores. */
+      auto const sorted_set{ obj::persistent_sorted_set::create_from_seq(
+        read_edn("[5 -2 9 0]")) };
+      auto const thawed_set{ round_trip(sorted_set) };
+      CHECK_EQ(thawed_set.get_type(), object_type::persistent_sorted_set);
+      CHECK(equal(seq(thawed_set), read_edn("(-2 0 5 9)")));
+      CHECK(equal(seq(thawed), seq(sorted)));
+
+      /* Other seqs are realized into lists. */
+      auto const r{ make_box<obj::range>(make_box(0), make_box(5)) };
+      auto const thawed_range{ round_trip(r) };
+      CHECK_EQ(thawed_range.get_type(), object_type::persistent_list);
+      CHECK(equal(thawed_range, r));
+    }
+    TEST_CASE("Meta")
+    {
+      auto const o{ read_edn("^:private [^{:tag int} x]") };
+      auto const thawed{ round_trip(o) };
+      CHECK(equal(meta(thawed), meta(o)));
+      CHECK(equal(meta(first(thawed)), meta(first(o))));
+    }
+    TEST_CASE("Keywords and symbols are back referenced")
+    {
+      auto const once{ freeze(read_edn("[:some.ns/some-key sym]")) };
+      auto const repeated{ read_edn("[:some.ns/some-key sym :some.ns/some-key sym "
+                                    ":some.ns/some-key sym :some.ns/some-key sym]") };
+      auto const many{ freeze(repeated) };
+      /* Each repeat is only a tag and a one byte index. */
+      CHECK_EQ(many.size(), once.size() + (6 * 2));
+      CHECK(equal(thaw(many).value, repeated));
+    }
+    TEST_CASE("Bad input")
+    {
+      CHECK_THROWS(thaw(""));
+      CHECK_THROWS(thaw("not frozen"));
+
+      auto const frozen{ freeze(read_edn("[1 2 3]")) };
+      CHECK_THROWS(thaw(frozen.substr(0, frozen.size() - 1)));
+
+      jtl::string_builder newer;
+      newer(frozen.substr(0, 3));
+      newer(static_cast<char>(99));
+      newer(frozen.substr(4));
+      CHECK_THROWS(thaw(newer.view()));
+
+      /* A count much larger than the input is rejected before anything is allocated. */
+      jtl::string_builder huge;
+      huge(frozen.substr(0, 4));
+      huge(static_cast<char>(15));
+      huge("\xff\xff\xff\xff\x0f");
+      CHECK_THROWS(thaw(huge.view()));
+
+      CHECK_THROWS(freeze(__rt_ctx->intern_var("clojure.core", "map").expect_ok()));
+    }
+    TEST_CASE("Duplicate keys")
+    {
+      CHECK_THROWS(thaw(frozen_coll(obj::persistent_array_map::empty(), 2, { 1, 1, 1, 2 })));
+      CHECK_THROWS(thaw(frozen_coll(obj::persistent_hash_set::empty(), 2, { 1, 1 })));
+      CHECK_THROWS(thaw(frozen_coll(obj::persistent_sorted_set::empty(), 2, { 1, 1 })));
+      CHECK_THROWS(thaw(frozen_coll(obj::persistent_sorted_map::empty(), 2, { 1, 1, 1, 2 })));
+
+      /* Larger maps are built differently, depending on their size. */
+      for(i64 const count : { 12, 40 })
+      {
+        native_vector<i64> kvs;
+        for(i64 i{}; i < count; ++i)
+        {
+          kvs.push_back(i);
+          kvs.push_back(i);
+        }
+        CHECK_NOTHROW(thaw(frozen_coll(obj::persistent_hash_map::empty(), count, kvs)));
+        kvs[2] = 0;
+        CHECK_THROWS(thaw(frozen_coll(obj::persistent_hash_map::empty(), count, kvs)));
+      }
+    }
+    TEST_CASE("Consumed")
+    {
+      jtl::string_builder buff;
+      freeze(make_box(1), buff, {});
+      auto const first_size{ buff.size() };
+      freeze(make_box(2), buff, {});
+
+      auto const res{ thaw(buff.view()) };
+      CHECK(equal(res.value, make_box(1)));
+      CHECK_EQ(res.consumed, first_size);
+      CHECK(equal(thaw(buff.view().substr(res.consumed)).value, make_box(2)));
+    }
+  }
+}
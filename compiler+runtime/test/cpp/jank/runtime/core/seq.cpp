@@ -1,7 +1,16 @@
 #include <jank/runtime/core/seq.hpp>
 #include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/context.hpp>
 #include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/obj/integer_range.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
 #include <jank/runtime/obj/persistent_list.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/string_rope.hpp>
+#include <jank/runtime/obj/symbol.hpp>
 
 /* This must go last; doctest and glog both define CHECK and family. */
 #include <doctest/doctest.h>
@@ -32,5 +41,215 @@ namespace jank::runtime::core
         make_box<obj::persistent_vector>(std::in_place, make_box('f'), make_box('g')),
         make_box<obj::persistent_list>(std::in_place, make_box('g'))));
     }
+
+    TEST_CASE("reduce_kv")
+    {
+      auto const assoc{ __rt_ctx->find_var(make_box<obj::symbol>("clojure.core/assoc")) };
+      auto const empty_map{ obj::persistent_array_map::empty() };
+
+      CHECK(equal(reduce_kv(assoc, empty_map, jank_nil), empty_map));
+
+      SUBCASE("vector keys are ordinals")
+      {
+        auto const v{
+          make_box<obj::persistent_vector>(std::in_place, make_box('f'), make_box('g'))
+        };
+        CHECK(equal(reduce_kv(assoc, empty_map, v),
+                    obj::persistent_array_map::create_unique(make_box(0),
+                                                             make_box('f'),
+                                                             make_box(1),
+                                                             make_box('g'))));
+      }
+
+      SUBCASE("map")
+      {
+        auto const m{ obj::persistent_array_map::create_unique(make_box('a'),
+                                                               make_box(1),
+                                                               make_box('b'),
+                                                               make_box(2)) };
+        CHECK(equal(reduce_kv(assoc, empty_map, m), m));
+      }
+    }
+
+    TEST_CASE("reduce")
+    {
+      /* Sums until the total passes 5, then stops. */
+      std::function<object_ref(object_ref, object_ref)> sum_to_5{
+        [](object_ref const acc, object_ref const x) -> object_ref {
+          auto const res{ make_box(to_int(acc) + to_int(x)) };
+          return to_int(res) > 5 ? reduced(res) : res;
+        }
+      };
+      auto const f{ make_box<obj::native_function_wrapper>(std::move(sum_to_5)) };
+
+      CHECK(equal(reduce(f, make_box(0), jank_nil), make_box(0)));
+      CHECK(equal(reduce(f,
+                         make_box(0),
+                         make_box<obj::persistent_vector>(std::in_place,
+                                                          make_box(1),
+                                                          make_box(2),
+                                                          make_box(3),
+                                                          make_box(4))),
+                  make_box(6)));
+      CHECK(equal(reduce(f,
+                         make_box(0),
+                         make_box<obj::persistent_list>(std::in_place, make_box(1), make_box(2))),
+                  make_box(3)));
+      CHECK(equal(reduce(f, make_box(0), obj::integer_range::create(1, 100)), make_box(6)));
+      CHECK(equal(reduce(f, make_box(0), obj::integer_range::create(10, 0, -3)), make_box(10)));
+      CHECK(equal(reduce(f, make_box(-100), obj::integer_range::create(10, 0, -3)),
+                  make_box(-78)));
+    }
+
+    TEST_CASE("sort")
+    {
+      auto const is_ascending{ [](object_ref const sorted) {
+        object_ref prev{};
+        for(auto it{ seq(sorted) }; it.is_some(); it = next(it))
+        {
+          auto const e{ first(it) };
+          if(prev.is_some() && runtime::compare(prev, e) > 0)
+          {
+            return false;
+          }
+          prev = e;
+        }
+        return true;
+      } };
+
+      CHECK(equal(sort(jank_nil), obj::persistent_list::empty()));
+
+      SUBCASE("integers")
+      {
+        /* Enough to take the radix path, with negatives and duplicates. */
+        auto v{ obj::persistent_vector::empty() };
+        for(i64 i{}; i < 1000; ++i)
+        {
+          v = v->conj(make_box(((i * 7919) % 600) - 300));
+        }
+        auto const sorted{ sort(v) };
+        CHECK(sequence_length(sorted) == 1000);
+        CHECK(is_ascending(sorted));
+        CHECK(equal(first(sorted), make_box(-300)));
+      }
+
+      SUBCASE("strings")
+      {
+        auto const v{ make_box<obj::persistent_vector>(std::in_place,
+                                                       make_box("b"),
+                                                       make_box("c"),
+                                                       make_box("a")) };
+        CHECK(equal(sort(v),
+                    make_box<obj::persistent_vector>(std::in_place,
+                                                     make_box("a"),
+                                                     make_box("b"),
+                                                     make_box("c"))));
+      }
+
+      SUBCASE("sort_by is stable")
+      {
+        auto const count{ __rt_ctx->find_var(make_box<obj::symbol>("clojure.core/count")) };
+        auto const v{ make_box<obj::persistent_vector>(std::in_place,
+                                                       make_box("bb"),
+                                                       make_box("a"),
+                                                       make_box("cc"),
+                                                       make_box("d")) };
+        CHECK(equal(sort_by(count, v),
+                    make_box<obj::persistent_vector>(std::in_place,
+                                                     make_box("a"),
+                                                     make_box("d"),
+                                                     make_box("bb"),
+                                                     make_box("cc"))));
+      }
+    }
+
+    TEST_CASE("zipmap")
+    {
+      auto const keys{ make_box<obj::persistent_vector>(std::in_place,
+                                                        make_box('a'),
+                                                        make_box('b'),
+                                                        make_box('c')) };
+      auto const vals{ make_box<obj::persistent_list>(std::in_place, make_box(1), make_box(2)) };
+      CHECK(equal(zipmap(keys, vals),
+                  obj::persistent_array_map::create_unique(make_box('a'),
+                                                           make_box(1),
+                                                           make_box('b'),
+                                                           make_box(2))));
+      CHECK(zipmap(jank_nil, vals)->count() == 0);
+    }
+
+    TEST_CASE("string_rope")
+    {
+      auto const r{ string_rope(make_box<obj::persistent_vector>(std::in_place,
+                                                                 make_box("foo"),
+                                                                 jank_nil,
+                                                                 make_box(1))) };
+      auto const appended{ rope_append(r, make_box<obj::persistent_list>(std::in_place,
+                                                                         make_box("bar"))) };
+      CHECK(r->count() == 4);
+      CHECK(appended->count() == 7);
+      CHECK(r->to_string() == "foo1");
+      CHECK(appended->to_string() == "foo1bar");
+      CHECK(equal(appended->flatten(), make_box("foo1bar")));
+      /* Appending only works on ropes. Strings stay strings. */
+      CHECK_THROWS(rope_append(make_box("foo"), jank_nil));
+    }
+
+    TEST_CASE("fold")
+    {
+      auto const plus{ __rt_ctx->find_var(make_box<obj::symbol>("clojure.core/+")) };
+      runtime::detail::native_transient_vector trans;
+      for(i64 i{}; i < 10000; ++i)
+      {
+        trans.push_back(make_box(i));
+      }
+      auto const v{ make_box<obj::persistent_vector>(trans.persistent()) };
+      /* Small chunks, so the fold is split across the pool. */
+      auto const n{ make_box(64) };
+
+      /* These are the xforms which `r/map` and `r/filter` build. */
+      auto const map_inc{ make_box<obj::native_function_wrapper>(
+        std::function<object_ref(object_ref const)>{ [](object_ref const f1) -> object_ref {
+          return make_box<obj::native_function_wrapper>(
+            std::function<object_ref(object_ref const, object_ref const)>{
+              [=](object_ref const acc, object_ref const e) -> object_ref {
+                return f1.call(acc, make_box(to_int(e) + 1));
+              } });
+        } }) };
+      auto const filter_even{ make_box<obj::native_function_wrapper>(
+        std::function<object_ref(object_ref const)>{ [](object_ref const f1) -> object_ref {
+          return make_box<obj::native_function_wrapper>(
+            std::function<object_ref(object_ref const, object_ref const)>{
+              [=](object_ref const acc, object_ref const e) -> object_ref {
+                return to_int(e) % 2 == 0 ? f1.call(acc, e) : acc;
+              } });
+        } }) };
+
+      SUBCASE("vector")
+      {
+        CHECK(equal(fold(n, plus, plus, v), reduce(plus, make_box(0), v)));
+        CHECK(equal(fold(n, plus, plus, v), make_box(49995000)));
+      }
+
+      SUBCASE("folders")
+      {
+        auto const mapped{ folder(v, map_inc) };
+        CHECK(equal(fold(n, plus, plus, mapped), make_box(50005000)));
+        CHECK(equal(reduce(plus, make_box(0), mapped), make_box(50005000)));
+        CHECK(equal(reduce(plus, mapped), make_box(50005000)));
+
+        auto const filtered{ folder(mapped, filter_even) };
+        CHECK(equal(fold(n, plus, plus, filtered), reduce(plus, make_box(0), filtered)));
+        CHECK(equal(reduce(plus, filtered), make_box(25005000)));
+      }
+
+      SUBCASE("reduce without init")
+      {
+        CHECK(equal(reduce(plus, v), make_box(49995000)));
+        CHECK(equal(reduce(plus, obj::persistent_vector::empty()), make_box(0)));
+        CHECK(equal(reduce(plus, folder(obj::persistent_vector::empty(), map_inc)),
+                    make_box(0)));
+      }
+    }
   }
 }
@@ -0,0 +1,55 @@
+#include <jank/runtime/detail/fork_join_pool.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::detail
+{
+  /* Sums [start, end) by forking the right half, as `fold` does. */
+  static usize sum(fork_join_pool &pool, usize const start, usize const end)
+  {
+    if(end - start <= 8)
+    {
+      usize ret{};
+      for(usize i{ start }; i < end; ++i)
+      {
+        ret += i;
+      }
+      return ret;
+    }
+
+    auto const mid{ start + ((end - start) / 2) };
+    usize right{};
+    fork_join_pool::job right_job{ [&]() { right = sum(pool, mid, end); } };
+    pool.fork(right_job);
+    auto const left{ sum(pool, start, mid) };
+    pool.join(right_job);
+    return left + right;
+  }
+
+  TEST_SUITE("fork_join_pool")
+  {
+    TEST_CASE("Nested forks")
+    {
+      fork_join_pool pool{ 3 };
+      static constexpr usize n{ 100000 };
+      for(usize i{}; i < 10; ++i)
+      {
+        CHECK(sum(pool, 0, n) == n * (n - 1) / 2);
+      }
+    }
+    TEST_CASE("No workers")
+    {
+      /* The joining thread runs everything itself. */
+      fork_join_pool pool{ 0 };
+      CHECK(sum(pool, 0, 1000) == 499500);
+    }
+    TEST_CASE("Errors are rethrown on join")
+    {
+      fork_join_pool pool{ 2 };
+      fork_join_pool::job j{ []() { throw std::runtime_error{ "fail" }; } };
+      pool.fork(j);
+      CHECK_THROWS_AS(pool.join(j), std::runtime_error);
+    }
+  }
+}
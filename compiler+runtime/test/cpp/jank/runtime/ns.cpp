@@ -0,0 +1,88 @@
+#include <atomic>
+#include <thread>
+
+#include <jank/runtime/ns.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/obj/symbol.hpp>
+#include <jank/util/fmt.hpp>
+#include <jank/gc.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime
+{
+  TEST_SUITE("ns")
+  {
+    TEST_CASE("find_var by name")
+    {
+      auto const n{ __rt_ctx->intern_ns("jank.test.ns.find-var") };
+      CHECK(n->find_var("missing").is_nil());
+      CHECK(__rt_ctx->find_var("jank.test.ns.find-var", "missing").is_nil());
+      CHECK(__rt_ctx->find_var("jank.test.ns.missing", "missing").is_nil());
+
+      auto const v{ n->intern_var("present") };
+      CHECK(n->find_var("present") == v);
+      CHECK(__rt_ctx->find_var("jank.test.ns.find-var", "present") == v);
+      CHECK(__rt_ctx->find_var(make_box<obj::symbol>("jank.test.ns.find-var/present")) == v);
+      CHECK(n->intern_var("present") == v);
+      CHECK(__rt_ctx->intern_var("jank.test.ns.find-var", "present").expect_ok() == v);
+
+      /* Names too long to be stored inline. */
+      jtl::immutable_string const long_name{ "a-var-name-which-is-longer-than-the-sso-limit" };
+      auto const long_v{ n->intern_var(long_name) };
+      CHECK(n->find_var(long_name) == long_v);
+
+      CHECK(n->unmap(make_box<obj::symbol>("present")).is_ok());
+      CHECK(n->find_var("present").is_nil());
+    }
+
+    TEST_CASE("Readers see whole snapshots")
+    {
+      auto const n{ __rt_ctx->intern_ns("jank.test.ns.snapshot") };
+      static constexpr usize var_count{ 500 };
+      auto const base_count{ n->get_mappings()->count() };
+      std::atomic_bool done{};
+      bool went_backward{}, saw_partial{};
+
+      std::thread reader{ [&] {
+        /* This thread holds onto mappings and allocates, so the GC needs to know about it. */
+        GC_stack_base sb{};
+        GC_get_stack_base(&sb);
+        GC_register_my_thread(&sb);
+
+        usize last_seen{};
+        while(!done.load())
+        {
+          /* Vars are interned in order, so every snapshot needs to have all of the vars
+           * before the last one it has. */
+          auto const mappings{ n->get_mappings() };
+          auto const count{ mappings->count() - base_count };
+          went_backward |= count < last_seen;
+          last_seen = count;
+          for(usize i{}; i < count; ++i)
+          {
+            saw_partial |= !mappings->contains(make_box<obj::symbol>(util::format("v{}", i)));
+          }
+        }
+
+        GC_unregister_my_thread();
+      } };
+
+      for(usize i{}; i < var_count; ++i)
+      {
+        n->intern_var(util::format("v{}", i));
+      }
+      done.store(true);
+      reader.join();
+      CHECK(!went_backward);
+      CHECK(!saw_partial);
+
+      for(usize i{}; i < var_count; ++i)
+      {
+        CHECK(n->find_var(util::format("v{}", i)).is_some());
+      }
+    }
+  }
+}
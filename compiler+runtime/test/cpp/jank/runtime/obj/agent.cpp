@@ -0,0 +1,146 @@
+#include <thread>
+
+#include <jank/runtime/obj/agent.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core/agent.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref kw(jtl::immutable_string const &name)
+  {
+    return __rt_ctx->intern_keyword(name).expect_ok();
+  }
+
+  static object_ref plus(object_ref const state, object_ref const n)
+  {
+    return promoting_add(state, n);
+  }
+
+  static object_ref conj_to(object_ref const state, object_ref const x)
+  {
+    return runtime::conj(state, x);
+  }
+
+  static object_ref fail(object_ref const)
+  {
+    throw std::runtime_error{ "fail" };
+  }
+
+  static void wait_for_error(object_ref const a)
+  {
+    while(agent_error(a).is_nil())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  TEST_SUITE("agent")
+  {
+    TEST_CASE("Actions run in order")
+    {
+      auto const a{ runtime::agent(persistent_vector::empty()) };
+      auto const f{ make_box<native_function_wrapper>(&conj_to) };
+      /* More than a batch, so the drain has to reschedule itself. Sends and send-offs are
+       * interleaved, so the drain also has to keep moving between the pools. */
+      runtime::detail::native_transient_vector expected;
+      for(i64 i{}; i < static_cast<i64>(agent::batch_size * 6); ++i)
+      {
+        auto const args{ make_box<persistent_vector>(std::in_place, make_box(i))->seq() };
+        if(i % 3 == 0)
+        {
+          agent_send_off(a, f, args);
+        }
+        else
+        {
+          agent_send(a, f, args);
+        }
+        expected.push_back(make_box(i));
+      }
+      await_agents(make_box<persistent_vector>(std::in_place, a));
+      CHECK(equal(a->deref(), make_box<persistent_vector>(expected.persistent())));
+    }
+    TEST_CASE("Fail mode")
+    {
+      auto const a{ runtime::agent(make_box(1)) };
+      agent_send(a, make_box<native_function_wrapper>(&fail), {});
+      wait_for_error(a);
+      CHECK(equal(get_agent_error_mode(a), kw("fail")));
+      CHECK_THROWS(agent_send(a, make_box<native_function_wrapper>(&plus), {}));
+      CHECK(equal(a->deref(), make_box(1)));
+
+      restart_agent(a, make_box(2), false);
+      CHECK(agent_error(a).is_nil());
+      CHECK_THROWS(restart_agent(a, make_box(3), false));
+      agent_send(a,
+                 make_box<native_function_wrapper>(&plus),
+                 make_box<persistent_vector>(std::in_place, make_box(1))->seq());
+      await_agents(make_box<persistent_vector>(std::in_place, a));
+      CHECK(equal(a->deref(), make_box(3)));
+    }
+    TEST_CASE("Await a failed agent")
+    {
+      auto const a{ runtime::agent(make_box(1)) };
+      auto const b{ runtime::agent(make_box(1)) };
+      agent_send(a, make_box<native_function_wrapper>(&fail), {});
+      wait_for_error(a);
+
+      /* The await doesn't throw, it waits for the restart. The agent which is fine is still
+       * awaited as usual. */
+      auto const both{ make_box<persistent_vector>(std::in_place, a, b) };
+      CHECK(!await_agents_for(make_box(20), both));
+      CHECK(await_agents_for(make_box(1000), make_box<persistent_vector>(std::in_place, b)));
+
+      restart_agent(a, make_box(2), false);
+      await_agents(both);
+      CHECK(equal(a->deref(), make_box(2)));
+    }
+    TEST_CASE("Continue mode")
+    {
+      auto const a{ runtime::agent(make_box(1)) };
+      set_agent_error_mode(a, kw("continue"));
+      CHECK_THROWS(set_agent_error_mode(a, kw("unknown")));
+      agent_send(a, make_box<native_function_wrapper>(&fail), {});
+      agent_send(a,
+                 make_box<native_function_wrapper>(&plus),
+                 make_box<persistent_vector>(std::in_place, make_box(1))->seq());
+      await_agents(make_box<persistent_vector>(std::in_place, a));
+      CHECK(agent_error(a).is_nil());
+      CHECK(equal(a->deref(), make_box(2)));
+    }
+    TEST_CASE("Sends within an action are held")
+    {
+      static agent_ref target;
+      static bool sent_early{};
+      target = runtime::agent(make_box(0));
+      sent_early = false;
+
+      std::function<object_ref(object_ref const)> send_then_check{
+        [](object_ref const state) -> object_ref {
+          agent_send(target,
+                     make_box<native_function_wrapper>(&plus),
+                     make_box<persistent_vector>(std::in_place, make_box(1))->seq());
+          /* Give the pool a chance to run the send, if it were to go out early. */
+          std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+          sent_early = !equal(target->deref(), make_box(0));
+          return state;
+        }
+      };
+
+      auto const a{ runtime::agent(make_box(0)) };
+      agent_send(a, make_box<native_function_wrapper>(std::move(send_then_check)), {});
+      await_agents(make_box<persistent_vector>(std::in_place, a));
+      await_agents(make_box<persistent_vector>(std::in_place, target));
+      CHECK(!sent_early);
+      CHECK(equal(target->deref(), make_box(1)));
+    }
+  }
+}
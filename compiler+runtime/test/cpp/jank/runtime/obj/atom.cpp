@@ -0,0 +1,99 @@
+#include <jank/runtime/obj/atom.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref inc(object_ref const val)
+  {
+    return promoting_add(val, make_box(1));
+  }
+
+  static object_ref kw(jtl::immutable_string const &name)
+  {
+    return __rt_ctx->intern_keyword(name).expect_ok();
+  }
+
+  TEST_SUITE("atom")
+  {
+    TEST_CASE("Watches added after swaps")
+    {
+      auto const a{ make_box<atom>(make_box(0)) };
+      auto const f{ make_box<native_function_wrapper>(&inc) };
+      a->swap(f);
+      a->swap(f);
+      CHECK(!a->has_watches.load());
+
+      i64 calls{};
+      object_ref last_old, last_new;
+      auto const watch{ make_box<native_function_wrapper>(
+        std::function<object_ref(object_ref, object_ref, object_ref, object_ref)>{
+          [&](object_ref, object_ref, object_ref const old_val, object_ref const new_val)
+            -> object_ref {
+            ++calls;
+            last_old = old_val;
+            last_new = new_val;
+            return {};
+          } }) };
+      a->add_watch(kw("a"), watch);
+      a->add_watch(kw("b"), watch);
+      CHECK(a->has_watches.load());
+
+      a->swap(f);
+      CHECK(calls == 2);
+      CHECK(equal(last_old, make_box(2)));
+      CHECK(equal(last_new, make_box(3)));
+
+      /* The flag stays on until the last watch is gone. */
+      a->remove_watch(kw("a"));
+      CHECK(a->has_watches.load());
+      a->reset(make_box(10));
+      CHECK(calls == 3);
+
+      a->remove_watch(kw("b"));
+      CHECK(!a->has_watches.load());
+      a->swap(f);
+      a->reset_vals(make_box(20));
+      CHECK(calls == 3);
+      CHECK(equal(a->deref(), make_box(20)));
+    }
+    TEST_CASE("Validator set after swaps")
+    {
+      auto const a{ make_box<atom>(make_box(0)) };
+      auto const f{ make_box<native_function_wrapper>(&inc) };
+      a->swap(f);
+      CHECK(!a->has_validator.load());
+
+      auto const below_three{ make_box<native_function_wrapper>(
+        std::function<object_ref(object_ref)>{ [](object_ref const val) -> object_ref {
+          return make_box(lt(val, make_box(3)));
+        } }) };
+      a->set_validator(below_three);
+      CHECK(a->has_validator.load());
+
+      a->swap(f);
+      CHECK(equal(a->deref(), make_box(2)));
+      CHECK_THROWS(a->swap(f));
+      CHECK_THROWS(a->reset(make_box(5)));
+      CHECK(equal(a->deref(), make_box(2)));
+
+      /* Clearing the validator lets anything through again. */
+      a->set_validator({});
+      CHECK(!a->has_validator.load());
+      CHECK(a->get_validator().is_nil());
+      a->swap(f);
+      a->reset(make_box(5));
+      CHECK(equal(a->deref(), make_box(5)));
+
+      /* A validator which rejects the current value is never set. */
+      CHECK_THROWS(a->set_validator(below_three));
+      CHECK(!a->has_validator.load());
+    }
+  }
+}
@@ -0,0 +1,124 @@
+#include <array>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <jank/runtime/obj/buffered_writer.hpp>
+#include <jank/runtime/core/make_box.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  /* Everything which has made it to the file so far. Leaves the file ready to be written to
+   * again. */
+  static std::string contents(std::FILE * const file)
+  {
+    std::fflush(file);
+    std::rewind(file);
+    std::string ret;
+    std::array<char, 256> buff{};
+    usize read{};
+    while((read = std::fread(buff.data(), 1, buff.size(), file)) > 0)
+    {
+      ret.append(buff.data(), read);
+    }
+    std::fseek(file, 0, SEEK_END);
+    return ret;
+  }
+
+  static buffered_writer_ref make_writer(std::FILE * const file)
+  {
+    /* A long interval, so that only the capacity and explicit flushes matter. */
+    return make_box<buffered_writer>(file, 16, std::chrono::hours{ 1 });
+  }
+
+  TEST_SUITE("buffered_writer")
+  {
+    TEST_CASE("Flush")
+    {
+      auto const file{ std::tmpfile() };
+      REQUIRE(file);
+      auto const w{ make_writer(file) };
+      w->write("abc");
+      w->write('d');
+      CHECK(contents(file).empty());
+      w->flush();
+      CHECK(w->buff.empty());
+      CHECK(contents(file) == "abcd");
+
+      /* Filling the buffer flushes it. */
+      w->write("0123456789abcdef");
+      CHECK(contents(file) == "abcd0123456789abcdef");
+      std::fclose(file);
+    }
+    TEST_CASE("Large writes")
+    {
+      auto const file{ std::tmpfile() };
+      REQUIRE(file);
+      auto const w{ make_writer(file) };
+      std::string const large(1000, 'x');
+      w->write("head");
+      w->write(jtl::immutable_string_view{ large.data(), large.size() });
+      CHECK(w->buff.empty());
+      CHECK(contents(file) == "head" + large);
+      std::fclose(file);
+    }
+    TEST_CASE("Interleaved with direct output")
+    {
+      auto const file{ std::tmpfile() };
+      REQUIRE(file);
+      auto const w{ make_writer(file) };
+      w->write("a");
+      std::fputs("b", file);
+      w->flush();
+      CHECK(contents(file) == "ba");
+
+      /* Large writes bypass stdio, but whatever is already in its buffer lands first. */
+      std::string const large(100, 'c');
+      w->write("d");
+      std::fputs("e", file);
+      w->write(jtl::immutable_string_view{ large.data(), large.size() });
+      CHECK(contents(file) == "baed" + large);
+      std::fclose(file);
+    }
+    TEST_CASE("Other threads")
+    {
+      auto const file{ std::tmpfile() };
+      REQUIRE(file);
+      auto const w{ make_writer(file) };
+      w->write("a");
+
+      /* Only the creating thread uses the buffer. Anyone else writes straight through. */
+      std::thread other{ [&]() {
+        CHECK(!w->is_owner());
+        w->write("b");
+        w->write('c');
+        w->flush();
+      } };
+      other.join();
+      CHECK(w->is_owner());
+      CHECK(w->buff.view() == "a");
+      CHECK(contents(file) == "bc");
+      w->flush();
+      CHECK(contents(file) == "bca");
+      std::fclose(file);
+    }
+#ifndef JANK_WINDOWS_LIKE
+    TEST_CASE("Write errors")
+    {
+      auto const file{ std::fopen("/dev/full", "w") };
+      if(!file)
+      {
+        return;
+      }
+      auto const w{ make_writer(file) };
+      std::string const large(100, 'x');
+      CHECK_THROWS(w->write(jtl::immutable_string_view{ large.data(), large.size() }));
+      CHECK(w->buff.empty());
+      std::fclose(file);
+    }
+#endif
+  }
+}
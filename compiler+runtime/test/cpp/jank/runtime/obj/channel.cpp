@@ -0,0 +1,215 @@
+#include <jank/runtime/obj/channel.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/promise.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core/async.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/context.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref kw(jtl::immutable_string const &name)
+  {
+    return __rt_ctx->intern_keyword(name).expect_ok();
+  }
+
+  TEST_SUITE("channel")
+  {
+    TEST_CASE("Fixed buffer")
+    {
+      auto const ch{ chan(kw("fixed"), make_box(2)) };
+      CHECK(chan_offer(ch, make_box(1)));
+      CHECK(chan_offer(ch, make_box(2)));
+      CHECK(!chan_offer(ch, make_box(3)));
+      CHECK(equal(chan_poll(ch), make_box(1)));
+      CHECK(equal(chan_poll(ch), make_box(2)));
+      CHECK(chan_poll(ch).is_nil());
+    }
+    TEST_CASE("Dropping and sliding buffers")
+    {
+      auto const dropping{ chan(kw("dropping"), make_box(1)) };
+      CHECK(chan_offer(dropping, make_box(1)));
+      CHECK(chan_offer(dropping, make_box(2)));
+      CHECK(equal(chan_poll(dropping), make_box(1)));
+      CHECK(chan_poll(dropping).is_nil());
+
+      auto const sliding{ chan(kw("sliding"), make_box(1)) };
+      CHECK(chan_offer(sliding, make_box(1)));
+      CHECK(chan_offer(sliding, make_box(2)));
+      CHECK(equal(chan_poll(sliding), make_box(2)));
+      CHECK(chan_poll(sliding).is_nil());
+
+      CHECK_THROWS(chan(kw("sliding"), make_box(0)));
+      CHECK_THROWS(chan(kw("unknown"), make_box(1)));
+    }
+    TEST_CASE("Unbuffered")
+    {
+      auto const ch{ chan({}, {}) };
+      CHECK(!chan_offer(ch, make_box(1)));
+
+      /* A parked take is completed directly by the put. */
+      auto const p{ make_box<promise>() };
+      chan_take(ch, p);
+      CHECK(!p->is_realized());
+      CHECK(chan_offer(ch, make_box(1)));
+      CHECK(equal(p->deref(), make_box(1)));
+
+      /* A parked put is completed directly by the take. */
+      auto const put_done{ make_box<promise>() };
+      CHECK(chan_put(ch, make_box(2), put_done));
+      CHECK(!put_done->is_realized());
+      CHECK(equal(chan_poll(ch), make_box(2)));
+      CHECK(equal(put_done->deref(), jank_true));
+    }
+    TEST_CASE("Parked puts move into the buffer")
+    {
+      auto const ch{ chan(kw("fixed"), make_box(1)) };
+      CHECK(chan_put_blocking(ch, make_box(1)));
+      auto const put_done{ make_box<promise>() };
+      CHECK(chan_put(ch, make_box(2), put_done));
+      CHECK(!put_done->is_realized());
+      CHECK(equal(chan_take_blocking(ch), make_box(1)));
+      CHECK(put_done->is_realized());
+      CHECK(equal(chan_take_blocking(ch), make_box(2)));
+    }
+    TEST_CASE("Close")
+    {
+      auto const ch{ chan(kw("fixed"), make_box(2)) };
+      CHECK(chan_offer(ch, make_box(1)));
+
+      auto const empty{ chan({}, {}) };
+      auto const p{ make_box<promise>() };
+      chan_take(empty, p);
+      chan_close(empty);
+      CHECK(p->is_realized());
+      CHECK(p->deref().is_nil());
+
+      chan_close(ch);
+      CHECK(!chan_put(ch, make_box(2), {}));
+      CHECK(!chan_offer(ch, make_box(2)));
+      /* What was put before closing can still be taken. */
+      CHECK(equal(chan_take_blocking(ch), make_box(1)));
+      CHECK(chan_take_blocking(ch).is_nil());
+      CHECK_THROWS(chan_put(ch, {}, {}));
+    }
+    TEST_CASE("Alts")
+    {
+      auto const a{ chan({}, {}) };
+      auto const b{ chan(kw("fixed"), make_box(1)) };
+      CHECK(chan_offer(b, make_box(1)));
+
+      auto const ports{ make_box<persistent_vector>(std::in_place, a, b) };
+      auto const res{ alts(ports, jank_true, jank_false, {}) };
+      CHECK(equal(first(res), make_box(1)));
+      CHECK(equal(second(res), b));
+
+      /* Puts are vectors of the channel and the value. */
+      auto const put_ports{ make_box<persistent_vector>(
+        std::in_place,
+        a,
+        make_box<persistent_vector>(std::in_place, b, make_box(2))) };
+      auto const put_res{ alts(put_ports, jank_false, jank_false, {}) };
+      CHECK(equal(first(put_res), jank_true));
+      CHECK(equal(second(put_res), b));
+      CHECK(equal(chan_poll(b), make_box(2)));
+
+      /* With nothing ready, the default wins and the parked takes are abandoned. */
+      auto const fallback{ alts(ports, jank_false, jank_true, make_box(3)) };
+      CHECK(equal(first(fallback), make_box(3)));
+      CHECK(equal(second(fallback), kw("default")));
+      CHECK(!chan_offer(a, make_box(4)));
+      CHECK(chan_offer(b, make_box(5)));
+      CHECK(equal(chan_poll(b), make_box(5)));
+    }
+    TEST_CASE("Abandoned handlers are swept")
+    {
+      /* Each of these parks a take, which the default then abandons. */
+      auto const quiet{ chan({}, {}) };
+      auto const ports{ make_box<persistent_vector>(std::in_place, quiet) };
+      for(usize i{}; i < channel::max_pending * 4; ++i)
+      {
+        alts(ports, jank_false, jank_true, {});
+      }
+      CHECK(expect_object<channel>(quiet)->takers.size() <= channel::max_dirty + 1);
+    }
+    TEST_CASE("Pending limit")
+    {
+      auto const ch{ chan({}, {}) };
+      for(usize i{}; i < channel::max_pending; ++i)
+      {
+        chan_take(ch, {});
+      }
+      CHECK_THROWS(chan_take(ch, {}));
+
+      /* Completing the parked takes makes room again. */
+      for(usize i{}; i < channel::max_pending; ++i)
+      {
+        CHECK(chan_offer(ch, make_box(1)));
+      }
+      for(usize i{}; i < channel::max_pending; ++i)
+      {
+        chan_put(ch, make_box(1), {});
+      }
+      CHECK_THROWS(chan_put(ch, make_box(1), {}));
+    }
+    TEST_CASE("Timeout")
+    {
+      CHECK(chan_take_blocking(timeout(make_box(5))).is_nil());
+    }
+    TEST_CASE("Dispatch")
+    {
+      auto const ch{ chan(kw("fixed"), make_box(1)) };
+      std::function<object_ref()> put{ [=]() -> object_ref {
+        chan_put_blocking(ch, make_box(1));
+        return {};
+      } };
+      dispatch(make_box<native_function_wrapper>(std::move(put)));
+      CHECK(equal(chan_take_blocking(ch), make_box(1)));
+    }
+    TEST_CASE("Go blocks park")
+    {
+      /* Far more go blocks wait at once than there are workers and spares, so this only
+       * finishes if parked go blocks give their workers back. */
+      static constexpr i64 count{ 1000 };
+      auto const in{ chan({}, {}) };
+      auto const out{ chan(kw("fixed"), make_box(count)) };
+      for(i64 i{}; i < count; ++i)
+      {
+        std::function<object_ref()> relay{ [=]() -> object_ref {
+          auto const v{ chan_take_blocking(in) };
+          chan_put_blocking(out, make_box(to_int(v) + 1));
+          return {};
+        } };
+        go_dispatch(make_box<native_function_wrapper>(std::move(relay)));
+      }
+
+      i64 sum{};
+      for(i64 i{}; i < count; ++i)
+      {
+        CHECK(chan_put_blocking(in, make_box(i)));
+      }
+      for(i64 i{}; i < count; ++i)
+      {
+        sum += to_int(chan_take_blocking(out));
+      }
+      CHECK_EQ(sum, (count * (count - 1) / 2) + count);
+
+      /* A go block whose take completes right away doesn't need to park. */
+      auto const ready{ chan(kw("fixed"), make_box(1)) };
+      CHECK(chan_offer(ready, make_box(5)));
+      auto const res{ chan(kw("fixed"), make_box(1)) };
+      std::function<object_ref()> take{ [=]() -> object_ref {
+        chan_put_blocking(res, chan_take_blocking(ready));
+        return {};
+      } };
+      go_dispatch(make_box<native_function_wrapper>(std::move(take)));
+      CHECK(equal(chan_take_blocking(res), make_box(5)));
+    }
+  }
+}
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <filesystem>
+#include <random>
+
+#include <jank/runtime/obj/file_reader.hpp>
+#include <jank/runtime/obj/file_writer.hpp>
+#include <jank/runtime/obj/array_chunk.hpp>
+#include <jank/runtime/obj/persistent_string.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/rtti.hpp>
+#include <jank/util/fmt.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  /* A uniquely named file with the given contents. It's removed once it goes out of scope,
+   * so any reader over it must be closed first. */
+  struct temp_file
+  {
+    temp_file(jtl::immutable_string const &contents)
+    {
+      static std::atomic<usize> next{};
+      auto const name{ util::format("jank-file-reader-test-{}-{}.txt",
+                                    std::random_device{}(),
+                                    next.fetch_add(1)) };
+      path = (std::filesystem::temp_directory_path() / name.c_str()).string();
+      auto const writer{ make_box<file_writer>(path, false) };
+      writer->write(contents);
+      writer->close();
+    }
+
+    ~temp_file()
+    {
+      std::error_code ec;
+      std::filesystem::remove(path.c_str(), ec);
+    }
+
+    jtl::immutable_string path;
+  };
+
+  static file_reader_ref open(jtl::immutable_string const &path)
+  {
+    return make_box<file_reader>(module::loader::read_file(path).expect_ok_move());
+  }
+
+  TEST_SUITE("file_reader")
+  {
+    TEST_CASE("read_line")
+    {
+      temp_file const file{ "one\ntwo\r\n\nfour" };
+      auto const reader{ open(file.path) };
+      CHECK(equal(reader->read_line(), make_box("one")));
+      CHECK(equal(reader->read_line(), make_box("two")));
+      CHECK(equal(reader->read_line(), make_box("")));
+      CHECK(equal(reader->read_line(), make_box("four")));
+      CHECK(reader->read_line().is_nil());
+      reader->close();
+    }
+
+    TEST_CASE("empty file")
+    {
+      temp_file const file{ "" };
+      auto const reader{ open(file.path) };
+      CHECK(reader->read_line().is_nil());
+      CHECK(reader->read_line_chunk().is_nil());
+      reader->close();
+    }
+
+    TEST_CASE("read_line_chunk")
+    {
+      jtl::string_builder sb;
+      for(usize i{}; i < file_reader::chunk_size + 1; ++i)
+      {
+        sb("line\n");
+      }
+      temp_file const file{ sb.release() };
+      auto const reader{ open(file.path) };
+
+      auto const first{ reader->read_line_chunk() };
+      REQUIRE(first.get_type() == object_type::array_chunk);
+      CHECK(expect_object<array_chunk>(first)->count() == file_reader::chunk_size);
+
+      auto const second{ reader->read_line_chunk() };
+      REQUIRE(second.get_type() == object_type::array_chunk);
+      CHECK(expect_object<array_chunk>(second)->count() == 1);
+
+      CHECK(reader->read_line_chunk().is_nil());
+      reader->close();
+    }
+
+    TEST_CASE("edn_read")
+    {
+      temp_file const file{ "[1 2] (3\n:rest" };
+      auto const reader{ open(file.path) };
+      CHECK(equal(edn_read(reader, {}),
+                  make_box<persistent_vector>(std::in_place, make_box(1), make_box(2))));
+
+      /* A failed read leaves the reader where it was. */
+      auto const before{ reader->offset };
+      CHECK_THROWS(edn_read(reader, {}));
+      CHECK_EQ(reader->offset, before);
+      CHECK(equal(reader->read_line(), make_box(" (3")));
+      reader->close();
+    }
+  }
+}
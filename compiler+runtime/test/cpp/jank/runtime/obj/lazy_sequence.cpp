@@ -0,0 +1,118 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <jank/runtime/obj/lazy_sequence.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/gc.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref make_fn(std::function<object_ref()> &&f)
+  {
+    return make_box<native_function_wrapper>(std::move(f));
+  }
+
+  TEST_SUITE("lazy_sequence")
+  {
+    TEST_CASE("Realized once")
+    {
+      static usize calls{};
+      calls = 0;
+      auto const ls{ make_box<lazy_sequence>(make_fn([]() -> object_ref {
+        ++calls;
+        return make_box<persistent_vector>(std::in_place, make_box(1), make_box(2));
+      })) };
+      CHECK(!ls->is_realized());
+      CHECK(equal(ls->first(), make_box(1)));
+      CHECK(ls->is_realized());
+      CHECK(equal(ls->next(), make_box<persistent_vector>(std::in_place, make_box(2))));
+      CHECK(ls->seq() == ls->seq());
+      CHECK_EQ(calls, 1);
+    }
+    TEST_CASE("Concurrent realization")
+    {
+      static std::atomic<usize> calls{};
+      static std::atomic_bool started{};
+      calls = 0;
+      started = false;
+      auto const ls{ make_box<lazy_sequence>(make_fn([]() -> object_ref {
+        started = true;
+        /* Long enough for the other thread to come along and wait on us. */
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+        ++calls;
+        return make_box<persistent_vector>(std::in_place, make_box(1), make_box(2));
+      })) };
+
+      object_ref other_seq;
+      std::thread other{ [&]() {
+        GC_stack_base sb{};
+        GC_get_stack_base(&sb);
+        GC_register_my_thread(&sb);
+        while(!started.load())
+        {
+          std::this_thread::yield();
+        }
+        /* This thread arrives mid-realization, so it waits rather than calling fn. */
+        other_seq = ls->seq();
+        GC_unregister_my_thread();
+      } };
+
+      auto const this_seq{ ls->seq() };
+      other.join();
+      CHECK_EQ(calls.load(), 1);
+      CHECK(this_seq == other_seq);
+      CHECK(equal(first(other_seq), make_box(1)));
+    }
+    TEST_CASE("Nested")
+    {
+      auto const inner{ make_box<lazy_sequence>(make_fn([]() -> object_ref {
+        return make_box<persistent_vector>(std::in_place, make_box(1));
+      })) };
+      auto const middle{ make_box<lazy_sequence>(
+        make_fn([=]() -> object_ref { return inner; })) };
+      auto const outer{ make_box<lazy_sequence>(
+        make_fn([=]() -> object_ref { return middle; })) };
+      CHECK(equal(outer->first(), make_box(1)));
+      /* Every nested sequence is realized along the way and shares the same seq. */
+      CHECK(middle->is_realized());
+      CHECK(inner->is_realized());
+      CHECK(inner->seq() == outer->seq());
+
+      auto const empty{ make_box<lazy_sequence>(make_fn([]() -> object_ref { return {}; })) };
+      CHECK(empty->seq().is_nil());
+      CHECK(empty->first().is_nil());
+      CHECK(empty->is_realized());
+    }
+    TEST_CASE("Failed realization is retried")
+    {
+      static bool fail{};
+      fail = true;
+      auto const ls{ make_box<lazy_sequence>(make_fn([]() -> object_ref {
+        if(fail)
+        {
+          throw std::runtime_error{ "fail" };
+        }
+        return make_box<persistent_vector>(std::in_place, make_box(1));
+      })) };
+      CHECK_THROWS(ls->seq());
+      CHECK(!ls->is_realized());
+      fail = false;
+      CHECK(equal(ls->first(), make_box(1)));
+    }
+    TEST_CASE("Self dependent")
+    {
+      static lazy_sequence_ref ls;
+      ls = make_box<lazy_sequence>(make_fn([]() -> object_ref { return ls->seq(); }));
+      CHECK_THROWS(ls->seq());
+      CHECK(!ls->is_realized());
+    }
+  }
+}
@@ -0,0 +1,121 @@
+#include <jank/runtime/obj/persistent_shape_map.hpp>
+#include <jank/runtime/obj/persistent_array_map.hpp>
+#include <jank/runtime/obj/persistent_hash_map.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/context.hpp>
+#include <jank/util/fmt.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref kw(usize const i)
+  {
+    return __rt_ctx->intern_keyword(util::format("k{}", i)).expect_ok();
+  }
+
+  /* Builds a map of `:k0 0, :k1 1, ...` by assoc, starting from an empty array map. */
+  static object_ref make_record(usize const size)
+  {
+    object_ref ret{ persistent_array_map::empty() };
+    for(usize i{}; i < size; ++i)
+    {
+      ret = runtime::assoc(ret, kw(i), make_box(static_cast<i64>(i)));
+    }
+    return ret;
+  }
+
+  TEST_SUITE("persistent_shape_map")
+  {
+    TEST_CASE("promotion from persistent_array_map in assoc")
+    {
+      CHECK(make_record(8).get_type() == object_type::persistent_array_map);
+
+      auto const m{ make_record(9) };
+      REQUIRE(m.get_type() == object_type::persistent_shape_map);
+      CHECK(expect_object<persistent_shape_map>(m)->count() == 9);
+      for(usize i{}; i < 9; ++i)
+      {
+        CHECK(equal(runtime::get(m, kw(i)), make_box(static_cast<i64>(i))));
+      }
+      CHECK(runtime::get(m, kw(9)).is_nil());
+      CHECK(equal(runtime::get(m, make_box(1), make_box(2)), make_box(2)));
+    }
+
+    TEST_CASE("same keys share a shape")
+    {
+      auto const a{ expect_object<persistent_shape_map>(make_record(20)) };
+      auto const b{ expect_object<persistent_shape_map>(make_record(20)) };
+      CHECK_EQ(a->data.shape, b->data.shape);
+
+      /* Updating a key keeps the shape. */
+      auto const updated{ expect_object<persistent_shape_map>(a->assoc(kw(3), make_box(42))) };
+      CHECK_EQ(updated->data.shape, a->data.shape);
+      CHECK(equal(updated->get(kw(3)), make_box(42)));
+      CHECK(equal(a->get(kw(3)), make_box(3)));
+    }
+
+    TEST_CASE("cached get")
+    {
+      runtime::detail::shape_slot_cache cache;
+      auto const a{ make_record(12) };
+      auto const b{ runtime::assoc(make_record(12), kw(5), make_box(50)) };
+      CHECK(equal(keyword_get(kw(5), cache, a), make_box(5)));
+      CHECK(cache.entry.load() != 0);
+      CHECK(equal(keyword_get(kw(5), cache, b), make_box(50)));
+
+      /* A different shape misses the cache, but still finds the key. */
+      auto const c{ runtime::dissoc(make_record(14), kw(0)) };
+      CHECK(equal(keyword_get(kw(5), cache, c), make_box(5)));
+      CHECK(equal(keyword_get(kw(5), cache, a), make_box(5)));
+
+      /* Other maps are looked up as usual. */
+      CHECK(keyword_get(kw(30), cache, a).is_nil());
+      CHECK(equal(keyword_get(kw(30), cache, a, make_box(1)), make_box(1)));
+      CHECK(equal(keyword_get(kw(1), cache, make_record(2)), make_box(1)));
+      CHECK(keyword_get(kw(1), cache, jank_nil).is_nil());
+    }
+
+    TEST_CASE("promotion to persistent_hash_map")
+    {
+      auto const m{ make_record(10) };
+      auto const with_int{ runtime::assoc(m, make_box(1), make_box(1)) };
+      CHECK(with_int.get_type() == object_type::persistent_hash_map);
+      CHECK(equal(runtime::get(with_int, kw(4)), make_box(4)));
+
+      auto const full{ make_record(persistent_shape_map::max_size) };
+      CHECK(full.get_type() == object_type::persistent_shape_map);
+      CHECK(make_record(persistent_shape_map::max_size + 1).get_type()
+            == object_type::persistent_hash_map);
+    }
+
+    TEST_CASE("dissoc")
+    {
+      auto const m{ make_record(10) };
+      auto const d{ runtime::dissoc(m, kw(4)) };
+      REQUIRE(d.get_type() == object_type::persistent_shape_map);
+      CHECK(expect_object<persistent_shape_map>(d)->count() == 9);
+      CHECK(runtime::get(d, kw(4)).is_nil());
+      CHECK(equal(runtime::get(d, kw(9)), make_box(9)));
+      CHECK(runtime::dissoc(m, kw(20)) == m);
+    }
+
+    TEST_CASE("equal to other maps")
+    {
+      auto const m{ make_record(10) };
+      runtime::detail::native_transient_hash_map items;
+      for(usize i{}; i < 10; ++i)
+      {
+        items.set(kw(i), make_box(static_cast<i64>(i)));
+      }
+      auto const h{ make_box<persistent_hash_map>(items.persistent()) };
+      CHECK(equal(m, h));
+      CHECK(equal(h, m));
+      CHECK_EQ(m.to_hash(), h->to_hash());
+      CHECK(!equal(runtime::assoc(m, kw(1), make_box(2)), h));
+    }
+  }
+}
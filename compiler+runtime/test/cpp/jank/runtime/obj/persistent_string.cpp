@@ -1,6 +1,7 @@
 #include <jank/runtime/obj/persistent_string.hpp>
 #include <jank/runtime/core/make_box.hpp>
 #include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/seq.hpp>
 
 /* This must go last; doctest and glog both define CHECK and family. */
 #include <doctest/doctest.h>
@@ -29,6 +30,21 @@ namespace jank::runtime::obj
       CHECK(equal(s.get(under), jank_nil));
       CHECK(equal(s.get(non_int), jank_nil));
     }
+    TEST_CASE("characters are shared")
+    {
+      CHECK(s.get(min) == make_box('f'));
+      CHECK(first(s.seq()) == make_box('f'));
+
+      /* Two byte UTF-8 is shared, too. */
+      auto const accented{ make_box<persistent_string>("\xC3\xA9") };
+      auto const c{ first(accented->seq()) };
+      CHECK(c == first(accented->seq()));
+      CHECK(equal(c, character::create(static_cast<i64>(0xE9))));
+
+      /* Anything longer is boxed each time, but still equal. */
+      auto const emoji{ make_box<persistent_string>("\xF0\x9F\x98\x80") };
+      CHECK(equal(first(emoji->seq()), first(emoji->seq())));
+    }
     TEST_CASE("get with fallback")
     {
       CHECK(equal(s.get(min, non_int), min_char));
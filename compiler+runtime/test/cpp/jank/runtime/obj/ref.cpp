@@ -0,0 +1,173 @@
+#include <thread>
+
+#include <jank/runtime/obj/ref.hpp>
+#include <jank/runtime/obj/native_function_wrapper.hpp>
+#include <jank/runtime/obj/persistent_vector.hpp>
+#include <jank/runtime/core/stm.hpp>
+#include <jank/runtime/core/make_box.hpp>
+#include <jank/runtime/core/equal.hpp>
+#include <jank/runtime/core/math.hpp>
+#include <jank/runtime/core/seq.hpp>
+#include <jank/runtime/detail/transaction.hpp>
+#include <jank/gc.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  static object_ref plus(object_ref const val, object_ref const n)
+  {
+    return promoting_add(val, n);
+  }
+
+  static object_ref one()
+  {
+    return make_box<persistent_vector>(std::in_place, make_box(1))->seq();
+  }
+
+  TEST_SUITE("ref")
+  {
+    TEST_CASE("Outside of a transaction")
+    {
+      auto const r{ runtime::ref(make_box(1)) };
+      CHECK(equal(r->deref(), make_box(1)));
+      CHECK(!is_transaction_running());
+      CHECK_THROWS(ref_set(r, make_box(2)));
+      CHECK_THROWS(ref_alter(r, make_box<native_function_wrapper>(&plus), one()));
+    }
+    TEST_CASE("Commit")
+    {
+      auto const a{ runtime::ref(make_box(1)) };
+      auto const b{ runtime::ref(make_box(10)) };
+      std::function<object_ref()> const transfer{ [=]() -> object_ref {
+        ref_alter(a, make_box<native_function_wrapper>(&plus), one());
+        ref_set(b, make_box(20));
+        /* Within the transaction, we see our own writes. */
+        CHECK(equal(a->deref(), make_box(2)));
+        CHECK(is_transaction_running());
+        return b->deref();
+      } };
+
+      auto const ret{ run_in_transaction(make_box<native_function_wrapper>(transfer)) };
+      CHECK(equal(ret, make_box(20)));
+      CHECK(equal(a->deref(), make_box(2)));
+      CHECK(equal(b->deref(), make_box(20)));
+    }
+    TEST_CASE("Exceptions abort")
+    {
+      auto const r{ runtime::ref(make_box(1)) };
+      std::function<object_ref()> const fail{ [=]() -> object_ref {
+        ref_set(r, make_box(2));
+        throw std::runtime_error{ "abort" };
+      } };
+      CHECK_THROWS(run_in_transaction(make_box<native_function_wrapper>(fail)));
+      CHECK(equal(r->deref(), make_box(1)));
+
+      /* The validator runs at commit. */
+      r->set_validator(make_box<native_function_wrapper>(
+        std::function<object_ref(object_ref const)>{ [](object_ref const val) -> object_ref {
+          return equal(val, make_box(3)) ? jank_false : jank_true;
+        } }));
+      std::function<object_ref()> const invalid{ [=]() -> object_ref {
+        return ref_set(r, make_box(3));
+      } };
+      CHECK_THROWS(run_in_transaction(make_box<native_function_wrapper>(invalid)));
+      CHECK(equal(r->deref(), make_box(1)));
+    }
+    TEST_CASE("Can't set after commute")
+    {
+      auto const r{ runtime::ref(make_box(1)) };
+      std::function<object_ref()> const f{ [=]() -> object_ref {
+        ref_commute(r, make_box<native_function_wrapper>(&plus), one());
+        return ref_set(r, make_box(5));
+      } };
+      CHECK_THROWS(run_in_transaction(make_box<native_function_wrapper>(f)));
+      CHECK(equal(r->deref(), make_box(1)));
+    }
+    TEST_CASE("Ensure")
+    {
+      auto const a{ runtime::ref(make_box(1)) };
+      auto const b{ runtime::ref(make_box(10)) };
+      CHECK_THROWS(ref_ensure(a));
+
+      std::function<object_ref()> const f{ [=]() -> object_ref {
+        /* Reading an ensured ref, or ensuring it again, doesn't lock it again. */
+        CHECK(equal(ref_ensure(a), make_box(1)));
+        CHECK(equal(ref_ensure(a), make_box(1)));
+        CHECK(equal(a->deref(), make_box(1)));
+        ref_commute(a, make_box<native_function_wrapper>(&plus), one());
+        CHECK(equal(a->deref(), make_box(2)));
+        ref_ensure(b);
+        /* Setting an ensured ref claims it, which replaces the read lock. */
+        ref_set(b, make_box(20));
+        CHECK(equal(b->deref(), make_box(20)));
+        return a->deref();
+      } };
+      CHECK(equal(run_in_transaction(make_box<native_function_wrapper>(f)), make_box(2)));
+      CHECK(equal(a->deref(), make_box(2)));
+      CHECK(equal(b->deref(), make_box(20)));
+
+      /* The locks are all released once the transaction is done. */
+      CHECK(a->lock.try_lock());
+      a->lock.unlock();
+      CHECK(b->lock.try_lock());
+      b->lock.unlock();
+    }
+    TEST_CASE("History")
+    {
+      auto const r{ runtime::ref(make_box(0)) };
+      set_ref_min_history(r, make_box(2));
+      set_ref_max_history(r, make_box(3));
+      std::function<object_ref()> const inc{ [=]() -> object_ref {
+        return ref_alter(r, make_box<native_function_wrapper>(&plus), one());
+      } };
+      for(usize i{}; i < 5; ++i)
+      {
+        run_in_transaction(make_box<native_function_wrapper>(inc));
+      }
+      /* The history only grows past the min when readers fault. */
+      CHECK(ref_history_count(r) == 2);
+      CHECK(equal(r->deref(), make_box(5)));
+    }
+    TEST_CASE("Contended")
+    {
+      static constexpr usize thread_count{ 4 };
+      static constexpr usize per_thread{ 250 };
+      auto const alter_ref{ runtime::ref(make_box(0)) };
+      auto const commute_ref{ runtime::ref(make_box(0)) };
+      std::function<object_ref()> const inc{ [=]() -> object_ref {
+        ref_alter(alter_ref, make_box<native_function_wrapper>(&plus), one());
+        return ref_commute(commute_ref, make_box<native_function_wrapper>(&plus), one());
+      } };
+      auto const fn{ make_box<native_function_wrapper>(inc) };
+
+      auto const commits_before{ detail::transaction::stats().commits.load() };
+      std::vector<std::thread> threads;
+      for(usize i{}; i < thread_count; ++i)
+      {
+        threads.emplace_back([=]() {
+          /* These threads allocate, so the GC needs to know about them. */
+          GC_stack_base sb{};
+          GC_get_stack_base(&sb);
+          GC_register_my_thread(&sb);
+          for(usize j{}; j < per_thread; ++j)
+          {
+            run_in_transaction(fn);
+          }
+          GC_unregister_my_thread();
+        });
+      }
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+
+      auto const total{ make_box(static_cast<i64>(thread_count * per_thread)) };
+      CHECK(equal(alter_ref->deref(), total));
+      CHECK(equal(commute_ref->deref(), total));
+      CHECK(detail::transaction::stats().commits.load() - commits_before
+            == thread_count * per_thread);
+    }
+  }
+}
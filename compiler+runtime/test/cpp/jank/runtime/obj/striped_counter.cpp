@@ -0,0 +1,53 @@
+#include <thread>
+
+#include <jank/runtime/obj/striped_counter.hpp>
+#include <jank/runtime/core.hpp>
+#include <jank/runtime/core/equal.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::runtime::obj
+{
+  TEST_SUITE("striped_counter")
+  {
+    TEST_CASE("Uncontended")
+    {
+      auto const c{ runtime::striped_counter() };
+      c->add(2);
+      c->add(-5);
+      CHECK(c->sum() == -3);
+      CHECK(!c->contended.load());
+      CHECK(equal(c->deref(), make_box(-3)));
+
+      c->reset();
+      CHECK(c->sum() == 0);
+    }
+    TEST_CASE("Contended")
+    {
+      static constexpr usize thread_count{ 8 };
+      static constexpr i64 per_thread{ 10000 };
+      auto const c{ runtime::striped_counter() };
+
+      /* Counting doesn't allocate, so these threads don't need to be known to the GC. */
+      std::vector<std::thread> threads;
+      for(usize i{}; i < thread_count; ++i)
+      {
+        threads.emplace_back([=]() {
+          for(i64 j{}; j < per_thread; ++j)
+          {
+            c->add(1);
+          }
+        });
+      }
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+
+      CHECK(c->sum() == static_cast<i64>(thread_count) * per_thread);
+      CHECK(c->sum_then_reset() == static_cast<i64>(thread_count) * per_thread);
+      CHECK(c->sum() == 0);
+    }
+  }
+}
@@ -0,0 +1,68 @@
+#include <jtl/ref.hpp>
+
+#include <jank/util/arena.hpp>
+
+/* This must go last; doctest and glog both define CHECK and family. */
+#include <doctest/doctest.h>
+
+namespace jank::util
+{
+  struct arena_node : arena_allocated
+  {
+    arena_node(i64 const value)
+      : value{ value }
+    {
+    }
+
+    i64 value{};
+  };
+
+  TEST_SUITE("util::arena")
+  {
+    TEST_CASE("allocate")
+    {
+      arena a;
+
+      SUBCASE("alignment")
+      {
+        a.allocate(1, 1);
+        auto const p{ reinterpret_cast<uptr>(a.allocate(8, 8)) };
+        CHECK_EQ(0, p % 8);
+      }
+
+      SUBCASE("large")
+      {
+        auto * const small{ static_cast<char *>(a.allocate(16, 8)) };
+        auto * const large{ static_cast<char *>(a.allocate(1024 * 1024, 8)) };
+        large[(1024 * 1024) - 1] = 1;
+        /* We keep bumping from the same chunk after a large allocation. */
+        auto * const next{ static_cast<char *>(a.allocate(16, 8)) };
+        CHECK_EQ(small + 16, next);
+      }
+    }
+
+    TEST_CASE("scope")
+    {
+      CHECK_EQ(nullptr, arena::current());
+      {
+        arena a;
+        arena::scope const s{ a };
+        CHECK_EQ(&a, arena::current());
+        {
+          arena::escape const e;
+          CHECK_EQ(nullptr, arena::current());
+        }
+        {
+          arena inner;
+          arena::scope const inner_scope{ inner };
+          CHECK_EQ(&inner, arena::current());
+        }
+        CHECK_EQ(&a, arena::current());
+
+        auto const node{ jtl::make_ref<arena_node>(5) };
+        CHECK_EQ(5, node->value);
+      }
+      CHECK_EQ(nullptr, arena::current());
+    }
+  }
+}
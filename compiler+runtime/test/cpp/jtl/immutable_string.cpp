@@ -200,6 +200,33 @@ TEST_CASE("Substring")
       CHECK_EQ(sub, "o b");
     }
   }
+
+  SUBCASE("Shared")
+  {
+    jtl::immutable_string const s(2048, 'a');
+
+    SUBCASE("Small piece of a large corpus is copied")
+    {
+      auto const sub(s.substr(10, 100));
+      CHECK_EQ(sub.size(), 100);
+      CHECK_NE(sub.data(), s.data() + 10);
+    }
+
+    SUBCASE("Half of a large corpus is shared")
+    {
+      auto const sub(s.substr(1024));
+      CHECK_EQ(sub.size(), 1024);
+      CHECK_EQ(sub.data(), s.data() + 1024);
+    }
+
+    SUBCASE("Explicitly shared")
+    {
+      auto const sub(s.shared_substr(10, 100));
+      CHECK_EQ(sub.size(), 100);
+      CHECK_EQ(sub.data(), s.data() + 10);
+      CHECK_EQ(sub, jtl::immutable_string(100, 'a'));
+    }
+  }
 }
 }
 ;
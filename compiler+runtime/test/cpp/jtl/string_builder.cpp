@@ -71,6 +71,17 @@ namespace jtl
       CHECK_EQ("0xcafebabe", sb.view());
     }
 
+    TEST_CASE("string view")
+    {
+      string_builder sb;
+      jtl::immutable_string const input{ "foo bar" };
+      sb(immutable_string_view{ input.data(), 3 });
+      sb(' ');
+      sb(immutable_string_view{ input.data() + 4, 3 });
+      CHECK_EQ(7, sb.pos);
+      CHECK_EQ(input, sb.view());
+    }
+
     TEST_CASE("int")
     {
       string_builder sb;